@@ -277,14 +277,13 @@ public:
         std::shared_ptr<ParticleContainer_t> pc = this->pcontainer_m;
         std::shared_ptr<FieldContainer_t> fc    = this->fcontainer_m;
 
+        // kick and drift in a single kernel, which both pushVelocity and pushPosition time
         IpplTimings::startTimer(PTimer);
-        pc->P = pc->P - 0.5 * dt * pc->E;
-        IpplTimings::stopTimer(PTimer);
-
-        // drift
         IpplTimings::startTimer(RTimer);
-        pc->R = pc->R + dt * pc->P;
+        ippl::fuse(ippl::assign(pc->P, pc->P - 0.5 * dt * pc->E),
+                   ippl::assign(pc->R, pc->R + dt * pc->P));
         IpplTimings::stopTimer(RTimer);
+        IpplTimings::stopTimer(PTimer);
 
         // Since the particles have moved spatially update them to correct processors
         IpplTimings::startTimer(updateTimer);
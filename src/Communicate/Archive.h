@@ -34,6 +34,44 @@ namespace ippl {
          * @tparam Properties variadic template for Kokkos::View
          */
 
+        /*!
+         * Several messages stored back to back in one archive, one per destination.
+         * Message m holds the elements [starts(m), starts(m + 1)) of a send list and
+         * begins at byte bytesPerElement * starts(m), where bytesPerElement is the packed
+         * size of one element summed over all views serialized into the archive. Inside
+         * a message the views follow each other as if the message had been packed on
+         * its own with Archive::serialize(view, hash, count), so receivers deserialize
+         * it unchanged.
+         * @tparam MemorySpace memory space of the archive
+         */
+        template <typename MemorySpace>
+        struct MessageLayout {
+            //! First send-list index of every message, and the total count at the end
+            Kokkos::View<size_type*, MemorySpace> starts;
+            size_type bytesPerElement;
+
+            /*!
+             * Byte position of send-list element k of a view that starts at byte
+             * `column` of each message and takes `size` bytes per element.
+             */
+            KOKKOS_INLINE_FUNCTION size_type position(size_type k, size_type column,
+                                                      size_type size) const {
+                size_type lo = 0;
+                size_type hi = starts.extent(0) - 1;
+                while (hi - lo > 1) {
+                    const size_type mid = (lo + hi) / 2;
+                    if (starts(mid) <= k) {
+                        lo = mid;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                const size_type first = starts(lo);
+                const size_type count = starts(lo + 1) - first;
+                return bytesPerElement * first + count * column + (k - first) * size;
+            }
+        };
+
         template <class... Properties>
         class Archive {
         public:
@@ -41,6 +79,10 @@ namespace ippl {
             using memory_space = typename buffer_type::memory_space;
             using pointer_type = typename buffer_type::pointer_type;
 
+            template <typename T>
+            using unmanaged_view_type =
+                Kokkos::View<T*, memory_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
             Archive(size_type size = 0);
             ~Archive();
 
@@ -71,6 +113,25 @@ namespace ippl {
             void serialize(const Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view,
                            const HashView& hash, size_type nsends);
 
+            /*!
+             * Serialize view(hash(k)) for all nsends elements of a send list into the
+             * messages described by layout. The write position is the byte offset of
+             * this view inside every message and advances by the size of one element.
+             * Unlike serialize, this does not fence, so all views of all messages can be
+             * packed before a single fence.
+             * @param view to take data from
+             * @param hash index into view of every element of the send list
+             * @param layout where each message starts
+             */
+            template <typename T, class... ViewArgs, typename HashView>
+            void serializeMessages(const Kokkos::View<T*, ViewArgs...>& view, const HashView& hash,
+                                   const MessageLayout<memory_space>& layout, size_type nsends);
+
+            template <typename T, unsigned Dim, class... ViewArgs, typename HashView>
+            void serializeMessages(const Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view,
+                                   const HashView& hash, const MessageLayout<memory_space>& layout,
+                                   size_type nsends);
+
             /*!
              * Deserialize.
              * @param view to put data to
@@ -86,6 +147,22 @@ namespace ippl {
             void deserialize(Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view, size_type offset,
                              size_type nrecvs);
 
+            /*!
+             * Deserialize the i-th element to view(slots(i)). The view must already hold
+             * all slots.
+             * @param view to put data to
+             * @param slots destination index of every element
+             */
+            template <typename T, class... ViewArgs, typename HashView>
+                requires Kokkos::is_view<HashView>::value
+            void deserialize(Kokkos::View<T*, ViewArgs...>& view, const HashView& slots,
+                             size_type nrecvs);
+
+            template <typename T, unsigned Dim, class... ViewArgs, typename HashView>
+                requires Kokkos::is_view<HashView>::value
+            void deserialize(Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view,
+                             const HashView& slots, size_type nrecvs);
+
             /*!
              * Deserialize vector attributes
              *
@@ -97,6 +174,23 @@ namespace ippl {
             template <typename T, unsigned Dim, class... ViewArgs>
             void deserialize(Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view, size_type nrecvs);
 
+            /*!
+             * Zero-copy serialization: returns a typed view of count elements aliasing the
+             * buffer at the write position and advances the write position past them. Data
+             * written to the view is in the archive without being packed into it.
+             * @param count number of elements
+             */
+            template <typename T>
+            unmanaged_view_type<T> writeView(size_type count);
+
+            /*!
+             * Zero-copy deserialization: returns a typed view of count elements aliasing the
+             * buffer at the read position and advances the read position past them.
+             * @param count number of elements
+             */
+            template <typename T>
+            unmanaged_view_type<T> readView(size_type count);
+
             /*!
              * @returns a pointer to the data of the buffer.
              *          On GPU this is a page-aligned device pointer from cudaMalloc/hipMalloc.
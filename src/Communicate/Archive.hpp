@@ -4,6 +4,8 @@
 //
 #include "Archive.h"
 
+#include "Utility/PAssert.h"
+
 #if defined(KOKKOS_ENABLE_CUDA)
 #include <cuda_runtime.h>
 #elif defined(KOKKOS_ENABLE_HIP)
@@ -184,6 +186,31 @@ namespace ippl {
 
 #endif  // KOKKOS_ENABLE_CUDA || KOKKOS_ENABLE_HIP
 
+        // =================================================================
+        // Zero-copy views
+        // =================================================================
+
+        template <class... Properties>
+        template <typename T>
+        typename Archive<Properties...>::template unmanaged_view_type<T>
+        Archive<Properties...>::writeView(size_type count) {
+            // The archive buffer is aligned, so is every position that is a multiple of alignof(T)
+            PAssert_EQ(writepos_m % alignof(T), 0);
+            unmanaged_view_type<T> view(reinterpret_cast<T*>(bufferData() + writepos_m), count);
+            writepos_m += sizeof(T) * count;
+            return view;
+        }
+
+        template <class... Properties>
+        template <typename T>
+        typename Archive<Properties...>::template unmanaged_view_type<T>
+        Archive<Properties...>::readView(size_type count) {
+            PAssert_EQ(readpos_m % alignof(T), 0);
+            unmanaged_view_type<T> view(reinterpret_cast<T*>(bufferData() + readpos_m), count);
+            readpos_m += sizeof(T) * count;
+            return view;
+        }
+
         // =================================================================
         // Serialize — scalar
         // =================================================================
@@ -286,6 +313,55 @@ namespace ippl {
             writepos_m += Dim * size * nsends;
         }
 
+        // =================================================================
+        // Serialize — several messages at once
+        // =================================================================
+
+        template <class... Properties>
+        template <typename T, class... ViewArgs, typename HashView>
+        void Archive<Properties...>::serializeMessages(const Kokkos::View<T*, ViewArgs...>& view,
+                                                       const HashView& hash,
+                                                       const MessageLayout<memory_space>& layout,
+                                                       size_type nsends) {
+            using exec_space  = HashView::execution_space;
+            using policy_type = Kokkos::RangePolicy<exec_space>;
+
+            size_t size   = sizeof(T);
+            auto base     = bufferData();
+            auto writepos = writepos_m;
+            Kokkos::parallel_for(
+                "Archive::serializeMessages()", policy_type(0, nsends),
+                KOKKOS_LAMBDA(const size_type k) {
+                    const char* src = reinterpret_cast<const char*>(&view(hash(k)));
+                    char* dst       = base + layout.position(k, writepos, size);
+                    copyBytes(dst, src, size);
+                });
+            writepos_m += size;
+        }
+
+        template <class... Properties>
+        template <typename T, unsigned Dim, class... ViewArgs, typename HashView>
+        void Archive<Properties...>::serializeMessages(
+            const Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view, const HashView& hash,
+            const MessageLayout<memory_space>& layout, size_type nsends) {
+            using exec_space = typename HashView::execution_space;
+            using mdrange_t =
+                Kokkos::MDRangePolicy<Kokkos::Rank<2>, Kokkos::IndexType<size_type>, exec_space>;
+
+            size_t size   = sizeof(T);
+            auto base     = bufferData();
+            auto writepos = writepos_m;
+            Kokkos::parallel_for(
+                "Archive::serializeMessages(vector)", mdrange_t({0, 0}, {(long int)nsends, Dim}),
+                KOKKOS_LAMBDA(const size_type k, const size_t d) {
+                    const T value   = view(hash(k))[d];
+                    const char* src = reinterpret_cast<const char*>(&value);
+                    char* dst       = base + layout.position(k, writepos, Dim * size) + d * size;
+                    copyBytes(dst, src, size);
+                });
+            writepos_m += Dim * size;
+        }
+
         // =================================================================
         // Deserialize — scalar
         // =================================================================
@@ -402,5 +478,58 @@ namespace ippl {
             Kokkos::fence();
             readpos_m += Dim * size * nrecvs;
         }
+
+        // =================================================================
+        // Deserialize — scalar with slots
+        // =================================================================
+
+        template <class... Properties>
+        template <typename T, class... ViewArgs, typename HashView>
+            requires Kokkos::is_view<HashView>::value
+        void Archive<Properties...>::deserialize(Kokkos::View<T*, ViewArgs...>& view,
+                                                 const HashView& slots, size_type nrecvs) {
+            using exec_space  = typename HashView::execution_space;
+            using policy_type = Kokkos::RangePolicy<exec_space>;
+            size_t size       = sizeof(T);
+            auto base         = bufferData();
+            auto readpos      = readpos_m;
+            Kokkos::parallel_for(
+                "Archive::deserialize(slots)", policy_type(0, nrecvs),
+                KOKKOS_LAMBDA(const size_type i) {
+                    const char* src = base + i * size + readpos;
+                    char* dst       = reinterpret_cast<char*>(&view(slots(i)));
+                    copyBytes(dst, src, size);
+                });
+            Kokkos::fence();
+            readpos_m += size * nrecvs;
+        }
+
+        // =================================================================
+        // Deserialize — vector with slots
+        // =================================================================
+
+        template <class... Properties>
+        template <typename T, unsigned Dim, class... ViewArgs, typename HashView>
+            requires Kokkos::is_view<HashView>::value
+        void Archive<Properties...>::deserialize(Kokkos::View<Vector<T, Dim>*, ViewArgs...>& view,
+                                                 const HashView& slots, size_type nrecvs) {
+            using exec_space = typename HashView::execution_space;
+            size_t size      = sizeof(T);
+            using mdrange_t =
+                Kokkos::MDRangePolicy<Kokkos::Rank<2>, Kokkos::IndexType<size_type>, exec_space>;
+            auto base    = bufferData();
+            auto readpos = readpos_m;
+            Kokkos::parallel_for(
+                "Archive::deserialize(slots, vector)", mdrange_t({0, 0}, {(long int)nrecvs, Dim}),
+                KOKKOS_LAMBDA(const size_type i, const size_t d) {
+                    const char* src = base + (Dim * i + d) * size + readpos;
+                    T value;
+                    char* dst = reinterpret_cast<char*>(&value);
+                    copyBytes(dst, src, size);
+                    view(slots(i))(d) = value;
+                });
+            Kokkos::fence();
+            readpos_m += Dim * size * nrecvs;
+        }
     }  // namespace detail
 }  // namespace ippl
@@ -1,13 +1,28 @@
 #ifndef IPPL_BUFFER_HANDLER_H
 #define IPPL_BUFFER_HANDLER_H
 
+#include <array>
+#include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "Communicate/Archive.h"
 
 namespace ippl {
 
+    /**
+     * @brief Allocation counters of a buffer handler.
+     *
+     * After warm-up, a handler that reuses its buffers well only increases `reuses`.
+     */
+    struct BufferStatistics {
+        size_t allocations   = 0;  ///< Number of newly allocated buffers
+        size_t reuses        = 0;  ///< Number of requests served from free buffers
+        size_t releases      = 0;  ///< Number of buffers deallocated (trimmed or deleted)
+        size_t highWaterMark = 0;  ///< Largest total size of buffers in use at once, in bytes
+    };
+
     /**
      * @brief Interface for memory buffer handling.
      *
@@ -79,6 +94,13 @@ namespace ippl {
          * @return Total size of free buffers in bytes.
          */
         virtual size_type getFreeSize() const = 0;
+
+        /**
+         * @brief Gets the allocation counters.
+         *
+         * @return Statistics accumulated since the handler was created.
+         */
+        virtual BufferStatistics getStatistics() const = 0;
     };
 
     /**
@@ -140,6 +162,11 @@ namespace ippl {
          */
         size_type getFreeSize() const override;
 
+        /**
+         * @copydoc BufferHandler::getStatistics
+         */
+        BufferStatistics getStatistics() const override;
+
     private:
         using buffer_comparator_type = bool (*)(const buffer_type&, const buffer_type&);
         using buffer_set_type        = std::set<buffer_type, buffer_comparator_type>;
@@ -156,6 +183,7 @@ namespace ippl {
 
         size_type usedSize_m = 0;  ///< Total size of all allocated buffers
         size_type freeSize_m = 0;  ///< Total size of all free buffers
+        BufferStatistics stats_m;  ///< Allocation counters
 
     protected:
         buffer_set_type used_buffers{
@@ -163,6 +191,118 @@ namespace ippl {
         buffer_set_type free_buffers{
             &DefaultBufferHandler::bufferSizeComparator};  ///< Set of free buffers
     };
+
+    /**
+     * @class PooledBufferHandler
+     * @brief Buffer handler that pools buffers in power-of-two size classes.
+     *
+     * Every request is rounded up to the next power of two, at least one page, and served from
+     * the free list of that size class or the next larger one. Buffers are never resized, so
+     * message sizes that vary between halo exchange, particle migration and FFT transposes reuse
+     * the same few buffers and stop allocating once every class has been populated. Each memory
+     * space has its own handler and therefore its own arena.
+     *
+     * Memory held by free buffers is bounded by a high-water-mark policy: when the free buffers
+     * exceed `trimFactor` times the largest amount ever in use at once, free buffers are
+     * released, largest first, until no more than that high-water mark remains. An explicit
+     * trim() additionally restarts the mark from the current usage, e.g. after a phase of the
+     * simulation with unusually large messages.
+     *
+     * @tparam MemorySpace The memory space type for the buffer (e.g., `Kokkos::HostSpace`).
+     */
+    template <typename MemorySpace>
+    class PooledBufferHandler : public BufferHandler<MemorySpace> {
+    public:
+        using typename BufferHandler<MemorySpace>::archive_type;
+        using typename BufferHandler<MemorySpace>::buffer_type;
+        using typename BufferHandler<MemorySpace>::size_type;
+
+        //! Smallest size class, one page
+        static constexpr unsigned minClass   = 12;
+        static constexpr unsigned numClasses = 8 * sizeof(size_type) - minClass;
+
+        ~PooledBufferHandler() override = default;
+
+        /**
+         * @brief Acquires a buffer of at least the specified size.
+         *
+         * The size times the overallocation factor is rounded up to its size class. A free
+         * buffer of that class or the next larger one is returned if available; otherwise a new
+         * buffer of the class size is allocated.
+         *
+         * @param size The required buffer size.
+         * @param overallocation A multiplier to allocate additional buffer space.
+         * @return A shared pointer to the buffer.
+         */
+        buffer_type getBuffer(size_type size, double overallocation) override;
+
+        /**
+         * @copydoc BufferHandler::freeBuffer
+         */
+        void freeBuffer(buffer_type buffer) override;
+
+        /**
+         * @copydoc BufferHandler::freeAllBuffers
+         */
+        void freeAllBuffers() override;
+
+        /**
+         * @copydoc BufferHandler::deleteAllBuffers
+         */
+        void deleteAllBuffers() override;
+
+        /**
+         * @copydoc BufferHandler::getUsedSize
+         */
+        size_type getUsedSize() const override;
+
+        /**
+         * @copydoc BufferHandler::getFreeSize
+         */
+        size_type getFreeSize() const override;
+
+        /**
+         * @copydoc BufferHandler::getStatistics
+         */
+        BufferStatistics getStatistics() const override;
+
+        /**
+         * @brief Sets the factor by which free memory may exceed the high-water mark.
+         *
+         * @param factor Trim threshold relative to the high-water mark, 2 by default; zero
+         * disables trimming.
+         */
+        void setTrimFactor(double factor) { trimFactor_m = factor; }
+
+        /**
+         * @brief Releases free buffers beyond the high-water mark and restarts the mark from the
+         * size currently in use.
+         */
+        void trim();
+
+        /**
+         * @return The size class of a request, i.e. the base two logarithm of its buffer size.
+         */
+        static unsigned sizeClass(size_type size);
+
+    private:
+        using used_map_type = std::map<buffer_type, unsigned>;
+
+        void releaseUsedBuffer(typename used_map_type::iterator it);
+        void releaseFreeBuffers(size_type keep);
+        void maybeTrim();
+
+        size_type usedSize_m   = 0;    ///< Total size of all buffers in use
+        size_type freeSize_m   = 0;    ///< Total size of all free buffers
+        size_type windowMark_m = 0;    ///< Largest used size since the last trim()
+        double trimFactor_m    = 2.0;  ///< Trim threshold relative to windowMark_m
+        BufferStatistics stats_m;      ///< Allocation counters
+
+    protected:
+        used_map_type used_buffers;  ///< Buffers handed out and their size class
+        std::array<std::vector<buffer_type>, numClasses>
+            free_buffers;  ///< Free buffers, one list per size class
+    };
 }  // namespace ippl
 
 #include "Communicate/BufferHandler.hpp"
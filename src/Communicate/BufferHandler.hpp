@@ -2,6 +2,7 @@
 #define IPPL_BUFFER_HANDLER_HPP
 
 #include <algorithm>
+#include <bit>
 
 namespace ippl {
 
@@ -52,6 +53,8 @@ namespace ippl {
 
     template <typename MemorySpace>
     void DefaultBufferHandler<MemorySpace>::deleteAllBuffers() {
+        stats_m.releases += used_buffers.size() + free_buffers.size();
+
         freeSize_m = 0;
         usedSize_m = 0;
 
@@ -71,6 +74,11 @@ namespace ippl {
         return freeSize_m;
     }
 
+    template <typename MemorySpace>
+    BufferStatistics DefaultBufferHandler<MemorySpace>::getStatistics() const {
+        return stats_m;
+    }
+
     template <typename MemorySpace>
     bool DefaultBufferHandler<MemorySpace>::bufferSizeComparator(const buffer_type& lhs,
                                                                  const buffer_type& rhs) {
@@ -123,6 +131,9 @@ namespace ippl {
         freeSize_m -= buffer->getBufferSize();
         usedSize_m += buffer->getBufferSize();
 
+        ++stats_m.reuses;
+        stats_m.highWaterMark = std::max(stats_m.highWaterMark, usedSize_m);
+
         free_buffers.erase(buffer);
         used_buffers.insert(buffer);
         return buffer;
@@ -145,10 +156,144 @@ namespace ippl {
         buffer_type newBuffer = std::make_shared<archive_type>(requiredSize);
 
         usedSize_m += newBuffer->getBufferSize();
+
+        ++stats_m.allocations;
+        stats_m.highWaterMark = std::max(stats_m.highWaterMark, usedSize_m);
+
         used_buffers.insert(newBuffer);
         return newBuffer;
     }
 
+    template <typename MemorySpace>
+    unsigned PooledBufferHandler<MemorySpace>::sizeClass(size_type size) {
+        return std::max(minClass, static_cast<unsigned>(std::bit_width(size - (size > 0))));
+    }
+
+    template <typename MemorySpace>
+    typename PooledBufferHandler<MemorySpace>::buffer_type
+    PooledBufferHandler<MemorySpace>::getBuffer(size_type size, double overallocation) {
+        const unsigned sc = sizeClass(static_cast<size_type>(size * overallocation));
+
+        // A buffer of the next class wastes at most a factor of two but avoids an allocation
+        for (unsigned c = sc; c < std::min(sc + 2, minClass + numClasses); ++c) {
+            auto& list = free_buffers[c - minClass];
+            if (!list.empty()) {
+                buffer_type buffer = list.back();
+                list.pop_back();
+
+                freeSize_m -= buffer->getBufferSize();
+                usedSize_m += buffer->getBufferSize();
+                windowMark_m = std::max(windowMark_m, usedSize_m);
+
+                ++stats_m.reuses;
+                stats_m.highWaterMark = std::max(stats_m.highWaterMark, usedSize_m);
+
+                used_buffers.emplace(buffer, c);
+                return buffer;
+            }
+        }
+
+        // Archives may round the allocation up further (e.g. to the HIP IPC granularity); the
+        // buffer is nevertheless kept in the class it was requested for
+        buffer_type buffer = std::make_shared<archive_type>(size_type(1) << sc);
+
+        usedSize_m += buffer->getBufferSize();
+        windowMark_m = std::max(windowMark_m, usedSize_m);
+
+        ++stats_m.allocations;
+        stats_m.highWaterMark = std::max(stats_m.highWaterMark, usedSize_m);
+
+        used_buffers.emplace(buffer, sc);
+        return buffer;
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::freeBuffer(buffer_type buffer) {
+        auto it = used_buffers.find(buffer);
+        if (it != used_buffers.end()) {
+            releaseUsedBuffer(it);
+            maybeTrim();
+        }
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::freeAllBuffers() {
+        while (!used_buffers.empty()) {
+            releaseUsedBuffer(used_buffers.begin());
+        }
+        maybeTrim();
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::deleteAllBuffers() {
+        stats_m.releases += used_buffers.size();
+        used_buffers.clear();
+        for (auto& list : free_buffers) {
+            stats_m.releases += list.size();
+            list.clear();
+        }
+
+        usedSize_m   = 0;
+        freeSize_m   = 0;
+        windowMark_m = 0;
+    }
+
+    template <typename MemorySpace>
+    typename PooledBufferHandler<MemorySpace>::size_type
+    PooledBufferHandler<MemorySpace>::getUsedSize() const {
+        return usedSize_m;
+    }
+
+    template <typename MemorySpace>
+    typename PooledBufferHandler<MemorySpace>::size_type
+    PooledBufferHandler<MemorySpace>::getFreeSize() const {
+        return freeSize_m;
+    }
+
+    template <typename MemorySpace>
+    BufferStatistics PooledBufferHandler<MemorySpace>::getStatistics() const {
+        return stats_m;
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::trim() {
+        releaseFreeBuffers(windowMark_m);
+        windowMark_m = usedSize_m;
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::releaseUsedBuffer(
+        typename used_map_type::iterator it) {
+        auto [buffer, c] = *it;
+        used_buffers.erase(it);
+
+        usedSize_m -= buffer->getBufferSize();
+        freeSize_m += buffer->getBufferSize();
+
+        free_buffers[c - minClass].push_back(std::move(buffer));
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::releaseFreeBuffers(size_type keep) {
+        // Release the largest free buffers first, they are the most likely to be left over from
+        // an exceptional peak
+        for (unsigned c = numClasses; c-- > 0 && freeSize_m > keep;) {
+            auto& list = free_buffers[c];
+            while (!list.empty() && freeSize_m > keep) {
+                freeSize_m -= list.back()->getBufferSize();
+                list.pop_back();
+                ++stats_m.releases;
+            }
+        }
+    }
+
+    template <typename MemorySpace>
+    void PooledBufferHandler<MemorySpace>::maybeTrim() {
+        if (trimFactor_m > 0 && freeSize_m > trimFactor_m * windowMark_m) {
+            releaseFreeBuffers(windowMark_m);
+        }
+    }
+
 }  // namespace ippl
 
 #endif
\ No newline at end of file
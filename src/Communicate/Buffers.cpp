@@ -9,11 +9,9 @@
 //   in the case that the amount of data to be exchanged increases, when a new buffer
 //   is created, an amount of memory greater than the requested size is allocated
 //   for the new buffer. The factor by which memory is overallocated is determined by
-//   a data member in Communicator, which can be set and queried at runtime. Only new
-//   buffers are overallocated. If a buffer is requested with the same ID as a buffer
-//   that has been previously allocated, the same buffer will be used. If the requested
-//   size exceeds the buffer size, that buffer will be resized to have exactly
-//   the requested size.
+//   a data member in Communicator, which can be set and queried at runtime. Buffers
+//   are pooled per memory space in power-of-two size classes (PooledBufferHandler) and
+//   are never resized, so after warm-up requests are served without new allocations.
 //
 //   Currently, the buffer factory is used for application of periodic boundary
 //   conditions; halo cell exchange along faces, edges, and vertices; as well as
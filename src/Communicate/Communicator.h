@@ -9,6 +9,7 @@
 #include <mpi.h>
 
 #include "Communicate/BufferHandler.h"
+#include "Communicate/Compression.h"
 #include "Communicate/LoggingBufferHandler.h"
 #include "Communicate/Request.h"
 #include "Communicate/Status.h"
@@ -135,7 +136,7 @@ namespace ippl {
 
         private:
             template <typename MemorySpace>
-            using buffer_container_type = DefaultBufferHandler<MemorySpace>;
+            using buffer_container_type = PooledBufferHandler<MemorySpace>;
 
             using buffer_handler_type =
                 typename detail::ContainerForAllSpaces<buffer_container_type>::type;
@@ -205,6 +206,91 @@ namespace ippl {
                 MPI_Irecv(ar.getBuffer(), msize, MPI_BYTE, src, tag, *comm_m, &request);
             }
 
+            /*!
+             * Send the bytes written to an archive with the given compression (see
+             * Compression). The compressed message is kept in a host buffer of the pool until
+             * the buffers are freed.
+             */
+            template <typename Archive>
+            void isend(int dest, int tag, Archive& ar, MPI_Request& request,
+                       const Compression& compression);
+
+            /*!
+             * Send the msize bytes of an archive starting at byte offset, with the given
+             * compression. This posts one of several messages packed back to back into the
+             * same archive; the archive must not be modified before the request completes.
+             */
+            template <typename Archive>
+            void isend(int dest, int tag, Archive& ar, size_type offset, size_type msize,
+                       MPI_Request& request, const Compression& compression);
+
+            /*!
+             * Receive a message sent with compression into an archive. msize is the
+             * uncompressed size, i.e. the size a receive without compression would use.
+             */
+            template <typename Archive>
+            void recv(int src, int tag, Archive& ar, size_type msize,
+                      const Compression& compression);
+
+            /*!
+             * Post the receive of a message sent with compression. The returned message buffer
+             * has to be passed to decompress once the request has completed. Without
+             * compression the data is received into the archive directly and the returned
+             * buffer is empty.
+             */
+            template <typename Archive>
+            buffer_type<Kokkos::HostSpace> irecv(int src, int tag, Archive& ar,
+                                                 MPI_Request& request, size_type msize,
+                                                 const Compression& compression);
+
+            /*!
+             * Decode a message received by irecv with compression into the archive. Does
+             * nothing if the message buffer is empty.
+             */
+            template <typename Archive>
+            void decompress(const buffer_type<Kokkos::HostSpace>& message, Archive& ar);
+
+            /*!
+             * Nonblocking send of msize bytes straight from (device) memory, without staging
+             * the data in an archive. The memory must not be modified or freed before the
+             * request completes.
+             */
+            void isendBytes(int dest, int tag, const void* data, size_type msize,
+                            MPI_Request& request) {
+                assertMessageSize(msize);
+                MPI_Isend(data, msize, MPI_BYTE, dest, tag, *comm_m, &request);
+            }
+
+            /*!
+             * Nonblocking receive of msize bytes straight into (device) memory (see isendBytes).
+             */
+            void irecvBytes(int src, int tag, void* data, size_type msize, MPI_Request& request) {
+                assertMessageSize(msize);
+                MPI_Irecv(data, msize, MPI_BYTE, src, tag, *comm_m, &request);
+            }
+
+            /*!
+             * Create a persistent send request for the first msize bytes of an archive.
+             * The request is started with MPI_Start and must be released with
+             * MPI_Request_free.
+             */
+            template <typename Archive>
+            void send_init(int dest, int tag, Archive& ar, MPI_Request& request,
+                           size_type msize) {
+                assertMessageSize(msize);
+                MPI_Send_init(ar.getBuffer(), msize, MPI_BYTE, dest, tag, *comm_m, &request);
+            }
+
+            /*!
+             * Create a persistent receive request into an archive (see send_init).
+             */
+            template <typename Archive>
+            void recv_init(int src, int tag, Archive& ar, MPI_Request& request,
+                           size_type msize) {
+                assertMessageSize(msize);
+                MPI_Recv_init(ar.getBuffer(), msize, MPI_BYTE, src, tag, *comm_m, &request);
+            }
+
             void printLogs(const std::string& filename);
 
         private:
@@ -218,6 +304,16 @@ namespace ippl {
                 return handler;
             }
 
+            //! Encodes rawSize bytes of an archive from byte offset on, staging device data
+            //! through the host
+            template <typename Archive>
+            size_type encode(Archive& ar, size_type offset, size_type rawSize, char* message,
+                             const Compression& compression);
+
+            //! Decodes a message into an archive, staging device data through the host
+            template <typename Archive>
+            void decode(const char* message, size_type messageSize, Archive& ar);
+
             double defaultOveralloc_m = 1.0;
 
             /////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,297 @@
+//
+// Struct Compression
+//   Host implementation of the message compression stages.
+//
+#include "Communicate/Compression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "Utility/IpplException.h"
+
+namespace ippl::mpi::compression {
+
+    namespace {
+        using byte_type = unsigned char;
+
+        // The block format follows LZ4: every sequence starts with a token holding the number
+        // of literals in the upper and the match length minus minMatch in the lower four bits.
+        // A nibble of 15 is continued by bytes of 255 and a final byte below 255. The literals
+        // follow, then the little endian 16-bit offset of the match. The last sequence consists
+        // of literals only.
+        constexpr size_type minMatch  = 4;
+        constexpr size_type maxOffset = 65535;
+        constexpr unsigned hashBits   = 14;
+        constexpr size_type npos      = ~size_type(0);
+
+        std::uint32_t read32(const byte_type* p) {
+            std::uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        std::uint32_t hash(std::uint32_t value) {
+            return (value * 2654435761u) >> (32 - hashBits);
+        }
+
+        // Number of continuation bytes of a length with a nibble of 15
+        size_type lengthBytes(size_type length) {
+            return length >= 15 ? (length - 15) / 255 + 1 : 0;
+        }
+
+        void writeLength(size_type length, byte_type*& op) {
+            for (length -= 15; length >= 255; length -= 255) {
+                *op++ = 255;
+            }
+            *op++ = static_cast<byte_type>(length);
+        }
+
+        size_type readLength(const byte_type*& ip, const byte_type* end) {
+            size_type length = 0;
+            byte_type b;
+            do {
+                if (ip == end) {
+                    throw IpplException("compression::lzDecompress", "Truncated length.");
+                }
+                b = *ip++;
+                length += b;
+            } while (b == 255);
+            return length;
+        }
+
+        /*
+         * Appends a sequence of literals followed by a match; matchLength is zero for the last
+         * sequence. Returns false if the output does not fit.
+         */
+        bool writeSequence(const byte_type* literals, size_type numLiterals, size_type offset,
+                           size_type matchLength, byte_type*& op, const byte_type* end) {
+            const bool hasMatch = matchLength > 0;
+            const size_type matchCode = hasMatch ? matchLength - minMatch : 0;
+            const size_type required  = 1 + lengthBytes(numLiterals) + numLiterals
+                                       + (hasMatch ? 2 + lengthBytes(matchCode) : 0);
+            if (static_cast<size_type>(end - op) < required) {
+                return false;
+            }
+
+            *op++ = static_cast<byte_type>((std::min<size_type>(numLiterals, 15) << 4)
+                                           | std::min<size_type>(matchCode, 15));
+            if (numLiterals >= 15) {
+                writeLength(numLiterals, op);
+            }
+            std::memcpy(op, literals, numLiterals);
+            op += numLiterals;
+
+            if (hasMatch) {
+                *op++ = static_cast<byte_type>(offset & 0xff);
+                *op++ = static_cast<byte_type>(offset >> 8);
+                if (matchCode >= 15) {
+                    writeLength(matchCode, op);
+                }
+            }
+            return true;
+        }
+    }  // namespace
+
+    size_type maxMessageSize(size_type rawSize) { return sizeof(Header) + rawSize; }
+
+    void shuffle(const char* src, size_type n, unsigned wordSize, char* dst) {
+        wordSize              = std::max(wordSize, 1u);
+        const size_type words = n / wordSize;
+        for (size_type w = 0; w < words; ++w) {
+            for (unsigned b = 0; b < wordSize; ++b) {
+                dst[b * words + w] = src[w * wordSize + b];
+            }
+        }
+        std::memcpy(dst + words * wordSize, src + words * wordSize, n - words * wordSize);
+    }
+
+    void unshuffle(const char* src, size_type n, unsigned wordSize, char* dst) {
+        wordSize              = std::max(wordSize, 1u);
+        const size_type words = n / wordSize;
+        for (size_type w = 0; w < words; ++w) {
+            for (unsigned b = 0; b < wordSize; ++b) {
+                dst[w * wordSize + b] = src[b * words + w];
+            }
+        }
+        std::memcpy(dst + words * wordSize, src + words * wordSize, n - words * wordSize);
+    }
+
+    size_type lzCompress(const char* source, size_type n, char* dest, size_type capacity) {
+        const auto* src = reinterpret_cast<const byte_type*>(source);
+        auto* op        = reinterpret_cast<byte_type*>(dest);
+        const auto* end = op + capacity;
+
+        std::vector<size_type> table(size_type(1) << hashBits, npos);
+
+        size_type anchor = 0;
+        size_type i      = 0;
+        while (i + minMatch <= n) {
+            const std::uint32_t word = read32(src + i);
+            const std::uint32_t h    = hash(word);
+            const size_type cand     = table[h];
+            table[h]                 = i;
+
+            if (cand == npos || i - cand > maxOffset || read32(src + cand) != word) {
+                // Incompressible data is skipped with a growing stride
+                i += 1 + ((i - anchor) >> 6);
+                continue;
+            }
+
+            size_type length = minMatch;
+            while (i + length < n && src[cand + length] == src[i + length]) {
+                ++length;
+            }
+            if (!writeSequence(src + anchor, i - anchor, i - cand, length, op, end)) {
+                return 0;
+            }
+            i += length;
+            anchor = i;
+        }
+
+        if (!writeSequence(src + anchor, n - anchor, 0, 0, op, end)) {
+            return 0;
+        }
+        return op - reinterpret_cast<byte_type*>(dest);
+    }
+
+    size_type lzDecompress(const char* source, size_type n, char* dest, size_type capacity) {
+        const auto* ip   = reinterpret_cast<const byte_type*>(source);
+        const auto* iend = ip + n;
+        auto* const out  = reinterpret_cast<byte_type*>(dest);
+        auto* op         = out;
+        const auto* oend = out + capacity;
+
+        while (ip < iend) {
+            const byte_type token = *ip++;
+
+            size_type numLiterals = token >> 4;
+            if (numLiterals == 15) {
+                numLiterals += readLength(ip, iend);
+            }
+            if (numLiterals > static_cast<size_type>(iend - ip)
+                || numLiterals > static_cast<size_type>(oend - op)) {
+                throw IpplException("compression::lzDecompress", "Literals out of bounds.");
+            }
+            std::memcpy(op, ip, numLiterals);
+            ip += numLiterals;
+            op += numLiterals;
+
+            if (ip == iend) {
+                break;
+            }
+            if (iend - ip < 2) {
+                throw IpplException("compression::lzDecompress", "Truncated match offset.");
+            }
+            const size_type offset = ip[0] | (size_type(ip[1]) << 8);
+            ip += 2;
+
+            size_type length = (token & 15) + minMatch;
+            if ((token & 15) == 15) {
+                length += readLength(ip, iend);
+            }
+            if (offset == 0 || offset > static_cast<size_type>(op - out)
+                || length > static_cast<size_type>(oend - op)) {
+                throw IpplException("compression::lzDecompress", "Match out of bounds.");
+            }
+            // The match may overlap the output, so it is copied bytewise
+            const byte_type* match = op - offset;
+            for (size_type k = 0; k < length; ++k) {
+                op[k] = match[k];
+            }
+            op += length;
+        }
+        return op - out;
+    }
+
+    size_type encode(const char* raw, size_type rawSize, char* message,
+                     const Compression& compression) {
+        Header header{0, std::max(compression.wordSize, 1u), rawSize, 0};
+        char* payload = message + sizeof(Header);
+
+        const char* data   = raw;
+        size_type dataSize = rawSize;
+
+        std::vector<char> truncated;
+        if (compression.truncate) {
+            if (rawSize % sizeof(double) != 0) {
+                throw IpplException("compression::encode",
+                                    "Truncation requires a message of doubles.");
+            }
+            truncated.resize(rawSize / 2);
+            for (size_type k = 0; k < rawSize / sizeof(double); ++k) {
+                double value;
+                std::memcpy(&value, raw + k * sizeof(double), sizeof(double));
+                const float rounded = static_cast<float>(value);
+                std::memcpy(truncated.data() + k * sizeof(float), &rounded, sizeof(float));
+            }
+            data     = truncated.data();
+            dataSize = truncated.size();
+            header.flags |= TRUNCATED;
+            header.wordSize = sizeof(float);
+        }
+
+        if (compression.lossless && dataSize > 0) {
+            std::vector<char> shuffled(dataSize);
+            shuffle(data, dataSize, header.wordSize, shuffled.data());
+            // Only worth it if the result is smaller than the data
+            header.payloadSize = lzCompress(shuffled.data(), dataSize, payload, dataSize - 1);
+            if (header.payloadSize > 0) {
+                header.flags |= LZ;
+            }
+        }
+
+        if ((header.flags & LZ) == 0 && dataSize > 0) {
+            std::memcpy(payload, data, dataSize);
+            header.payloadSize = dataSize;
+        }
+
+        std::memcpy(message, &header, sizeof(Header));
+        return sizeof(Header) + header.payloadSize;
+    }
+
+    size_type decode(const char* message, size_type messageSize, char* raw, size_type capacity) {
+        Header header;
+        if (messageSize < sizeof(Header)) {
+            throw IpplException("compression::decode", "Message shorter than its header.");
+        }
+        std::memcpy(&header, message, sizeof(Header));
+        if (header.payloadSize > messageSize - sizeof(Header)) {
+            throw IpplException("compression::decode", "Truncated message.");
+        }
+        if (header.rawSize > capacity) {
+            throw IpplException("compression::decode", "Output buffer too small.");
+        }
+
+        const bool truncated     = (header.flags & TRUNCATED) != 0;
+        const char* payload      = message + sizeof(Header);
+        const size_type dataSize = truncated ? header.rawSize / 2 : header.rawSize;
+
+        const char* data = payload;
+        std::vector<char> unshuffled;
+        if (header.flags & LZ) {
+            std::vector<char> shuffled(dataSize);
+            if (lzDecompress(payload, header.payloadSize, shuffled.data(), dataSize)
+                != dataSize) {
+                throw IpplException("compression::decode", "Unexpected decompressed size.");
+            }
+            unshuffled.resize(dataSize);
+            unshuffle(shuffled.data(), dataSize, header.wordSize, unshuffled.data());
+            data = unshuffled.data();
+        } else if (header.payloadSize != dataSize) {
+            throw IpplException("compression::decode", "Unexpected payload size.");
+        }
+
+        if (truncated) {
+            for (size_type k = 0; k < dataSize / sizeof(float); ++k) {
+                float value;
+                std::memcpy(&value, data + k * sizeof(float), sizeof(float));
+                const double expanded = value;
+                std::memcpy(raw + k * sizeof(double), &expanded, sizeof(double));
+            }
+        } else if (dataSize > 0) {
+            std::memcpy(raw, data, dataSize);
+        }
+        return header.rawSize;
+    }
+}  // namespace ippl::mpi::compression
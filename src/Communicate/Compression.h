@@ -0,0 +1,124 @@
+//
+// Struct Compression
+//   Optional compression stage for archive messages, selected per call site. Two stages are
+//   available and may be combined:
+//
+//     - lossless: the bytes of the words are shuffled such that the k-th bytes of all words
+//       are adjacent, followed by an LZ77 coder with an LZ4-style block format. Particle data
+//       after spatial sorting (positions, IDs) share their high bytes and compress well.
+//     - truncate: 8-byte floating point words are rounded to single precision. This is lossy
+//       and only valid for messages that consist of doubles, e.g. the accumulation of a
+//       charge density.
+//
+//   Compressed messages start with a header recording the applied stages. The receiver
+//   therefore only needs to know that the sender compresses, not how. If the lossless stage
+//   does not reduce the size, the data is sent as it is. Encoding runs on the host; archives
+//   in device memory are staged through host memory.
+//
+//   Experimental: the codec has only been measured on its own. The ParticleSendRecv unit
+//   tests check compressed particle exchanges for correctness, and benchmarkParticleUpdate
+//   takes the argument lossless to time them, but whether the smaller messages make up for
+//   the encoding time and the host staging has not been measured yet. Compression therefore
+//   stays disabled unless a call site enables it explicitly.
+//
+#ifndef IPPL_MPI_COMPRESSION_H
+#define IPPL_MPI_COMPRESSION_H
+
+#include <cstdint>
+
+#include "Types/IpplTypes.h"
+
+namespace ippl {
+    namespace mpi {
+        struct Compression {
+            //! Byte shuffle and LZ coding
+            bool lossless = false;
+            //! Rounding of doubles to single precision (lossy)
+            bool truncate = false;
+            //! Word size of the byte shuffle, ideally the size of the dominant scalar type
+            unsigned wordSize = sizeof(double);
+
+            static Compression none() { return {}; }
+
+            static Compression losslessFor(unsigned wordSize = sizeof(double)) {
+                return {true, false, wordSize};
+            }
+
+            /*!
+             * @param lossless whether to compress the single precision words further
+             */
+            static Compression truncated(bool lossless = false) {
+                return {lossless, true, sizeof(float)};
+            }
+
+            explicit operator bool() const { return lossless || truncate; }
+        };
+
+        namespace compression {
+            using size_type = ippl::detail::size_type;
+
+            //! Header in front of every compressed message
+            struct Header {
+                std::uint32_t flags;
+                std::uint32_t wordSize;
+                std::uint64_t rawSize;
+                std::uint64_t payloadSize;
+            };
+
+            enum Flags : std::uint32_t {
+                LZ        = 1,
+                TRUNCATED = 2
+            };
+
+            //! Size of the largest message encode can produce from rawSize bytes
+            size_type maxMessageSize(size_type rawSize);
+
+            /*!
+             * Encodes data into a message of at most maxMessageSize(rawSize) bytes
+             * @param raw the data to encode
+             * @param rawSize number of bytes of data
+             * @param message the output
+             * @param compression the stages to apply
+             * @returns the size of the message in bytes
+             */
+            size_type encode(const char* raw, size_type rawSize, char* message,
+                             const Compression& compression);
+
+            /*!
+             * Decodes a message produced by encode
+             * @param message the received message
+             * @param messageSize number of bytes received
+             * @param raw the output
+             * @param capacity size of the output in bytes
+             * @returns the number of decoded bytes
+             * @throw IpplException if the message is malformed or the output too small
+             */
+            size_type decode(const char* message, size_type messageSize, char* raw,
+                             size_type capacity);
+
+            /*!
+             * Transposes n bytes of words of wordSize bytes such that the k-th bytes of all
+             * words are contiguous. Trailing bytes that do not form a whole word are copied.
+             */
+            void shuffle(const char* src, size_type n, unsigned wordSize, char* dst);
+
+            //! Inverse of shuffle
+            void unshuffle(const char* src, size_type n, unsigned wordSize, char* dst);
+
+            /*!
+             * LZ77 compression of n bytes
+             * @returns the compressed size, or 0 if it would exceed capacity
+             */
+            size_type lzCompress(const char* src, size_type n, char* dst, size_type capacity);
+
+            /*!
+             * Decompresses n bytes produced by lzCompress
+             * @returns the decompressed size
+             * @throw IpplException if the input is malformed or the output too small
+             */
+            size_type lzDecompress(const char* src, size_type n, char* dst, size_type capacity);
+        }  // namespace compression
+    }  // namespace mpi
+}  // namespace ippl
+
+#endif
@@ -50,7 +50,8 @@ namespace ippl {
          * @brief Allocates or retrieves a buffer and logs the action.
          *
          * Overrides `BufferHandler::getBuffer`, providing the same buffer allocation behavior
-         * while recording an entry in the log with the operation details.
+         * while recording an entry in the log with the operation details and the allocation
+         * counters of the wrapped handler.
          *
          * @param size Requested size of the buffer.
          * @param overallocation Optional multiplier to allocate extra buffer space.
@@ -96,6 +97,12 @@ namespace ippl {
          */
         size_type getFreeSize() const override;
 
+        /**
+         * @brief Retrieves the allocation counters of the wrapped handler.
+         * @return The allocation statistics.
+         */
+        BufferStatistics getStatistics() const override;
+
         /**
          * @brief Retrieves the list of log entries.
          * @return A constant reference to a vector containing log entries.
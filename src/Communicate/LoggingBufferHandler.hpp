@@ -14,16 +14,20 @@ namespace ippl {
 
     template <typename MemorySpace>
     LoggingBufferHandler<MemorySpace>::LoggingBufferHandler() {
-        handler_m = std::make_shared<DefaultBufferHandler<MemorySpace>>();
+        handler_m = std::make_shared<PooledBufferHandler<MemorySpace>>();
         MPI_Comm_rank(MPI_COMM_WORLD, &rank_m);
     }
 
     template <typename MemorySpace>
     typename LoggingBufferHandler<MemorySpace>::buffer_type
     LoggingBufferHandler<MemorySpace>::getBuffer(size_type size, double overallocation) {
-        auto buffer = handler_m->getBuffer(size, overallocation);
+        auto buffer      = handler_m->getBuffer(size, overallocation);
+        const auto stats = handler_m->getStatistics();
         logMethod("getBuffer", {{"size", std::to_string(size)},
-                                {"overallocation", std::to_string(overallocation)}});
+                                {"overallocation", std::to_string(overallocation)},
+                                {"allocations", std::to_string(stats.allocations)},
+                                {"reuses", std::to_string(stats.reuses)},
+                                {"highWaterMark", std::to_string(stats.highWaterMark)}});
         return buffer;
     }
 
@@ -57,6 +61,11 @@ namespace ippl {
         return handler_m->getFreeSize();
     }
 
+    template <typename MemorySpace>
+    BufferStatistics LoggingBufferHandler<MemorySpace>::getStatistics() const {
+        return handler_m->getStatistics();
+    }
+
     template <typename MemorySpace>
     const std::vector<LogEntry>& LoggingBufferHandler<MemorySpace>::getLogs() const {
         return logEntries_m;
@@ -57,5 +57,115 @@ namespace ippl {
             MPI_Irecv(buffer, count, type, source, tag, *comm_m, request);
         }
 
+        /*
+         * Compressed archive messages
+         */
+
+        template <typename Archive>
+        void Communicator::isend(int dest, int tag, Archive& ar, MPI_Request& request,
+                                 const Compression& compression) {
+            if (!compression) {
+                this->isend(dest, tag, ar, request);
+                return;
+            }
+            auto message = getBuffer<Kokkos::HostSpace>(compression::maxMessageSize(ar.getSize()));
+            const size_type msize = encode(ar, 0, ar.getSize(), message->getBuffer(), compression);
+            isendBytes(dest, tag, message->getBuffer(), msize, request);
+        }
+
+        template <typename Archive>
+        void Communicator::isend(int dest, int tag, Archive& ar, size_type offset,
+                                 size_type msize, MPI_Request& request,
+                                 const Compression& compression) {
+            if (!compression) {
+                isendBytes(dest, tag, ar.getBuffer() + offset, msize, request);
+                return;
+            }
+            auto message = getBuffer<Kokkos::HostSpace>(compression::maxMessageSize(msize));
+            const size_type size = encode(ar, offset, msize, message->getBuffer(), compression);
+            isendBytes(dest, tag, message->getBuffer(), size, request);
+        }
+
+        template <typename Archive>
+        void Communicator::recv(int src, int tag, Archive& ar, size_type msize,
+                                const Compression& compression) {
+            if (!compression) {
+                this->recv(src, tag, ar, msize);
+                return;
+            }
+            const size_type maxSize = compression::maxMessageSize(msize);
+            assertMessageSize(maxSize);
+
+            auto message = getBuffer<Kokkos::HostSpace>(maxSize);
+            MPI_Status status;
+            MPI_Recv(message->getBuffer(), maxSize, MPI_BYTE, src, tag, *comm_m, &status);
+            int count;
+            MPI_Get_count(&status, MPI_BYTE, &count);
+
+            decode(message->getBuffer(), count, ar);
+            freeBuffer<Kokkos::HostSpace>(message);
+        }
+
+        template <typename Archive>
+        Communicator::buffer_type<Kokkos::HostSpace> Communicator::irecv(
+            int src, int tag, Archive& ar, MPI_Request& request, size_type msize,
+            const Compression& compression) {
+            if (!compression) {
+                this->irecv(src, tag, ar, request, msize);
+                return nullptr;
+            }
+            const size_type maxSize = compression::maxMessageSize(msize);
+            auto message            = getBuffer<Kokkos::HostSpace>(maxSize);
+            irecvBytes(src, tag, message->getBuffer(), maxSize, request);
+            return message;
+        }
+
+        template <typename Archive>
+        void Communicator::decompress(const buffer_type<Kokkos::HostSpace>& message,
+                                      Archive& ar) {
+            if (!message) {
+                return;
+            }
+            // The header records the actual size of the message
+            decode(message->getBuffer(), message->getBufferSize(), ar);
+            freeBuffer<Kokkos::HostSpace>(message);
+        }
+
+        template <typename Archive>
+        Communicator::size_type Communicator::encode(Archive& ar, size_type offset,
+                                                     size_type rawSize, char* message,
+                                                     const Compression& compression) {
+            using memory_space = typename Archive::memory_space;
+            if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                                     memory_space>::accessible) {
+                return compression::encode(ar.getBuffer() + offset, rawSize, message,
+                                           compression);
+            } else {
+                using unmanaged = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+                Kokkos::View<char*, memory_space, unmanaged> data(ar.getBuffer() + offset,
+                                                                  rawSize);
+                auto raw = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+                return compression::encode(raw.data(), rawSize, message, compression);
+            }
+        }
+
+        template <typename Archive>
+        void Communicator::decode(const char* message, size_type messageSize, Archive& ar) {
+            using memory_space       = typename Archive::memory_space;
+            const size_type capacity = ar.getBufferSize();
+            if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                                     memory_space>::accessible) {
+                compression::decode(message, messageSize, ar.getBuffer(), capacity);
+            } else {
+                using unmanaged = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+                Kokkos::View<char*, memory_space, unmanaged> data(ar.getBuffer(), capacity);
+                auto raw = Kokkos::create_mirror_view(Kokkos::HostSpace(), data);
+                const size_type rawSize =
+                    compression::decode(message, messageSize, raw.data(), capacity);
+                Kokkos::deep_copy(Kokkos::subview(data, std::make_pair(size_type(0), rawSize)),
+                                  Kokkos::subview(raw, std::make_pair(size_type(0), rawSize)));
+            }
+        }
+
     }  // namespace mpi
 }  // namespace ippl
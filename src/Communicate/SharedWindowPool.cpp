@@ -0,0 +1,113 @@
+//
+// Class SharedWindowPool
+//   Shared-memory windows of the ranks of a communicator that reside on the same node.
+//
+#include "Communicate/SharedWindowPool.h"
+
+namespace ippl {
+    namespace mpi {
+        namespace rma {
+
+            namespace {
+                //! Pools with a node communicator, in the order in which it was created
+                std::vector<std::weak_ptr<SharedWindowPool>>& activePools() {
+                    static std::vector<std::weak_ptr<SharedWindowPool>> pools;
+                    return pools;
+                }
+            }  // namespace
+
+            SharedWindowPool::SharedWindowPool(MPI_Comm comm)
+                : comm_m(comm) {}
+
+            SharedWindowPool::~SharedWindowPool() {
+                int finalized = 0;
+                MPI_Finalized(&finalized);
+                if (!finalized) {
+                    free();
+                    return;
+                }
+                // MPI has already released the windows
+                for (auto& entry : windows_m) {
+                    entry.window.release();
+                }
+            }
+
+            MPI_Comm SharedWindowPool::getNodeComm() {
+                if (nodeComm_m == MPI_COMM_NULL) {
+                    int rank;
+                    MPI_Comm_rank(comm_m, &rank);
+                    MPI_Comm_split_type(comm_m, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
+                                        &nodeComm_m);
+                    auto& pools = activePools();
+                    std::erase_if(pools, [](const auto& pool) { return pool.expired(); });
+                    pools.push_back(weak_from_this());
+                }
+                return nodeComm_m;
+            }
+
+            std::pair<int, char*> SharedWindowPool::acquire(MPI_Aint nbytes) {
+                MPI_Comm nodeComm = getNodeComm();
+                collect();
+
+                Entry entry;
+                entry.window  = std::make_unique<window_type>();
+                char* segment = entry.window->allocateShared<char>(nodeComm, nbytes);
+                entry.window->lockall(MPI_MODE_NOCHECK);
+
+                windows_m.push_back(std::move(entry));
+                return {static_cast<int>(windows_m.size()) - 1, segment};
+            }
+
+            void SharedWindowPool::release(int id) {
+                windows_m[id].released = true;
+            }
+
+            void SharedWindowPool::collect() {
+                const int count = windows_m.size();
+                if (count == 0) {
+                    return;
+                }
+
+                // Every rank holds the same windows, so all agree on which ones to free
+                std::vector<int> released(count);
+                for (int k = 0; k < count; ++k) {
+                    released[k] = windows_m[k].released;
+                }
+                MPI_Allreduce(MPI_IN_PLACE, released.data(), count, MPI_INT, MPI_LAND,
+                              nodeComm_m);
+
+                for (int k = 0; k < count; ++k) {
+                    if (released[k] && windows_m[k].window) {
+                        windows_m[k].window->unlockall();
+                        windows_m[k].window.reset();
+                    }
+                }
+            }
+
+            void SharedWindowPool::free() {
+                if (nodeComm_m == MPI_COMM_NULL) {
+                    return;
+                }
+                for (auto& entry : windows_m) {
+                    if (entry.window) {
+                        entry.window->unlockall();
+                        entry.window.reset();
+                    }
+                    entry.released = true;
+                }
+                MPI_Comm_free(&nodeComm_m);
+            }
+
+            void finalizeSharedWindowPools() {
+                auto& pools = activePools();
+                for (auto& weak : pools) {
+                    if (auto pool = weak.lock()) {
+                        pool->free();
+                    }
+                }
+                pools.clear();
+            }
+
+        }  // namespace rma
+    }  // namespace mpi
+}  // namespace ippl
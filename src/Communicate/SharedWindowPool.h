@@ -0,0 +1,103 @@
+//
+// Class SharedWindowPool
+//   Shared-memory windows of the ranks of a communicator that reside on the same node.
+//
+//   Windows are allocated collectively, but every rank releases a window on its own, e.g.
+//   when the object using it is destroyed. Freeing an MPI window is collective, so a window
+//   is only freed at the next call of acquire() or free() after all ranks of the node have
+//   released it. The order in which the users of the windows are destroyed may hence differ
+//   between the ranks. Destroying the pool frees all windows and is collective.
+//
+#ifndef IPPL_MPI_SHARED_WINDOW_POOL_H
+#define IPPL_MPI_SHARED_WINDOW_POOL_H
+
+#include <memory>
+#include <mpi.h>
+#include <vector>
+
+#include "Communicate/Communicator.h"
+#include "Communicate/Window.h"
+
+namespace ippl {
+    namespace mpi {
+        namespace rma {
+
+            class SharedWindowPool : public std::enable_shared_from_this<SharedWindowPool> {
+            public:
+                using window_type = Window<Passive>;
+
+                /*!
+                 * @param comm the communicator whose ranks on the same node share the windows;
+                 * nothing is allocated until the first collective call
+                 */
+                explicit SharedWindowPool(MPI_Comm comm);
+
+                SharedWindowPool(const SharedWindowPool&)            = delete;
+                SharedWindowPool& operator=(const SharedWindowPool&) = delete;
+
+                /*!
+                 * Frees all windows and the node communicator (see free). Collective unless MPI
+                 * has already been finalized.
+                 */
+                ~SharedWindowPool();
+
+                /*!
+                 * The ranks of the communicator on this node (MPI_COMM_TYPE_SHARED). Collective
+                 * on the communicator on the first call, which must be made by all ranks in
+                 * the same order as for the other pools.
+                 */
+                MPI_Comm getNodeComm();
+
+                /*!
+                 * Allocate a shared window and lock it for passive target access. The windows
+                 * that all ranks of the node have released are freed first. Collective on the
+                 * node communicator.
+                 * @param nbytes size of the local segment
+                 * @returns the id of the window and the local segment
+                 */
+                std::pair<int, char*> acquire(MPI_Aint nbytes);
+
+                /*!
+                 * @param id a window returned by acquire and not yet released
+                 */
+                window_type& getWindow(int id) { return *windows_m[id].window; }
+
+                /*!
+                 * Mark a window as no longer used by this rank. Not collective.
+                 * @param id a window returned by acquire
+                 */
+                void release(int id);
+
+                /*!
+                 * Free all windows and the node communicator, including the windows that are
+                 * still in use. Collective on the communicator.
+                 */
+                void free();
+
+            private:
+                struct Entry {
+                    std::unique_ptr<window_type> window;
+                    bool released = false;
+                };
+
+                //! Free the windows released by all ranks of the node. Collective.
+                void collect();
+
+                MPI_Comm comm_m;
+                MPI_Comm nodeComm_m = MPI_COMM_NULL;
+
+                //! All windows acquired so far, in the same order on every rank
+                std::vector<Entry> windows_m;
+            };
+
+            /*!
+             * Free the windows of all pools that are still alive and whose node communicator
+             * has been created, in the order of creation. Collective; called by ippl::finalize.
+             */
+            void finalizeSharedWindowPools();
+
+        }  // namespace rma
+    }  // namespace mpi
+}  // namespace ippl
+
+#endif
@@ -18,6 +18,9 @@ namespace ippl {
                 HALO_SEND = 15000,
                 HALO_RECV = 20000,
 
+                // Fused halo exchange of several fields (see Field/HaloGroup.h)
+                HALO_GROUP = 6000,
+
                 // Special tags used by Particle classes for communication.
                 P_SPATIAL_LAYOUT = 10000,
                 P_LAYOUT_CYCLE   = 5000,
@@ -53,6 +53,29 @@ namespace ippl {
                 template <std::contiguous_iterator Iter>
                 bool detach(Iter first);
 
+                /*!
+                 * Allocates a window in memory that is shared by all ranks of the communicator,
+                 * which must reside on one node (see MPI_COMM_TYPE_SHARED). Collective.
+                 * @param comm the node communicator
+                 * @param count number of elements of the local segment
+                 * @returns the local segment, or nullptr if the window is already allocated
+                 */
+                template <typename T>
+                T* allocateShared(const Communicator& comm, MPI_Aint count);
+
+                /*!
+                 * @param rank a rank of the node communicator of a shared window
+                 * @returns the segment of that rank, which can be accessed directly
+                 */
+                template <typename T>
+                T* sharedQuery(int rank) const;
+
+                /*!
+                 * Synchronizes the public and private copies of the window. With a node-local
+                 * barrier, this orders direct accesses to a shared window.
+                 */
+                void sync();
+
                 void fence(int asrt = 0);
 
                 template <std::contiguous_iterator Iter>
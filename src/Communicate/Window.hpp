@@ -67,6 +67,36 @@ namespace ippl {
                 return true;
             }
 
+            template <TargetComm Target>
+            template <typename T>
+            T* Window<Target>::allocateShared(const Communicator& comm, MPI_Aint count) {
+                if (allocated_m) {
+                    return nullptr;
+                }
+                allocated_m = true;
+
+                count_m = count;
+                T* base = nullptr;
+                MPI_Win_allocate_shared(count * sizeof(T), sizeof(T), MPI_INFO_NULL, comm, &base,
+                                        &win_m);
+                return base;
+            }
+
+            template <TargetComm Target>
+            template <typename T>
+            T* Window<Target>::sharedQuery(int rank) const {
+                MPI_Aint size;
+                int dispUnit;
+                T* base = nullptr;
+                MPI_Win_shared_query(win_m, rank, &size, &dispUnit, &base);
+                return base;
+            }
+
+            template <TargetComm Target>
+            void Window<Target>::sync() {
+                MPI_Win_sync(win_m);
+            }
+
             template <TargetComm Target>
             void Window<Target>::fence(int asrt) {
                 static_assert(isActiveTarget<Target>::value,
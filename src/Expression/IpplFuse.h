@@ -0,0 +1,147 @@
+//
+// File IpplFuse.h
+//   Fusion of several expression assignments into a single kernel.
+//
+#ifndef IPPL_FUSE_H
+#define IPPL_FUSE_H
+
+#include <Kokkos_Core.hpp>
+
+#include "Expression/IpplExpressions.h"
+#include "Utility/IpplException.h"
+#include "Utility/ParallelDispatch.h"
+
+namespace ippl {
+    namespace detail {
+        /*!
+         * True if the left-hand side is a field, i.e. assignments iterate over its
+         * owned cells. Otherwise it is a particle attribute and assignments iterate
+         * over the local particles.
+         */
+        template <typename Lhs>
+        constexpr bool isFieldAssignment = requires(const Lhs& lhs) { lhs.getFieldRangePolicy(); };
+
+        /*!
+         * An assignment lhs = expr that is not executed immediately, but
+         * collected by ippl::fuse.
+         * @tparam Lhs BareField, Field or ParticleAttrib type
+         * @tparam E expression type
+         */
+        template <typename Lhs, typename E>
+        struct DeferredAssignment {
+            using lhs_type    = Lhs;
+            using kernel_type = FusedAssignment<typename Lhs::view_type, E>;
+
+            Lhs& lhs_m;
+            E expr_m;
+
+            kernel_type kernel() const { return kernel_type{lhs_m.getView(), expr_m}; }
+
+            //! Particle attributes track modifications (see ParticleAttrib::getVersion)
+            void markModified() const {
+                if constexpr (!isFieldAssignment<Lhs>) {
+                    lhs_m.markModified();
+                }
+            }
+
+            auto policy() const {
+                if constexpr (isFieldAssignment<Lhs>) {
+                    return lhs_m.getFieldRangePolicy();
+                } else {
+                    using exec_space = typename Lhs::execution_space;
+                    return Kokkos::RangePolicy<exec_space>(0, lhs_m.getParticleCount());
+                }
+            }
+
+            /*!
+             * @returns true if both assignments iterate over the same index space
+             */
+            template <typename Other>
+            bool sameIndexSpace(const Other& other) const {
+                if constexpr (isFieldAssignment<Lhs>) {
+                    return lhs_m.getNghost() == other.lhs_m.getNghost()
+                           && lhs_m.getOwned() == other.lhs_m.getOwned();
+                } else {
+                    // attributes of the same bunch share the tombstone mask
+                    return lhs_m.getParticleCount() == other.lhs_m.getParticleCount()
+                           && lhs_m.getValidMask().data() == other.lhs_m.getValidMask().data();
+                }
+            }
+        };
+
+        template <typename A>
+        FusedAssignments<typename A::kernel_type> makeFusedKernel(const A& a) {
+            return {a.kernel()};
+        }
+
+        template <typename A, typename... Rest>
+        FusedAssignments<typename A::kernel_type, typename Rest::kernel_type...> makeFusedKernel(
+            const A& a, const Rest&... rest) {
+            return {a.kernel(), makeFusedKernel(rest...)};
+        }
+    }  // namespace detail
+
+    /*!
+     * Create an assignment lhs = expr to be executed by ippl::fuse.
+     * @param lhs the field or particle attribute to assign to
+     * @param expr the right-hand side expression
+     */
+    template <typename Lhs, typename E, size_t N>
+    detail::DeferredAssignment<Lhs, E> assign(Lhs& lhs, const detail::Expression<E, N>& expr) {
+        return {lhs, static_cast<const E&>(expr)};
+    }
+
+    /*!
+     * Create an assignment of a constant lhs = value to be executed by ippl::fuse.
+     * @param lhs the field or particle attribute to assign to
+     * @param value the constant
+     */
+    template <typename Lhs>
+    detail::DeferredAssignment<Lhs, detail::Scalar<typename Lhs::value_type>> assign(
+        Lhs& lhs, typename Lhs::value_type value) {
+        return {lhs, detail::Scalar<typename Lhs::value_type>(value)};
+    }
+
+    /*!
+     * Execute several assignments over the same index space in a single kernel,
+     * which reads and writes each element only once instead of once per statement.
+     * The assignments are evaluated in order for every index. Expressions may
+     * therefore read fields or attributes assigned by an earlier statement only at
+     * the same index; stencil expressions (e.g. grad, laplace) of such fields are
+     * not allowed. Particle assignments skip tombstone slots.
+     *
+     * Usage:
+     *   ippl::fuse(ippl::assign(P, P - 0.5 * dt * E), ippl::assign(R, R + dt * P));
+     *
+     * @param assignments the assignments created with ippl::assign
+     */
+    template <typename A, typename... Rest>
+    void fuse(const A& first, const Rest&... rest) {
+        static_assert(((detail::isFieldAssignment<typename A::lhs_type>
+                        == detail::isFieldAssignment<typename Rest::lhs_type>)
+                       && ...),
+                      "ippl::fuse: cannot mix field and particle assignments");
+
+        if (!(first.sameIndexSpace(rest) && ...)) {
+            throw IpplException("ippl::fuse",
+                                "All assignments must iterate over the same index space.");
+        }
+
+        first.markModified();
+        (rest.markModified(), ...);
+
+        auto kernel = detail::makeFusedKernel(first, rest...);
+        if constexpr (!detail::isFieldAssignment<typename A::lhs_type>) {
+            auto valid = first.lhs_m.getValidMask();
+            if (valid.extent(0) > 0) {
+                ippl::parallel_for("ippl::fuse", first.policy(),
+                                   detail::MaskedAssignments<decltype(kernel), decltype(valid)>{
+                                       kernel, valid});
+                return;
+            }
+        }
+        ippl::parallel_for("ippl::fuse", first.policy(), kernel);
+    }
+}  // namespace ippl
+
+#endif
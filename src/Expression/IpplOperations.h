@@ -7,6 +7,7 @@
 
 #include <Kokkos_MathematicalFunctions.hpp>
 #include <tuple>
+#include <type_traits>
 
 namespace ippl {
     /*!
@@ -639,6 +640,84 @@ namespace ippl {
                 return vector_type{};
             }
         };
+
+        /*!
+         * Kernel of a single deferred assignment view = expression. Several of
+         * them are chained by FusedAssignments and executed in one kernel.
+         * @tparam View the view type of the left-hand side
+         * @tparam E the expression type of the right-hand side
+         */
+        template <typename View, typename E>
+        struct FusedAssignment {
+            View view_m;
+            E expr_m;
+
+            template <typename Coords>
+            KOKKOS_INLINE_FUNCTION void operator()(const Coords& args) const {
+                if constexpr (std::is_integral_v<Coords>) {
+                    view_m(args) = expr_m(args);
+                } else if constexpr (View::rank == 1) {
+                    // particle attribute expressions only accept a scalar index
+                    (*this)(args[0]);
+                } else {
+                    apply(view_m, args) = apply(expr_m, args);
+                }
+            }
+        };
+
+        /*!
+         * Chain of assignments that are evaluated in order for each index.
+         * A later assignment hence sees the values written by an earlier one
+         * at the same index, as if the assignments were separate kernels.
+         * @tparam Assignments... the FusedAssignment types
+         */
+        template <typename... Assignments>
+        struct FusedAssignments;
+
+        template <typename A>
+        struct FusedAssignments<A> {
+            A first_m;
+
+            template <typename Coords>
+            KOKKOS_INLINE_FUNCTION void operator()(const Coords& args) const {
+                first_m(args);
+            }
+        };
+
+        template <typename A, typename... Rest>
+        struct FusedAssignments<A, Rest...> {
+            A first_m;
+            FusedAssignments<Rest...> rest_m;
+
+            template <typename Coords>
+            KOKKOS_INLINE_FUNCTION void operator()(const Coords& args) const {
+                first_m(args);
+                rest_m(args);
+            }
+        };
+
+        /*!
+         * Chain of particle attribute assignments that skips the tombstone
+         * slots of the bunch (see ParticleBase::setCompactionThreshold).
+         * @tparam Kernel the FusedAssignments type
+         * @tparam Mask the per-slot liveness view
+         */
+        template <typename Kernel, typename Mask>
+        struct MaskedAssignments {
+            Kernel kernel_m;
+            Mask valid_m;
+
+            template <typename Coords>
+            KOKKOS_INLINE_FUNCTION void operator()(const Coords& args) const {
+                if constexpr (std::is_integral_v<Coords>) {
+                    if (valid_m(args)) {
+                        kernel_m(args);
+                    }
+                } else if (valid_m(args[0])) {
+                    kernel_m(args);
+                }
+            }
+        };
     }  // namespace detail
 }  // namespace ippl
 
@@ -0,0 +1,425 @@
+/*!
+ * @file NUFFT.h
+ * @brief Non-uniform FFT specialization (NUFFTransform tag).
+ *
+ * Native type-1 / type-2 NUFFT built from the particle Scatter / Gather
+ * engines with an exponential-of-semicircle kernel, the heFFTe C2C backend
+ * on an upsampled grid, and a deconvolution with the kernel's Fourier
+ * transform. Included from IpplCore.h after the particle headers, since it
+ * depends on ParticleAttrib through the interpolation engines.
+ */
+#ifndef IPPL_FFT_TRANSFORM_NUFFT_H
+#define IPPL_FFT_TRANSFORM_NUFFT_H
+
+#include <Kokkos_MathematicalConstants.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "Utility/IpplException.h"
+#include "Utility/ParameterList.h"
+
+#include "Communicate/Communicator.h"
+#include "FFT/Backend/Backend.h"
+#include "FFT/Traits.h"
+#include "FFT/Transform/Common.h"
+#include "Interpolation/Gather/Gather.h"
+#include "Interpolation/Kernels.h"
+#include "Interpolation/Scatter/Scatter.h"
+
+namespace ippl {
+    namespace fft {
+
+        /*!
+         * @brief Kernel width needed for a relative accuracy @p tol at upsampling
+         *        factor @p sigma (w ~ log10(1/tol) + 1 for sigma = 2).
+         */
+        template <int MaxWidth>
+        inline int nufftKernelWidth(double tol, double sigma) {
+            const double pi = Kokkos::numbers::pi;
+            int width       = static_cast<int>(
+                std::ceil(-std::log(tol) / (pi * std::sqrt(1.0 - 1.0 / sigma))));
+            return std::clamp(width, 2, MaxWidth);
+        }
+
+        /*!
+         * @brief ES shape parameter for width @p w and upsampling factor @p sigma.
+         */
+        inline double nufftKernelBeta(int width, double sigma) {
+            const double pi = Kokkos::numbers::pi;
+            return 0.97 * pi * (1.0 - 0.5 / sigma) * width;
+        }
+
+        /*!
+         * @brief Smallest even integer >= @p n whose only prime factors are 2, 3 and 5.
+         */
+        inline int nextSmoothEven(int n) {
+            for (int m = std::max(2, n + (n & 1));; m += 2) {
+                int r = m;
+                for (int p : {2, 3, 5}) {
+                    while (r % p == 0) {
+                        r /= p;
+                    }
+                }
+                if (r == 1) {
+                    return m;
+                }
+            }
+        }
+
+        /*!
+         * @brief Gauss-Legendre nodes and weights on [-1, 1] (Newton iteration).
+         */
+        inline void gaussLegendre(int n, std::vector<double>& nodes, std::vector<double>& weights) {
+            const double pi = Kokkos::numbers::pi;
+            nodes.resize(n);
+            weights.resize(n);
+            for (int i = 0; i < n; ++i) {
+                double x = std::cos(pi * (i + 0.75) / (n + 0.5));
+                double dp = 1.0;
+                for (int iter = 0; iter < 100; ++iter) {
+                    double p0 = 1.0, p1 = x;
+                    for (int k = 2; k <= n; ++k) {
+                        const double p2 = ((2 * k - 1) * x * p1 - (k - 1) * p0) / k;
+                        p0              = p1;
+                        p1              = p2;
+                    }
+                    dp             = n * (x * p1 - p0) / (x * x - 1.0);
+                    const double dx = p1 / dp;
+                    x -= dx;
+                    if (std::abs(dx) < 1e-15) {
+                        break;
+                    }
+                }
+                nodes[i]   = x;
+                weights[i] = 2.0 / ((1.0 - x * x) * dp * dp);
+            }
+        }
+    }  // namespace fft
+
+    /*!
+     * @class FFT<NUFFTransform, ComplexField>
+     * @brief Type-1 and type-2 non-uniform FFT between particles and Fourier modes.
+     *
+     * With N_d modes per dimension, k_d in [-N_d/2, N_d/2) stored at index
+     * k_d + N_d/2 of the field's global domain, and particle positions x_j in
+     * [-pi, pi)^Dim:
+     *   - type 1: f(k)  = sum_j Q_j exp(-i k.x_j), summed over the particles of all ranks
+     *   - type 2: Q_j   = sum_k f(k) exp(+i k.x_j)
+     * The two transforms are adjoint to each other.
+     *
+     * The particle values are spread onto (or interpolated from) a grid upsampled
+     * by @c upsampling with an ESKernel whose width is chosen from @c tolerance,
+     * transformed with the heFFTe C2C backend, and corrected by the kernel's
+     * Fourier transform. The mode field must hold all modes on every rank; the
+     * upsampled grid is rank-local, so each rank transforms its own particles and
+     * type-1 results are summed over all ranks.
+     *
+     * Parameters (besides the heFFTe options, see makeHeffteOptions):
+     *   - @c tolerance  requested relative accuracy (default 1e-6)
+     *   - @c upsampling grid upsampling factor > 1 (default 2)
+     *
+     * @tparam ComplexField Field whose value_type is a Kokkos::complex.
+     */
+    template <typename ComplexField>
+    class FFT<NUFFTransform, ComplexField> {
+    public:
+        static constexpr unsigned Dim = ComplexField::dim;
+
+        using Complex_t  = typename ComplexField::value_type;
+        using T          = typename Complex_t::value_type;
+        using MemSpace   = typename ComplexField::memory_space;
+        using ExecSpace  = typename ComplexField::execution_space;
+        using Layout_t   = FieldLayout<Dim>;
+        using Mesh_t     = typename ComplexField::Mesh_t;
+        using Kernel_t   = Interpolation::ESKernel<T>;
+        using Backend_t  = fft::HeffteC2C<T, Dim, MemSpace>;
+        using TempView_t = typename Kokkos::View<typename ComplexField::view_type::data_type,
+                                                 Kokkos::LayoutLeft, MemSpace>::uniform_type;
+        using Factors_t  = Kokkos::View<T*, MemSpace>;
+
+        /*!
+         * @brief Set up the upsampled grid, kernel and FFT plan for the modes of @p layout.
+         * @param layout Layout of the mode field (not distributed).
+         * @param type   1 (particles to modes) or 2 (modes to particles).
+         * @param params Accuracy parameters and heFFTe options.
+         */
+        FFT(const Layout_t& layout, int type, const ParameterList& params);
+
+        /*!
+         * @brief Execute the transform.
+         * @param R particle positions in [-pi, pi)^Dim
+         * @param Q particle values (input of type 1, output of type 2); tombstones
+         *        are skipped by the spreading and left unchanged by the interpolation
+         * @param f Fourier modes (output of type 1, input of type 2)
+         */
+        template <typename P, class... PosProps, class... ValProps>
+        void transform(const ParticleAttrib<Vector<P, Dim>, PosProps...>& R,
+                       ParticleAttrib<Complex_t, ValProps...>& Q, ComplexField& f);
+
+        int getType() const { return type_m; }
+
+        //! Width of the spreading kernel in fine grid points.
+        int getKernelWidth() const { return kernel_m.width(); }
+
+        //! Extents of the upsampled grid.
+        const Vector<int, Dim>& getFineGridSize() const { return nfine_m; }
+
+    private:
+        /*!
+         * Compute the deconvolution factors (-1)^k / phihat(k) of every mode
+         * and dimension, where phihat is the Fourier transform of the kernel
+         * sampled on the fine grid.
+         */
+        void computeCorrection();
+
+        //! Fine grid spectrum -> modes (type 1).
+        void extractModes(ComplexField& f);
+
+        //! Modes -> fine grid spectrum (type 2).
+        void insertModes(ComplexField& f);
+
+        int type_m;
+        Kernel_t kernel_m;
+
+        Vector<int, Dim> nmodes_m;
+        Vector<int, Dim> nfine_m;
+
+        std::unique_ptr<Layout_t> fineLayout_m;
+        std::unique_ptr<Mesh_t> fineMesh_m;
+        std::unique_ptr<ComplexField> fine_m;
+
+        std::unique_ptr<Backend_t> backend_m;
+        TempView_t fineTemp_m;
+        TempView_t modesTemp_m;
+
+        // deconvolution factors of all dimensions, dimension d starts at offset_m[d]
+        Factors_t correction_m;
+        Vector<int, Dim> offset_m;
+
+        std::unique_ptr<Scatter<Kernel_t, Dim>> scatter_m;
+        std::unique_ptr<Gather<Kernel_t, Dim>> gather_m;
+    };
+
+    template <typename ComplexField>
+    FFT<NUFFTransform, ComplexField>::FFT(const Layout_t& layout, int type,
+                                          const ParameterList& params)
+        : type_m(type) {
+        static_assert(Dim == 2 || Dim == 3, "heFFTe only supports 2D and 3D");
+
+        if (type != 1 && type != 2) {
+            throw IpplException("FFT<NUFFTransform>", "NUFFT type must be 1 or 2");
+        }
+
+        const auto& lDom = layout.getLocalNDIndex();
+        const auto& gDom = layout.getDomain();
+        for (unsigned d = 0; d < Dim; ++d) {
+            if (lDom[d].length() != gDom[d].length()) {
+                throw IpplException("FFT<NUFFTransform>",
+                                    "The mode field must not be distributed across ranks");
+            }
+            nmodes_m[d] = gDom[d].length();
+        }
+
+        const double tol   = params.get<double>("tolerance", 1e-6);
+        const double sigma = params.get<double>("upsampling", 2.0);
+        if (!(sigma > 1.0)) {
+            throw IpplException("FFT<NUFFTransform>", "The upsampling factor must be > 1");
+        }
+
+        const int width = fft::nufftKernelWidth<Kernel_t::max_width>(tol, sigma);
+        kernel_m        = Kernel_t(width, T(fft::nufftKernelBeta(width, sigma)));
+
+        // Grid nodes sit at -pi + g * h: the Scatter / Gather engines place node
+        // g at origin + (g + 1/2) h.
+        const T pi = Kokkos::numbers::pi_v<T>;
+        std::array<Index, Dim> domains;
+        typename Mesh_t::vector_type hx, origin;
+        for (unsigned d = 0; d < Dim; ++d) {
+            nfine_m[d] = fft::nextSmoothEven(
+                std::max(static_cast<int>(std::ceil(sigma * nmodes_m[d])), 2 * width));
+            domains[d] = Index(nfine_m[d]);
+            hx[d]      = 2 * pi / nfine_m[d];
+            origin[d]  = -pi - hx[d] / 2;
+        }
+        auto fineDomain = std::make_from_tuple<NDIndex<Dim>>(domains);
+
+        std::array<bool, Dim> isParallel;
+        isParallel.fill(false);
+
+        const int nghost = width / 2 + 1;
+        fineLayout_m =
+            std::make_unique<Layout_t>(mpi::Communicator(MPI_COMM_SELF), fineDomain, isParallel,
+                                       true, nghost);
+        fineMesh_m = std::make_unique<Mesh_t>(fineDomain, hx, origin);
+        fine_m     = std::make_unique<ComplexField>(*fineMesh_m, *fineLayout_m, nghost);
+
+        std::array<long long, 3> low, high;
+        fft::domainToBounds<Dim>(fineDomain, low, high);
+        heffte::box3d<long long> box{low, high};
+        backend_m = std::make_unique<Backend_t>(box, box, MPI_COMM_SELF, params);
+
+        fineTemp_m  = detail::shrinkView("nufft_fine", fine_m->getView(), nghost);
+        modesTemp_m = TempView_t();
+
+        computeCorrection();
+
+        scatter_m = std::make_unique<Scatter<Kernel_t, Dim>>(kernel_m);
+        gather_m  = std::make_unique<Gather<Kernel_t, Dim>>(kernel_m);
+    }
+
+    template <typename ComplexField>
+    void FFT<NUFFTransform, ComplexField>::computeCorrection() {
+        const int width = kernel_m.width();
+        const double pi = Kokkos::numbers::pi;
+
+        std::vector<double> nodes, weights;
+        fft::gaussLegendre(4 * width + 8, nodes, weights);
+
+        int total = 0;
+        for (unsigned d = 0; d < Dim; ++d) {
+            offset_m[d] = total;
+            total += nmodes_m[d];
+        }
+
+        correction_m = Factors_t("nufft_correction", total);
+        auto hostCorr = Kokkos::create_mirror_view(correction_m);
+
+        // phihat(k) = w/2 * int_{-1}^{1} phi(t) cos(pi w k t / n) dt
+        for (unsigned d = 0; d < Dim; ++d) {
+            const int N = nmodes_m[d];
+            const int n = nfine_m[d];
+            for (int i = 0; i < N; ++i) {
+                const int k     = i - N / 2;
+                double phihat   = 0;
+                const double wk = pi * width * k / n;
+                for (size_t q = 0; q < nodes.size(); ++q) {
+                    phihat += weights[q] * static_cast<double>(kernel_m(T(nodes[q])))
+                              * std::cos(wk * nodes[q]);
+                }
+                phihat *= 0.5 * width;
+
+                const double sign       = (k % 2 == 0) ? 1.0 : -1.0;
+                hostCorr(offset_m[d] + i) = T(sign / phihat);
+            }
+        }
+        Kokkos::deep_copy(correction_m, hostCorr);
+    }
+
+    template <typename ComplexField>
+    void FFT<NUFFTransform, ComplexField>::extractModes(ComplexField& f) {
+        using index_array_type = typename RangePolicy<Dim, ExecSpace>::index_array_type;
+
+        auto modes      = modesTemp_m;
+        auto spectrum   = fineTemp_m;
+        auto correction = correction_m;
+        auto offset     = offset_m;
+        auto nmodes     = nmodes_m;
+        auto nfine      = nfine_m;
+
+        // heFFTe's forward transform is normalized by the number of grid points
+        T scale = 1;
+        for (unsigned d = 0; d < Dim; ++d) {
+            scale *= nfine_m[d];
+        }
+
+        ippl::parallel_for(
+            "NUFFT_extractModes", getRangePolicy(modes),
+            KOKKOS_LAMBDA(const index_array_type& args) {
+                index_array_type fineIdx;
+                T factor = scale;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    const int k = static_cast<int>(args[d]) - nmodes[d] / 2;
+                    fineIdx[d]  = k < 0 ? k + nfine[d] : k;
+                    factor *= correction(offset[d] + args[d]);
+                }
+                apply(modes, args) = factor * apply(spectrum, fineIdx);
+            });
+
+        // every rank only spread its own particles
+        if (Comm->size() > 1) {
+            auto hostModes = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), modes);
+            Comm->allreduce(reinterpret_cast<T*>(hostModes.data()), 2 * hostModes.size(),
+                            std::plus<T>());
+            Kokkos::deep_copy(modes, hostModes);
+        }
+
+        auto view = f.getView();
+        fft::copyFromTemp<ExecSpace, decltype(view), TempView_t>(view, modes, f.getNghost());
+    }
+
+    template <typename ComplexField>
+    void FFT<NUFFTransform, ComplexField>::insertModes(ComplexField& f) {
+        using index_array_type = typename RangePolicy<Dim, ExecSpace>::index_array_type;
+
+        auto view = f.getView();
+        fft::copyToTemp<ExecSpace, TempView_t, decltype(view)>(modesTemp_m, view, f.getNghost());
+
+        auto modes      = modesTemp_m;
+        auto spectrum   = fineTemp_m;
+        auto correction = correction_m;
+        auto offset     = offset_m;
+        auto nmodes     = nmodes_m;
+        auto nfine      = nfine_m;
+
+        Kokkos::deep_copy(spectrum, Complex_t(0));
+
+        ippl::parallel_for(
+            "NUFFT_insertModes", getRangePolicy(modes),
+            KOKKOS_LAMBDA(const index_array_type& args) {
+                index_array_type fineIdx;
+                T factor = 1;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    const int k = static_cast<int>(args[d]) - nmodes[d] / 2;
+                    fineIdx[d]  = k < 0 ? k + nfine[d] : k;
+                    factor *= correction(offset[d] + args[d]);
+                }
+                apply(spectrum, fineIdx) = factor * apply(modes, args);
+            });
+    }
+
+    template <typename ComplexField>
+    template <typename P, class... PosProps, class... ValProps>
+    void FFT<NUFFTransform, ComplexField>::transform(
+        const ParticleAttrib<Vector<P, Dim>, PosProps...>& R,
+        ParticleAttrib<Complex_t, ValProps...>& Q, ComplexField& f) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            if (static_cast<int>(f.getOwned()[d].length()) != nmodes_m[d]) {
+                throw IpplException("FFT<NUFFTransform>::transform",
+                                    "The field does not match the mode layout");
+            }
+        }
+
+        if (modesTemp_m.size() != f.getOwned().size()) {
+            modesTemp_m = detail::shrinkView("nufft_modes", f.getView(), f.getNghost());
+        }
+
+        auto fineView    = fine_m->getView();
+        const int nghost = fine_m->getNghost();
+
+        if (type_m == 1) {
+            (*scatter_m)(*fine_m, R, Q);
+
+            fft::copyToTemp<ExecSpace, TempView_t, decltype(fineView)>(fineTemp_m, fineView,
+                                                                       nghost);
+            backend_m->forward(fineTemp_m.data(), fineTemp_m.data());
+
+            extractModes(f);
+        } else {
+            insertModes(f);
+
+            backend_m->backward(fineTemp_m.data(), fineTemp_m.data());
+            fft::copyFromTemp<ExecSpace, decltype(fineView), TempView_t>(fineView, fineTemp_m,
+                                                                         nghost);
+
+            (*gather_m)(*fine_m, R, Q);
+        }
+    }
+
+}  // namespace ippl
+
+#endif
@@ -3,7 +3,8 @@
  * @brief Aggregate include of all IPPL FFT transform specializations.
  *
  * Pulls in the CC (complex-to-complex), RC (real-to-complex), pruned
- * CC/RC, and trigonometric (sin/cos) transforms in one go.
+ * CC/RC, and trigonometric (sin/cos) transforms in one go. The NUFFT
+ * (NUFFT.h) depends on the particle headers and is included from IpplCore.h.
  */
 #ifndef IPPL_FFT_TRANSFORM_HPP
 #define IPPL_FFT_TRANSFORM_HPP
@@ -128,6 +128,21 @@ namespace ippl {
         void accumulateHalo();
         void accumulateHalo_noghost(int nghost = 1);
 
+        /*!
+         * Split-phase variant of fillHalo. fillHaloBegin posts all sends and receives
+         * and returns immediately; fillHaloEnd waits for the messages and fills the
+         * halo cells. Kernels that only touch cells at least one stencil width away
+         * from the halo may run in between (see ippl::parallel_for_interior).
+         */
+        void fillHaloBegin();
+        void fillHaloEnd();
+
+        /*!
+         * Split-phase variant of accumulateHalo (see fillHaloBegin / fillHaloEnd).
+         */
+        void accumulateHaloBegin();
+        void accumulateHaloEnd();
+
         auto& getCommunicator() const { return getLayout().comm; }
 
         // Access to the layout.
@@ -165,6 +165,42 @@ namespace ippl {
         }
     }
 
+    template <typename T, unsigned Dim, class... ViewArgs>
+    void BareField<T, Dim, ViewArgs...>::fillHaloBegin() {
+        if (layout_m->comm.size() > 1) {
+            halo_m.fillHaloBegin(dview_m, layout_m, nghost_m);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... ViewArgs>
+    void BareField<T, Dim, ViewArgs...>::fillHaloEnd() {
+        if (layout_m->comm.size() > 1) {
+            halo_m.fillHaloEnd(dview_m);
+        }
+        if (layout_m->isAllPeriodic_m) {
+            using Op = typename detail::HaloCells<T, Dim, ViewArgs...>::assign;
+            halo_m.template applyPeriodicSerialDim<Op>(dview_m, layout_m, nghost_m);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... ViewArgs>
+    void BareField<T, Dim, ViewArgs...>::accumulateHaloBegin() {
+        if (layout_m->comm.size() > 1) {
+            halo_m.accumulateHaloBegin(dview_m, layout_m, nghost_m);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... ViewArgs>
+    void BareField<T, Dim, ViewArgs...>::accumulateHaloEnd() {
+        if (layout_m->comm.size() > 1) {
+            halo_m.accumulateHaloEnd(dview_m);
+        }
+        if (layout_m->isAllPeriodic_m) {
+            using Op = typename detail::HaloCells<T, Dim, ViewArgs...>::rhs_plus_assign;
+            halo_m.template applyPeriodicSerialDim<Op>(dview_m, layout_m, nghost_m);
+        }
+    }
+
     template <typename T, unsigned Dim, class... ViewArgs>
     void BareField<T, Dim, ViewArgs...>::accumulateHalo_noghost(int nghost) {
         if (layout_m->comm.size() > 1) {
@@ -67,14 +67,45 @@ namespace ippl {
         const int nghost                = field.getNghost();
         int src, dest;
 
+        if (d >= Dim) {
+            throw IpplException("ExtrapolateFace::apply", "face number wrong");
+        }
+
+        using exec_space       = typename Field::execution_space;
+        using index_type       = typename RangePolicy<Dim, exec_space>::index_type;
+        using index_array_type = typename RangePolicy<Dim, exec_space>::index_array_type;
+        Kokkos::Array<index_type, Dim> begin, end;
+
         // It is not clear what it exactly means to do extrapolate
-        // BC for nghost >1
+        // BC for nghost >1. Constant faces, however, define the value
+        // of every ghost layer. These are filled over the whole extent of the
+        // other dimensions such that ghost cells shared with neighbouring ranks
+        // hold the boundary value, too (required for deep halos).
         if (nghost > 1) {
-            throw IpplException("ExtrapolateFace::apply", "nghost > 1 not supported");
-        }
+            if (!(this->getBCType() & CONSTANT_FACE)) {
+                throw IpplException("ExtrapolateFace::apply", "nghost > 1 not supported");
+            }
 
-        if (d >= Dim) {
-            throw IpplException("ExtrapolateFace::apply", "face number wrong");
+            for (unsigned i = 0; i < Dim; i++) {
+                begin[i] = 0;
+                end[i]   = view.extent(i);
+            }
+            if (face & 1) {
+                begin[d] = view.extent(d) - nghost;
+            } else {
+                end[d] = nghost;
+            }
+
+            const T value = offset_m;
+            ippl::parallel_for(
+                "Assign constant BC", createRangePolicy<Dim, exec_space>(begin, end),
+                KOKKOS_LAMBDA(const index_array_type& args) {
+                    // to avoid ambiguity with the member function
+                    using ippl::apply;
+
+                    apply(view, args) = value;
+                });
+            return;
         }
 
         // If face & 1 is true, then it is an upper BC
@@ -86,16 +117,12 @@ namespace ippl {
             dest = src - 1;
         }
 
-        using exec_space = typename Field::execution_space;
-        using index_type = typename RangePolicy<Dim, exec_space>::index_type;
-        Kokkos::Array<index_type, Dim> begin, end;
         for (unsigned i = 0; i < Dim; i++) {
             begin[i] = nghost;
             end[i]   = view.extent(i) - nghost;
         }
-        begin[d]               = src;
-        end[d]                 = src + 1;
-        using index_array_type = typename RangePolicy<Dim, exec_space>::index_array_type;
+        begin[d] = src;
+        end[d]   = src + 1;
         ippl::parallel_for(
             "Assign extrapolate BC", createRangePolicy<Dim, exec_space>(begin, end),
             KOKKOS_CLASS_LAMBDA(index_array_type & args) {
@@ -0,0 +1,128 @@
+//
+// Deep halos
+//   Run several stencil sweeps per halo exchange on fields with more
+//   than one layer of ghost cells.
+//
+#ifndef IPPL_DEEP_HALO_H
+#define IPPL_DEEP_HALO_H
+
+#include <algorithm>
+
+#include "Utility/PAssert.h"
+#include "Utility/ParallelDispatch.h"
+
+#include "Field/BcTypes.h"
+
+namespace ippl {
+    /*!
+     * Check whether the ghost cells of a field stay valid over several stencil
+     * sweeps after a single halo exchange. This is the case if the layout is
+     * periodic in all dimensions, or if every face holds a constant value
+     * (ConstantFace, ZeroFace) or has no boundary condition.
+     * @param field the field to check
+     * @returns true if deep halos can be used
+     */
+    template <class Field>
+    bool supportsDeepHalo(Field& field) {
+        if (field.getLayout().isAllPeriodic_m) {
+            return true;
+        }
+
+        auto& bcs = field.getFieldBC();
+        for (unsigned face = 0; face < 2 * Field::dim; ++face) {
+            if (!bcs[face]) {
+                continue;
+            }
+            const FieldBC type = bcs[face]->getBCType();
+            if (type != CONSTANT_FACE && type != ZERO_FACE && type != NO_FACE) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * The number of sweeps of a stencil that can be run on a field per halo
+     * exchange.
+     * @param field the field the stencil is applied to
+     * @param width the half-width of the stencil (1 for a 3-point stencil)
+     * @returns nghost / width if deep halos are supported, 1 otherwise
+     */
+    template <class Field>
+    int deepHaloDepth(Field& field, int width = 1) {
+        if (!supportsDeepHalo(field)) {
+            return 1;
+        }
+        return std::max(1, field.getNghost() / width);
+    }
+
+    /*!
+     * Range policy over the owned cells of a field grown by the given number
+     * of ghost layers. The region is not grown across physical (non-periodic)
+     * boundaries, since the ghost cells there hold boundary values.
+     * @param field the field
+     * @param grow number of ghost layers to include
+     * @returns the range policy
+     */
+    template <class Field>
+    auto getGrownRangePolicy(const Field& field, int grow) {
+        constexpr unsigned Dim = Field::dim;
+        using exec_space       = typename Field::execution_space;
+        using index_type       = typename RangePolicy<Dim, exec_space>::index_type;
+
+        const int nghost = field.getNghost();
+        PAssert_LE(grow, nghost);
+
+        const auto& layout  = field.getLayout();
+        const auto& lDom    = layout.getLocalNDIndex();
+        const auto& gDom    = layout.getDomain();
+        const auto& view    = field.getView();
+        const bool periodic = layout.isAllPeriodic_m;
+
+        Kokkos::Array<index_type, Dim> begin, end;
+        for (unsigned d = 0; d < Dim; ++d) {
+            const bool growLower = periodic || (lDom[d].min() != gDom[d].min());
+            const bool growUpper = periodic || (lDom[d].max() != gDom[d].max());
+
+            begin[d] = nghost - (growLower ? grow : 0);
+            end[d]   = view.extent(d) - nghost + (growUpper ? grow : 0);
+        }
+        return createRangePolicy<Dim, exec_space>(begin, end);
+    }
+
+    /*!
+     * Apply a stencil sweep several times to a field, exchanging its halo only
+     * once every deepHaloDepth(field, width) sweeps. Between two exchanges the
+     * region each sweep has to update shrinks by the stencil width, such that
+     * the last sweep before the next exchange updates exactly the owned cells.
+     * This trades some redundant computation in the ghost cells for fewer
+     * latency-bound exchanges. Falls back to one exchange per sweep if the
+     * boundary conditions do not allow deep halos.
+     *
+     * All other fields read by the sweep must have valid ghost cells up to
+     * the depth of the field.
+     *
+     * @param field the field updated by the sweeps
+     * @param nsweeps the total number of sweeps
+     * @param width the half-width of the stencil
+     * @param sweep callable taking the range policy of the cells to update
+     */
+    template <class Field, class Sweep>
+    void deepHaloSweeps(Field& field, unsigned nsweeps, int width, Sweep&& sweep) {
+        const unsigned depth = deepHaloDepth(field, width);
+
+        unsigned done = 0;
+        while (done < nsweeps) {
+            field.fillHalo();
+            field.getFieldBC().apply(field);
+
+            const unsigned batch = std::min(depth, nsweeps - done);
+            for (unsigned s = 0; s < batch; ++s) {
+                sweep(getGrownRangePolicy(field, (batch - 1 - s) * width));
+            }
+            done += batch;
+        }
+    }
+}  // namespace ippl
+
+#endif
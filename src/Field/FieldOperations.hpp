@@ -4,6 +4,43 @@
 //
 
 namespace ippl {
+    namespace detail {
+        /*!
+         * Evaluate a first-neighbour stencil expression of u into result while the halo
+         * exchange of u is in flight. The interior of result is computed between
+         * fillHaloBegin and fillHaloEnd, the cells next to the halo once the exchange and
+         * the boundary conditions of u are complete.
+         * @param name kernel name
+         * @param result the field to assign to
+         * @param u the field the stencil is applied to
+         * @param expr the stencil expression, constructed without halo exchange
+         */
+        template <typename Field, typename Result, typename E>
+        void assignWithHaloOverlap(const std::string& name, Result& result, Field& u,
+                                   const E& expr) {
+            constexpr unsigned Dim = Field::dim;
+            using exec_space       = typename Result::execution_space;
+            using index_array_type = typename RangePolicy<Dim, exec_space>::index_array_type;
+
+            auto view        = result.getView();
+            const int nghost = result.getNghost();
+
+            auto kernel = KOKKOS_LAMBDA(const index_array_type& args) {
+                apply(view, args) = apply(expr, args);
+            };
+
+            u.fillHaloBegin();
+            ippl::parallel_for_interior(name, view, nghost, 1, kernel);
+            Kokkos::fence();
+            u.fillHaloEnd();
+
+            BConds<Field, Dim>& bcField = u.getFieldBC();
+            bcField.apply(u);
+
+            ippl::parallel_for_boundary(name, view, nghost, 1, kernel);
+        }
+    }  // namespace detail
+
     /*!
      * User interface of gradient
      * @param u field
@@ -73,6 +110,49 @@ namespace ippl {
         return detail::meta_laplace<Field>(u, hvector);
     }
 
+    /*!
+     * Gradient of u assigned to result, overlapping the halo exchange of u
+     * with the computation of the interior cells.
+     * @param result vector field to store the gradient in
+     * @param u field
+     */
+    template <typename Field, typename Result>
+    void grad_overlap(Result& result, Field& u) {
+        constexpr unsigned Dim = Field::dim;
+
+        using mesh_type   = typename Field::Mesh_t;
+        using vector_type = typename mesh_type::vector_type;
+
+        mesh_type& mesh = u.get_mesh();
+        vector_type vectors[Dim];
+        for (unsigned d = 0; d < Dim; d++) {
+            vectors[d]    = 0;
+            vectors[d][d] = 0.5 / mesh.getMeshSpacing(d);
+        }
+        detail::assignWithHaloOverlap("grad_overlap", result, u,
+                                      detail::meta_grad<Field>(u, vectors));
+    }
+
+    /*!
+     * Laplacian of u assigned to result, overlapping the halo exchange of u
+     * with the computation of the interior cells.
+     * @param result field to store the Laplacian in
+     * @param u field
+     */
+    template <typename Field, typename Result>
+    void laplace_overlap(Result& result, Field& u) {
+        constexpr unsigned Dim = Field::dim;
+
+        using mesh_type = typename Field::Mesh_t;
+        mesh_type& mesh = u.get_mesh();
+        typename mesh_type::vector_type hvector(0);
+        for (unsigned d = 0; d < Dim; d++) {
+            hvector[d] = 1.0 / std::pow(mesh.getMeshSpacing(d), 2);
+        }
+        detail::assignWithHaloOverlap("laplace_overlap", result, u,
+                                      detail::meta_laplace<Field>(u, hvector));
+    }
+
     /*!
      * User interface of curl in three dimensions.
      * @param u field
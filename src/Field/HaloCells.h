@@ -6,11 +6,17 @@
 #define IPPL_HALO_CELLS_H
 
 #include <array>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "Types/IpplTypes.h"
 #include "Types/ViewTypes.h"
 
 #include "Communicate/Archive.h"
+#include "Communicate/Compression.h"
+#include "Communicate/SharedWindowPool.h"
 #include "FieldLayout/FieldLayout.h"
 #include "Index/NDIndex.h"
 
@@ -77,6 +83,72 @@ namespace ippl {
              */
             void fillHalo(view_type&, Layout_t* layout, int nghost);
 
+            /*!
+             * Start the exchange of internal data to halo cells. All sends and
+             * receives are posted and the function returns immediately, so that
+             * work that does not depend on the halo cells can be overlapped with
+             * the communication. Must be completed by fillHaloEnd.
+             * @param view the original field data
+             * @param layout the field layout storing the domain decomposition
+             * @param nghost the number of ghost cells
+             */
+            void fillHaloBegin(view_type& view, Layout_t* layout, int nghost);
+
+            /*!
+             * Complete an exchange started by fillHaloBegin. Received messages are
+             * unpacked in the order in which they arrive.
+             * @param view the original field data
+             */
+            void fillHaloEnd(view_type& view);
+
+            /*!
+             * Start sending halo data to internal cells (see fillHaloBegin).
+             * Must be completed by accumulateHaloEnd.
+             * @param view the original field data
+             * @param layout the field layout storing the domain decomposition
+             * @param nghost the number of ghost cells
+             */
+            void accumulateHaloBegin(view_type& view, Layout_t* layout, int nghost);
+
+            /*!
+             * Complete an exchange started by accumulateHaloBegin.
+             * @param view the original field data
+             */
+            void accumulateHaloEnd(view_type& view);
+
+            /*!
+             * Set the compression of the messages sent by accumulateHalo (both variants).
+             * Only the truncation stage applies to halos: fields of double then accumulate
+             * single precision contributions, which halves the message size. The values are
+             * converted on the device while packing. fillHalo is not affected, and neither
+             * are fields of other value types. Experimental, see mpi::Compression.
+             * @param compression the compression of subsequent accumulations
+             */
+            void setCompression(const mpi::Compression& compression);
+
+            const mpi::Compression& getCompression() const { return compression_m; }
+
+            /*!
+             * Exchange halos with the neighbors on the same node through a shared-memory window
+             * (MPI_Win_allocate_shared) instead of MPI messages. Every rank packs its messages
+             * into its own segment, and after a node-local barrier the receivers unpack them
+             * directly from the segments of their neighbors. The segments are double-buffered,
+             * so one barrier per exchange suffices. Neighbors on other nodes are exchanged
+             * through MPI as before. Only takes effect if the field is accessible from the
+             * host. Like setCompression, it must be set uniformly on all ranks. The windows
+             * belong to the layout (see FieldLayout::getSharedWindows) and are only freed at
+             * collective points or with the layout, so fields may be destroyed in any order.
+             * @param enable whether to use shared memory for on-node neighbors
+             */
+            void setSharedMemoryExchange(bool enable) { sharedMemory_m = enable; }
+
+            bool isSharedMemoryExchange() const { return sharedMemory_m; }
+
+            /*!
+             * @returns whether a split-phase exchange has been started but not completed
+             */
+            bool isExchangePending() const { return pending_m.active; }
+
             /*!
              * Pack the field data to be sent into a contiguous array.
              * @param range the bounds of the subdomain to be sent
@@ -96,6 +168,27 @@ namespace ippl {
             template <typename Op>
             void unpack(const bound_type& range, const view_type& view, databuffer_type& fd);
 
+            /*!
+             * Pack the field data to be sent into an existing contiguous buffer, e.g. a view
+             * of the communication archive memory. The buffer must hold at least range.size()
+             * elements.
+             * @param range the bounds of the subdomain to be sent
+             * @param view the original view
+             * @param buffer the 1D view to pack into
+             */
+            template <typename Buffer>
+            void packTo(const bound_type& range, const view_type& view, const Buffer& buffer);
+
+            /*!
+             * Unpack the received field data directly from a contiguous buffer.
+             * @param range the bounds of the subdomain to be received
+             * @param view the original view
+             * @param buffer the 1D view holding the received data
+             * @tparam Op the data assigment operator
+             */
+            template <typename Op, typename Buffer>
+            void unpackFrom(const bound_type& range, const view_type& view, const Buffer& buffer);
+
             /*!
              * Operator for the unpack function.
              * This operator is used in case of INTERNAL_TO_HALO.
@@ -130,6 +223,117 @@ namespace ippl {
             void applyPeriodicSerialDim(view_type& view, const Layout_t* layout, const int nghost);
 
         private:
+            using memory_space = typename view_type::memory_space;
+            using archive_type = Archive<memory_space>;
+
+            //! Message type of truncated halos, only differs from T for double
+            using truncated_type = std::conditional_t<std::is_same_v<T, double>, float, T>;
+
+            template <typename U>
+            using shared_view_type = typename archive_type::template unmanaged_view_type<U>;
+
+            //! Whether shared-memory messages can be packed and unpacked by the field's kernels
+            static constexpr bool hostAccessible =
+                Kokkos::SpaceAccessibility<typename view_type::execution_space,
+                                           Kokkos::HostSpace>::accessible;
+
+            /*!
+             * Message to or from a neighbor on the same node, see setSharedMemoryExchange.
+             * The message alternates between two slots of the sender's segment.
+             */
+            struct SharedMessage {
+                bound_type range;
+                std::array<char*, 2> slots;
+            };
+
+            /*!
+             * Directory entry of a message in the sender's segment. The directory precedes the
+             * messages so that the receivers can find them.
+             */
+            struct SharedEntry {
+                int dest;
+                int tag;
+                size_type offset;
+                size_type nbytes;
+            };
+
+            /*!
+             * Cached communication plan of a halo exchange. The plan stores the
+             * index ranges, dedicated send and receive buffers and persistent MPI
+             * requests for all neighbors, so that repeated exchanges on an unchanged
+             * layout only need to pack, start and unpack. A plan is valid for one
+             * layout version, number of ghost cells, send order, truncation and use
+             * of shared memory; the value type is fixed by the HaloCells instance.
+             * Copies of a field share the plan, so whether its persistent requests
+             * are in use is tracked by the plan rather than by the HaloCells.
+             * The send requests are stored first, followed by the receive requests.
+             * Messages to neighbors on the same node are stored separately if shared
+             * memory is used.
+             */
+            struct HaloPlan {
+                const Layout_t* layout = nullptr;
+                unsigned long version  = 0;
+                int nghost             = -1;
+                //! whether the messages hold truncated_type instead of T
+                bool truncated = false;
+                //! whether on-node neighbors are exchanged through shared memory
+                bool shared = false;
+
+                std::vector<bound_type> sendRanges, recvRanges;
+                std::vector<std::shared_ptr<archive_type>> sendBuffers, recvBuffers;
+                std::vector<MPI_Request> requests;
+
+                //! pool of the layout holding the window, which is released by the destructor
+                std::weak_ptr<mpi::rma::SharedWindowPool> windows;
+                int windowId                                = -1;
+                mpi::rma::Window<mpi::rma::Passive>* window = nullptr;
+                MPI_Comm nodeComm                           = MPI_COMM_NULL;
+                std::vector<SharedMessage> sharedSends, sharedRecvs;
+                //! slot of the shared-memory messages of the next exchange
+                unsigned slot = 0;
+                //! whether an exchange with this plan is in progress
+                bool active = false;
+
+                HaloPlan() = default;
+                HaloPlan(const HaloPlan&)            = delete;
+                HaloPlan& operator=(const HaloPlan&) = delete;
+                //! Not collective, the plans of a field may be destroyed in any order
+                ~HaloPlan();
+
+                bool isValidFor(const Layout_t* l, int ng, bool trunc, bool shm) const {
+                    return layout == l && version == l->getVersion() && nghost == ng
+                           && truncated == trunc && shared == shm;
+                }
+            };
+
+            /*!
+             * State of a split-phase exchange between its begin and end calls.
+             */
+            struct PendingExchange {
+                std::shared_ptr<HaloPlan> plan;
+                bool active = false;
+            };
+
+            /*!
+             * Get the cached plan for an exchange, (re-)building it if the layout
+             * has changed since the plan was created.
+             * @param layout the field layout storing the domain decomposition
+             * @param order the data send orientation
+             * @param nghost the number of ghost cells
+             */
+            std::shared_ptr<HaloPlan> getPlan(Layout_t* layout, SendOrder order, int nghost);
+
+            /*!
+             * Acquire the shared-memory window of a plan from the layout and locate the
+             * messages of the on-node neighbors in their segments. Collective on the node
+             * communicator.
+             * @param plan the plan whose shared messages have their ranges set
+             * @param sendEntries the directory of the messages sent by this rank
+             * @param recvSources node ranks and tags of the messages received by this rank
+             */
+            void setupSharedMemory(HaloPlan& plan, std::vector<SharedEntry>& sendEntries,
+                                   const std::vector<std::pair<int, int>>& recvSources);
+
             /*!
              * Exchange the data of halo cells.
              * @param view is the original field data
@@ -142,6 +346,37 @@ namespace ippl {
             void exchangeBoundaries(view_type& view, Layout_t* layout, SendOrder order,
                                     int nghost);
 
+            /*!
+             * Pack and post the sends and post the receives of a halo exchange.
+             * @param view is the original field data
+             * @param layout the field layout storing the domain decomposition
+             * @param order the data send orientation
+             * @param nghost the number of ghost cells
+             */
+            void beginExchange(view_type& view, Layout_t* layout, SendOrder order, int nghost);
+
+            /*!
+             * Wait for the receives posted by beginExchange, unpack them as they
+             * arrive and release the communication buffers.
+             * @param view is the original field data
+             * @tparam Op the data assigment operator of the
+             * unpack function call
+             */
+            template <class Op>
+            void endExchange(view_type& view);
+
+            /*!
+             * Determine the local index range to send to or receive from a neighbor.
+             * @param layout the field layout storing the domain decomposition
+             * @param order the data send orientation
+             * @param index the ternary index of the boundary component
+             * @param i the index of the neighbor in the component's neighbor list
+             * @param nghost the number of ghost cells
+             * @param sending whether the range is sent (true) or received (false)
+             */
+            bound_type getExchangeRange(const Layout_t* layout, SendOrder order, size_t index,
+                                        size_t i, int nghost, bool sending) const;
+
             /*!
              * Extract the subview of the original data. This does not copy.
              * A subview points to the same memory.
@@ -150,7 +385,16 @@ namespace ippl {
              */
             auto makeSubview(const view_type& view, const bound_type& intersect);
 
-            databuffer_type haloData_m;
+            PendingExchange pending_m;
+
+            //! Cached plans, one per send order
+            std::array<std::shared_ptr<HaloPlan>, 3> plans_m;
+
+            //! see setCompression
+            mpi::Compression compression_m;
+
+            //! see setSharedMemoryExchange
+            bool sharedMemory_m = false;
         };
     }  // namespace detail
 }  // namespace ippl
@@ -3,7 +3,11 @@
 //   The guard / ghost cells of BareField.
 //
 
+#include <algorithm>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "Utility/IpplException.h"
@@ -89,6 +93,12 @@ namespace ippl {
         template <typename T, unsigned Dim, class... ViewArgs>
         HaloCells<T, Dim, ViewArgs...>::HaloCells() {}
 
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::setCompression(const mpi::Compression& compression) {
+            // The plans depend on the truncation and are rebuilt on their next use
+            compression_m = compression;
+        }
+
         template <typename T, unsigned Dim, class... ViewArgs>
         void HaloCells<T, Dim, ViewArgs...>::accumulateHalo(view_type& view, Layout_t* layout,
                                                             int nghost) {
@@ -106,18 +116,116 @@ namespace ippl {
             exchangeBoundaries<assign>(view, layout, INTERNAL_TO_HALO, nghost);
         }
 
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::fillHaloBegin(view_type& view, Layout_t* layout,
+                                                           int nghost) {
+            beginExchange(view, layout, INTERNAL_TO_HALO, nghost);
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::fillHaloEnd(view_type& view) {
+            endExchange<assign>(view);
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::accumulateHaloBegin(view_type& view,
+                                                                 Layout_t* layout, int nghost) {
+            beginExchange(view, layout, HALO_TO_INTERNAL, nghost);
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::accumulateHaloEnd(view_type& view) {
+            endExchange<lhs_plus_assign>(view);
+        }
+
         template <typename T, unsigned Dim, class... ViewArgs>
         template <class Op>
         void HaloCells<T, Dim, ViewArgs...>::exchangeBoundaries(view_type& view, Layout_t* layout,
                                                                 SendOrder order, int nghost) {
+            beginExchange(view, layout, order, nghost);
+            endExchange<Op>(view);
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        typename HaloCells<T, Dim, ViewArgs...>::bound_type
+        HaloCells<T, Dim, ViewArgs...>::getExchangeRange(const Layout_t* layout, SendOrder order,
+                                                         size_t index, size_t i, int nghost,
+                                                         bool sending) const {
+            const auto& sendRanges = layout->getNeighborsSendRange();
+            const auto& recvRanges = layout->getNeighborsRecvRange();
+
+            /*We store only the sending and receiving ranges
+             * of INTERNAL_TO_HALO and use the fact that the
+             * sending range of HALO_TO_INTERNAL is the receiving
+             * range of INTERNAL_TO_HALO and vice versa
+             */
+            const bool useSendRange = (order == INTERNAL_TO_HALO) == sending;
+            bound_type range = useSendRange ? sendRanges[index][i] : recvRanges[index][i];
+
+            if (order == HALO_TO_INTERNAL_NOGHOST) {
+                // needed for the NOGHOST approach - we want to remove the ghost
+                // cells on the boundaries of the global domain from the halo
+                // exchange when we set HALO_TO_INTERNAL_NOGHOST
+                const auto& domain   = layout->getDomain();
+                const auto& ldomains = layout->getHostLocalDomains();
+                const int me         = layout->comm.rank();
+
+                for (size_t j = 0; j < Dim; ++j) {
+                    const int stride = ldomains[me][j].stride();
+
+                    const int globalLo = ldomains[me][j].first() + (range.lo[j] - nghost) * stride;
+                    const int globalHi =
+                        ldomains[me][j].first() + (range.hi[j] - 1 - nghost) * stride;
+
+                    bool isLower = (globalLo == domain[j].min());
+                    bool isUpper = (globalHi == domain[j].max());
+
+                    range.lo[j] += isLower * (nghost);
+                    range.hi[j] -= isUpper * (nghost);
+                }
+            }
+            return range;
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        HaloCells<T, Dim, ViewArgs...>::HaloPlan::~HaloPlan() {
+            // Fields may outlive MPI, e.g. when they are global objects
+            int finalized = 0;
+            MPI_Finalized(&finalized);
+            if (finalized) {
+                return;
+            }
+            for (auto& request : requests) {
+                if (request != MPI_REQUEST_NULL) {
+                    MPI_Request_free(&request);
+                }
+            }
+            // Freeing the window is collective; the pool frees it once all ranks released it
+            auto pool = windows.lock();
+            if (pool && windowId >= 0) {
+                pool->release(windowId);
+            }
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        std::shared_ptr<typename HaloCells<T, Dim, ViewArgs...>::HaloPlan>
+        HaloCells<T, Dim, ViewArgs...>::getPlan(Layout_t* layout, SendOrder order, int nghost) {
             using neighbor_list = typename Layout_t::neighbor_list;
-            using range_list    = typename Layout_t::neighbor_range_list;
+
+            // Only accumulations of doubles are truncated
+            const bool truncate = compression_m.truncate && order != INTERNAL_TO_HALO
+                                  && !std::is_same_v<truncated_type, T>;
+
+            const bool shared = sharedMemory_m && hostAccessible;
+
+            auto& plan = plans_m[order];
+            if (plan && plan->isValidFor(layout, nghost, truncate, shared)) {
+                return plan;
+            }
 
             auto& comm = layout->comm;
 
             const neighbor_list& neighbors = layout->getNeighbors();
-            const range_list &sendRanges   = layout->getNeighborsSendRange(),
-                             &recvRanges   = layout->getNeighborsRecvRange();
 
             auto ldom = layout->getLocalNDIndex();
             for (const auto& axis : ldom) {
@@ -128,137 +236,326 @@ namespace ippl {
                 }
             }
 
-            // needed for the NOGHOST approach - we want to remove the ghost
-            // cells on the boundaries of the global domain from the halo
-            // exchange when we set HALO_TO_INTERNAL_NOGHOST
-            const auto domain    = layout->getDomain();
-            const auto& ldomains = layout->getHostLocalDomains();
-
             size_t totalRequests = 0;
             for (const auto& componentNeighbors : neighbors) {
                 totalRequests += componentNeighbors.size();
             }
 
-            int me = Comm->rank();
+            plan            = std::make_shared<HaloPlan>();
+            plan->layout    = layout;
+            plan->version   = layout->getVersion();
+            plan->nghost    = nghost;
+            plan->truncated = truncate;
+            plan->shared    = shared;
+            plan->requests.assign(2 * totalRequests, MPI_REQUEST_NULL);
+
+            const size_t elemSize = truncate ? sizeof(truncated_type) : sizeof(T);
+
+            // Ranks of the layout within the node communicator, MPI_UNDEFINED on other nodes
+            std::vector<int> nodeRanks;
+            if (shared) {
+                auto pool      = layout->getSharedWindows();
+                plan->windows  = pool;
+                plan->nodeComm = pool->getNodeComm();
+
+                MPI_Group group, nodeGroup;
+                MPI_Comm_group(comm, &group);
+                MPI_Comm_group(plan->nodeComm, &nodeGroup);
+
+                std::vector<int> ranks(comm.size());
+                std::iota(ranks.begin(), ranks.end(), 0);
+                nodeRanks.resize(comm.size());
+                MPI_Group_translate_ranks(group, comm.size(), ranks.data(), nodeGroup,
+                                          nodeRanks.data());
+
+                MPI_Group_free(&group);
+                MPI_Group_free(&nodeGroup);
+            }
+            std::vector<SharedEntry> sendEntries;
+            std::vector<std::pair<int, int>> recvSources;
 
-            using memory_space = typename view_type::memory_space;
-            using buffer_type  = mpi::Communicator::buffer_type<memory_space>;
-            std::vector<MPI_Request> requests(totalRequests);
-            // sending loop
+            // sends
             constexpr size_t cubeCount = detail::countHypercubes(Dim) - 1;
             size_t requestIndex        = 0;
             for (size_t index = 0; index < cubeCount; index++) {
                 int tag                        = mpi::tag::HALO + index;
                 const auto& componentNeighbors = neighbors[index];
                 for (size_t i = 0; i < componentNeighbors.size(); i++) {
-                    int targetRank = componentNeighbors[i];
-
-                    bound_type range;
-                    if (order == INTERNAL_TO_HALO) {
-                        /*We store only the sending and receiving ranges
-                         * of INTERNAL_TO_HALO and use the fact that the
-                         * sending range of HALO_TO_INTERNAL is the receiving
-                         * range of INTERNAL_TO_HALO and vice versa
-                         */
-                        range = sendRanges[index][i];
-                    } else if (order == HALO_TO_INTERNAL_NOGHOST) {
-                        range = recvRanges[index][i];
-
-                        for (size_t j = 0; j < Dim; ++j) {
-                            const int stride = ldomains[me][j].stride();
-
-                            const int globalLo =
-                                ldomains[me][j].first() + (range.lo[j] - nghost) * stride;
-                            const int globalHi =
-                                ldomains[me][j].first() + (range.hi[j] - 1 - nghost) * stride;
-
-                            bool isLower = (globalLo == domain[j].min());
-                            bool isUpper = (globalHi == domain[j].max());
-
-                            range.lo[j] += isLower * (nghost);
-                            range.hi[j] -= isUpper * (nghost);
-                        }
-                    } else {
-                        range = recvRanges[index][i];
-                    }
+                    bound_type range = getExchangeRange(layout, order, index, i, nghost, true);
+                    size_type nbytes = range.size() * elemSize;
 
-                    size_type nsends;
-                    pack(range, view, haloData_m, nsends);
+                    if (shared && nodeRanks[componentNeighbors[i]] != MPI_UNDEFINED) {
+                        sendEntries.push_back({nodeRanks[componentNeighbors[i]], tag, 0, nbytes});
+                        plan->sharedSends.push_back({range, {}});
+                        continue;
+                    }
 
-                    buffer_type buf = comm.template getBuffer<memory_space, T>(nsends);
+                    auto buf = std::make_shared<archive_type>(nbytes);
+                    comm.send_init(componentNeighbors[i], tag, *buf,
+                                   plan->requests[requestIndex++], nbytes);
 
-                    comm.isend(targetRank, tag, haloData_m, *buf, requests[requestIndex++], nsends);
-                    buf->resetWritePos();
+                    plan->sendRanges.push_back(range);
+                    plan->sendBuffers.push_back(buf);
                 }
             }
 
-            // receiving loop
+            // receives
             for (size_t index = 0; index < cubeCount; index++) {
                 int tag                        = mpi::tag::HALO + Layout_t::getMatchingIndex(index);
                 const auto& componentNeighbors = neighbors[index];
                 for (size_t i = 0; i < componentNeighbors.size(); i++) {
-                    int sourceRank = componentNeighbors[i];
+                    bound_type range = getExchangeRange(layout, order, index, i, nghost, false);
+                    size_type nbytes = range.size() * elemSize;
 
-                    bound_type range;
-                    if (order == INTERNAL_TO_HALO) {
-                        range = recvRanges[index][i];
-                    } else if (order == HALO_TO_INTERNAL_NOGHOST) {
-                        range = sendRanges[index][i];
+                    if (shared && nodeRanks[componentNeighbors[i]] != MPI_UNDEFINED) {
+                        recvSources.emplace_back(nodeRanks[componentNeighbors[i]], tag);
+                        plan->sharedRecvs.push_back({range, {}});
+                        continue;
+                    }
+
+                    auto buf = std::make_shared<archive_type>(nbytes);
+                    comm.recv_init(componentNeighbors[i], tag, *buf,
+                                   plan->requests[requestIndex++], nbytes);
 
-                        for (size_t j = 0; j < Dim; ++j) {
-                            const int stride = ldomains[me][j].stride();
+                    plan->recvRanges.push_back(range);
+                    plan->recvBuffers.push_back(buf);
+                }
+            }
+            plan->requests.resize(requestIndex);
 
-                            const int globalLo =
-                                ldomains[me][j].first() + (range.lo[j] - nghost) * stride;
-                            const int globalHi =
-                                ldomains[me][j].first() + (range.hi[j] - 1 - nghost) * stride;
+            if (shared) {
+                setupSharedMemory(*plan, sendEntries, recvSources);
+            }
 
-                            bool isLower = (globalLo == domain[j].min());
-                            bool isUpper = (globalHi == domain[j].max());
+            return plan;
+        }
 
-                            range.lo[j] += isLower * (nghost);
-                            range.hi[j] -= isUpper * (nghost);
-                        }
-                    } else {
-                        range = sendRanges[index][i];
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::setupSharedMemory(
+            HaloPlan& plan, std::vector<SharedEntry>& sendEntries,
+            const std::vector<std::pair<int, int>>& recvSources) {
+            // Messages start on separate cache lines
+            constexpr size_type alignment = 64;
+            auto align = [](size_type n) {
+                return (n + alignment - 1) / alignment * alignment;
+            };
+
+            // Segment layout: number of messages, directory, both slots of every message
+            const size_type nsends = sendEntries.size();
+            size_type offset       = align(sizeof(size_type) + nsends * sizeof(SharedEntry));
+            for (auto& entry : sendEntries) {
+                entry.offset = offset;
+                offset += 2 * align(entry.nbytes);
+            }
+
+            auto pool          = plan.windows.lock();
+            auto [id, segment] = pool->acquire(offset);
+            plan.windowId      = id;
+            plan.window        = &pool->getWindow(id);
+
+            std::memcpy(segment, &nsends, sizeof(size_type));
+            if (nsends > 0) {
+                std::memcpy(segment + sizeof(size_type), sendEntries.data(),
+                            nsends * sizeof(SharedEntry));
+            }
+            for (size_type k = 0; k < nsends; ++k) {
+                char* message             = segment + sendEntries[k].offset;
+                plan.sharedSends[k].slots = {message, message + align(sendEntries[k].nbytes)};
+            }
+
+            // The directories must be complete before they are read
+            plan.window->sync();
+            MPI_Barrier(plan.nodeComm);
+            plan.window->sync();
+
+            int nodeRank;
+            MPI_Comm_rank(plan.nodeComm, &nodeRank);
+
+            const size_t elemSize = plan.truncated ? sizeof(truncated_type) : sizeof(T);
+
+            // Messages with the same source and tag are matched in the order in which they were
+            // added, as MPI would
+            std::map<std::pair<int, int>, size_type> matched;
+            for (size_t k = 0; k < recvSources.size(); ++k) {
+                const auto [source, tag] = recvSources[k];
+                size_type skip           = matched[recvSources[k]]++;
+
+                char* sourceSegment = plan.window->template sharedQuery<char>(source);
+                size_type count;
+                std::memcpy(&count, sourceSegment, sizeof(size_type));
+
+                bool found = false;
+                for (size_type e = 0; e < count && !found; ++e) {
+                    SharedEntry entry;
+                    std::memcpy(&entry, sourceSegment + sizeof(size_type) + e * sizeof(SharedEntry),
+                                sizeof(SharedEntry));
+                    if (entry.dest != nodeRank || entry.tag != tag) {
+                        continue;
+                    }
+                    if (skip > 0) {
+                        --skip;
+                        continue;
+                    }
+                    if (entry.nbytes != plan.sharedRecvs[k].range.size() * elemSize) {
+                        throw IpplException("HaloCells::setupSharedMemory",
+                                            "Message size differs from the neighbor's.");
                     }
+                    char* message             = sourceSegment + entry.offset;
+                    plan.sharedRecvs[k].slots = {message, message + align(entry.nbytes)};
+                    found                     = true;
+                }
+                if (!found) {
+                    throw IpplException("HaloCells::setupSharedMemory",
+                                        "Message of an on-node neighbor not found.");
+                }
+            }
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        void HaloCells<T, Dim, ViewArgs...>::beginExchange(view_type& view, Layout_t* layout,
+                                                           SendOrder order, int nghost) {
+            if (pending_m.active) {
+                throw IpplException("HaloCells::beginExchange",
+                                    "A halo exchange is already in progress for this field.");
+            }
+
+            auto plan = getPlan(layout, order, nghost);
+            if (plan->active) {
+                // started through a copy of this field, which shares the persistent requests
+                throw IpplException("HaloCells::beginExchange",
+                                    "A halo exchange is already in progress for a copy of this "
+                                    "field.");
+            }
+            plan->active     = true;
+            pending_m.plan   = plan;
+            pending_m.active = true;
+
+            const size_t nsends = plan->sendRanges.size();
+            const size_t nrecvs = plan->recvRanges.size();
+
+            // post the receives first so that they are matched as early as possible
+            if (nrecvs > 0) {
+                MPI_Startall(nrecvs, plan->requests.data() + nsends);
+            }
+
+            // pack straight into the send buffers and start each send as soon as its data is
+            // ready
+            for (size_t s = 0; s < nsends; ++s) {
+                const bound_type& range = plan->sendRanges[s];
+
+                auto& buf = *plan->sendBuffers[s];
+                if (plan->truncated) {
+                    packTo(range, view, buf.template writeView<truncated_type>(range.size()));
+                } else {
+                    packTo(range, view, buf.template writeView<T>(range.size()));
+                }
+                buf.resetWritePos();
 
-                    size_type nrecvs = range.size();
+                MPI_Start(&plan->requests[s]);
+            }
+
+            // messages to on-node neighbors are packed straight into shared memory
+            for (const auto& message : plan->sharedSends) {
+                const bound_type& range = message.range;
+                char* data              = message.slots[plan->slot];
+                if (plan->truncated) {
+                    packTo(range, view,
+                           shared_view_type<truncated_type>(
+                               reinterpret_cast<truncated_type*>(data), range.size()));
+                } else {
+                    packTo(range, view,
+                           shared_view_type<T>(reinterpret_cast<T*>(data), range.size()));
+                }
+            }
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        template <class Op>
+        void HaloCells<T, Dim, ViewArgs...>::endExchange(view_type& view) {
+            if (!pending_m.active) {
+                throw IpplException("HaloCells::endExchange",
+                                    "No halo exchange has been started for this field.");
+            }
+
+            auto& plan          = *pending_m.plan;
+            const size_t nsends = plan.sendRanges.size();
+            const int nrecvs    = static_cast<int>(plan.recvRanges.size());
+
+            if (plan.shared) {
+                // wait until all ranks of the node have packed their messages
+                plan.window->sync();
+                MPI_Barrier(plan.nodeComm);
+                plan.window->sync();
+
+                for (const auto& message : plan.sharedRecvs) {
+                    const bound_type& range = message.range;
+                    char* data              = message.slots[plan.slot];
+                    if (plan.truncated) {
+                        unpackFrom<Op>(range, view,
+                                       shared_view_type<truncated_type>(
+                                           reinterpret_cast<truncated_type*>(data), range.size()));
+                    } else {
+                        unpackFrom<Op>(
+                            range, view,
+                            shared_view_type<T>(reinterpret_cast<T*>(data), range.size()));
+                    }
+                }
+                // These slots are packed again two exchanges later, after the barrier of the
+                // next exchange, which the readers only reach once they are done with them
+                plan.slot ^= 1;
+            }
 
-                    buffer_type buf = comm.template getBuffer<memory_space, T>(nrecvs);
+            // unpack the messages in the order in which they arrive
+            MPI_Request* recvRequests = plan.requests.data() + nsends;
+            for (int n = 0; n < nrecvs; ++n) {
+                int completed;
+                MPI_Waitany(nrecvs, recvRequests, &completed, MPI_STATUS_IGNORE);
 
-                    comm.recv(sourceRank, tag, haloData_m, *buf, nrecvs * sizeof(T), nrecvs);
-                    buf->resetReadPos();
+                auto& buf              = *plan.recvBuffers[completed];
+                const bound_type range = plan.recvRanges[completed];
 
-                    unpack<Op>(range, view, haloData_m);
+                if (plan.truncated) {
+                    unpackFrom<Op>(range, view,
+                                   buf.template readView<truncated_type>(range.size()));
+                } else {
+                    unpackFrom<Op>(range, view, buf.template readView<T>(range.size()));
                 }
+                buf.resetReadPos();
             }
 
-            if (totalRequests > 0) {
-                MPI_Waitall(totalRequests, requests.data(), MPI_STATUSES_IGNORE);
+            if (nsends > 0) {
+                MPI_Waitall(nsends, plan.requests.data(), MPI_STATUSES_IGNORE);
             }
 
-            comm.freeAllBuffers();
+            plan.active = false;
+            pending_m.plan.reset();
+            pending_m.active = false;
         }
 
         template <typename T, unsigned Dim, class... ViewArgs>
         void HaloCells<T, Dim, ViewArgs...>::pack(const bound_type& range, const view_type& view,
                                                   databuffer_type& fd, size_type& nsends) {
-            auto subview = makeSubview(view, range);
-
             auto& buffer = fd.buffer;
-            size_t size  = subview.size();
+            size_t size  = range.size();
             nsends       = size;
             if (buffer.size() < size) {
                 int overalloc = Comm->getDefaultOverallocation();
                 Kokkos::realloc(buffer, size * overalloc);
             }
 
+            packTo(range, view, buffer);
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        template <typename Buffer>
+        void HaloCells<T, Dim, ViewArgs...>::packTo(const bound_type& range,
+                                                    const view_type& view, const Buffer& buffer) {
+            auto subview = makeSubview(view, range);
+
             using index_array_type =
                 typename RangePolicy<Dim, typename view_type::execution_space>::index_array_type;
-            using buffer_view_type = typename databuffer_type::view_type;
             using functor_type =
-                HaloPackFunctor<decltype(subview), buffer_view_type, index_array_type, Dim>;
+                HaloPackFunctor<decltype(subview), Buffer, index_array_type, Dim>;
             ippl::parallel_for("HaloCells::pack()", getRangePolicy(subview),
                                functor_type{subview, buffer});
             Kokkos::fence();
@@ -268,8 +565,15 @@ namespace ippl {
         template <typename Op>
         void HaloCells<T, Dim, ViewArgs...>::unpack(const bound_type& range, const view_type& view,
                                                     databuffer_type& fd) {
+            unpackFrom<Op>(range, view, fd.buffer);
+        }
+
+        template <typename T, unsigned Dim, class... ViewArgs>
+        template <typename Op, typename Buffer>
+        void HaloCells<T, Dim, ViewArgs...>::unpackFrom(const bound_type& range,
+                                                        const view_type& view,
+                                                        const Buffer& buffer) {
             auto subview = makeSubview(view, range);
-            auto buffer  = fd.buffer;
 
             // 29. November 2020
             // https://stackoverflow.com/questions/3735398/operator-as-template-parameter
@@ -278,7 +582,7 @@ namespace ippl {
             using index_array_type =
                 typename RangePolicy<Dim, typename view_type::execution_space>::index_array_type;
             using functor_type =
-                HaloUnpackFunctor<decltype(subview), decltype(buffer), Op, index_array_type, Dim>;
+                HaloUnpackFunctor<decltype(subview), Buffer, Op, index_array_type, Dim>;
             ippl::parallel_for("HaloCells::unpack()", getRangePolicy(subview),
                                functor_type{subview, buffer, op});
             Kokkos::fence();
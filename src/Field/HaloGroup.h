@@ -0,0 +1,164 @@
+//
+// Class HaloGroup
+//   Fused halo exchange for several fields sharing a field layout.
+//
+#ifndef IPPL_HALO_GROUP_H
+#define IPPL_HALO_GROUP_H
+
+#include <memory>
+#include <vector>
+
+#include "Types/IpplTypes.h"
+
+#include "Communicate/Archive.h"
+#include "FieldLayout/FieldLayout.h"
+
+namespace ippl {
+    namespace detail {
+        /*!
+         * Type-erased interface of a field registered in a HaloGroup.
+         * @tparam Dim field dimension
+         * @tparam MemorySpace memory space of the communication buffers
+         */
+        template <unsigned Dim, class MemorySpace>
+        class HaloGroupMember {
+        public:
+            using Layout_t     = FieldLayout<Dim>;
+            using bound_type   = typename Layout_t::bound_type;
+            using archive_type = Archive<MemorySpace>;
+
+            virtual ~HaloGroupMember() = default;
+
+            virtual Layout_t& getLayout() const = 0;
+
+            virtual int getNghost() const = 0;
+
+            /*!
+             * @param range the bounds of the region to exchange
+             * @returns the number of bytes this field contributes to a message
+             */
+            virtual size_type messageSize(const bound_type& range) const = 0;
+
+            /*!
+             * Append the field data in the given range to the archive.
+             */
+            virtual void pack(const bound_type& range, archive_type& ar) = 0;
+
+            /*!
+             * Read the field data for the given range from the archive and assign
+             * (fill) or add (accumulate) it.
+             */
+            virtual void unpack(const bound_type& range, archive_type& ar, bool accumulate) = 0;
+
+            /*!
+             * Apply the periodic boundary conditions of the serial dimensions.
+             */
+            virtual void applyPeriodicSerialDim(bool accumulate) = 0;
+        };
+
+        /*!
+         * HaloGroup member for a concrete field type. Packing and unpacking
+         * is delegated to the field's own HaloCells.
+         * @tparam Field the field type (BareField or Field)
+         * @tparam MemorySpace memory space of the communication buffers
+         */
+        template <class Field, class MemorySpace>
+        class HaloGroupFieldMember : public HaloGroupMember<Field::dim, MemorySpace> {
+        public:
+            using base_type = HaloGroupMember<Field::dim, MemorySpace>;
+            using typename base_type::archive_type;
+            using typename base_type::bound_type;
+            using typename base_type::Layout_t;
+
+            using halo_type       = typename Field::halo_type;
+            using value_type      = typename Field::value_type;
+            using databuffer_type = typename halo_type::databuffer_type;
+
+            HaloGroupFieldMember(Field& field)
+                : field_m(&field) {}
+
+            Layout_t& getLayout() const override { return field_m->getLayout(); }
+
+            int getNghost() const override { return field_m->getNghost(); }
+
+            size_type messageSize(const bound_type& range) const override {
+                return range.size() * sizeof(value_type);
+            }
+
+            void pack(const bound_type& range, archive_type& ar) override;
+
+            void unpack(const bound_type& range, archive_type& ar, bool accumulate) override;
+
+            void applyPeriodicSerialDim(bool accumulate) override;
+
+        private:
+            Field* field_m;
+            databuffer_type buffer_m;
+        };
+    }  // namespace detail
+
+    /*!
+     * A HaloGroup exchanges the halo cells of several fields at once. The data
+     * of all registered fields is packed into a single message per neighbor,
+     * which reduces the number of messages by the number of fields. The fields
+     * may have different value types, but must share the same field layout
+     * and number of ghost cells, and live in the same memory space.
+     *
+     * Usage:
+     *   HaloGroup<3> group;
+     *   group.add(rho);
+     *   group.add(E);
+     *   group.fillHalo();
+     *
+     * @tparam Dim field dimension
+     * @tparam MemorySpace memory space of the fields
+     */
+    template <unsigned Dim, class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+    class HaloGroup {
+    public:
+        using Layout_t     = FieldLayout<Dim>;
+        using bound_type   = typename Layout_t::bound_type;
+        using member_type  = detail::HaloGroupMember<Dim, MemorySpace>;
+        using archive_type = typename member_type::archive_type;
+
+        HaloGroup() = default;
+
+        /*!
+         * Register a field. The field must stay alive as long as the group is used.
+         * @param field the field to add
+         */
+        template <class Field>
+        void add(Field& field);
+
+        /*!
+         * Remove all registered fields.
+         */
+        void clear() { members_m.clear(); }
+
+        size_t size() const { return members_m.size(); }
+
+        /*!
+         * Send internal data to the halo cells of all registered fields.
+         */
+        void fillHalo() { exchange(false); }
+
+        /*!
+         * Add the halo data of all registered fields to the internal cells.
+         */
+        void accumulateHalo() { exchange(true); }
+
+    private:
+        /*!
+         * Exchange the halo data of all fields with one message per neighbor.
+         * @param accumulate whether halo data is added to internal cells
+         * (HALO_TO_INTERNAL) or internal data is copied to halo cells (INTERNAL_TO_HALO)
+         */
+        void exchange(bool accumulate);
+
+        std::vector<std::unique_ptr<member_type>> members_m;
+    };
+}  // namespace ippl
+
+#include "Field/HaloGroup.hpp"
+
+#endif
@@ -0,0 +1,192 @@
+//
+// Class HaloGroup
+//   Fused halo exchange for several fields sharing a field layout.
+//
+
+#include <type_traits>
+
+#include "Utility/IpplException.h"
+
+#include "Communicate/Communicator.h"
+
+namespace ippl {
+    namespace detail {
+        template <class Field, class MemorySpace>
+        void HaloGroupFieldMember<Field, MemorySpace>::pack(const bound_type& range,
+                                                            archive_type& ar) {
+            size_type nsends;
+            field_m->getHalo().pack(range, field_m->getView(), buffer_m, nsends);
+            buffer_m.serialize(ar, nsends);
+        }
+
+        template <class Field, class MemorySpace>
+        void HaloGroupFieldMember<Field, MemorySpace>::unpack(const bound_type& range,
+                                                              archive_type& ar, bool accumulate) {
+            buffer_m.deserialize(ar, range.size());
+
+            auto& halo = field_m->getHalo();
+            if (accumulate) {
+                halo.template unpack<typename halo_type::lhs_plus_assign>(
+                    range, field_m->getView(), buffer_m);
+            } else {
+                halo.template unpack<typename halo_type::assign>(range, field_m->getView(),
+                                                                 buffer_m);
+            }
+        }
+
+        template <class Field, class MemorySpace>
+        void HaloGroupFieldMember<Field, MemorySpace>::applyPeriodicSerialDim(bool accumulate) {
+            auto& layout = field_m->getLayout();
+            if (!layout.isAllPeriodic_m) {
+                return;
+            }
+
+            auto& halo = field_m->getHalo();
+            if (accumulate) {
+                halo.template applyPeriodicSerialDim<typename halo_type::rhs_plus_assign>(
+                    field_m->getView(), &layout, field_m->getNghost());
+            } else {
+                halo.template applyPeriodicSerialDim<typename halo_type::assign>(
+                    field_m->getView(), &layout, field_m->getNghost());
+            }
+        }
+    }  // namespace detail
+
+    template <unsigned Dim, class MemorySpace>
+    template <class Field>
+    void HaloGroup<Dim, MemorySpace>::add(Field& field) {
+        static_assert(Field::dim == Dim, "HaloGroup: field dimension does not match");
+        static_assert(std::is_same_v<typename Field::memory_space, MemorySpace>,
+                      "HaloGroup: field memory space does not match");
+
+        if (!members_m.empty()) {
+            const auto& first = *members_m.front();
+            if (&first.getLayout() != &field.getLayout()) {
+                throw IpplException("HaloGroup::add",
+                                    "All fields in a halo group must share the same layout.");
+            }
+            if (first.getNghost() != field.getNghost()) {
+                throw IpplException(
+                    "HaloGroup::add",
+                    "All fields in a halo group must have the same number of ghost cells.");
+            }
+        }
+
+        members_m.push_back(
+            std::make_unique<detail::HaloGroupFieldMember<Field, MemorySpace>>(field));
+    }
+
+    template <unsigned Dim, class MemorySpace>
+    void HaloGroup<Dim, MemorySpace>::exchange(bool accumulate) {
+        using neighbor_list = typename Layout_t::neighbor_list;
+        using range_list    = typename Layout_t::neighbor_range_list;
+        using buffer_type   = mpi::Communicator::buffer_type<MemorySpace>;
+
+        if (members_m.empty()) {
+            return;
+        }
+
+        Layout_t& layout = members_m.front()->getLayout();
+        auto& comm       = layout.comm;
+
+        if (comm.size() > 1) {
+            auto ldom = layout.getLocalNDIndex();
+            for (const auto& axis : ldom) {
+                if ((axis.length() == 1) && (Dim != 1)) {
+                    throw IpplException(
+                        "HaloGroup::exchange",
+                        "Cannot do neighbour exchange when domain decomposition contains planes.");
+                }
+            }
+
+            const neighbor_list& neighbors = layout.getNeighbors();
+
+            // The sending range of HALO_TO_INTERNAL is the receiving range
+            // of INTERNAL_TO_HALO and vice versa
+            const range_list& sendRanges =
+                accumulate ? layout.getNeighborsRecvRange() : layout.getNeighborsSendRange();
+            const range_list& recvRanges =
+                accumulate ? layout.getNeighborsSendRange() : layout.getNeighborsRecvRange();
+
+            auto messageSize = [&](const bound_type& range) {
+                size_type nbytes = 0;
+                for (const auto& member : members_m) {
+                    nbytes += member->messageSize(range);
+                }
+                return nbytes;
+            };
+
+            size_t totalRequests = 0;
+            for (const auto& componentNeighbors : neighbors) {
+                totalRequests += componentNeighbors.size();
+            }
+
+            std::vector<MPI_Request> requests(2 * totalRequests, MPI_REQUEST_NULL);
+            std::vector<buffer_type> buffers;
+            std::vector<bound_type> ranges;
+            buffers.reserve(2 * totalRequests);
+            ranges.reserve(totalRequests);
+
+            constexpr size_t cubeCount = detail::countHypercubes(Dim) - 1;
+
+            // post all receives first
+            size_t requestIndex = 0;
+            for (size_t index = 0; index < cubeCount; index++) {
+                int tag = mpi::tag::HALO_GROUP + Layout_t::getMatchingIndex(index);
+                const auto& componentNeighbors = neighbors[index];
+                for (size_t i = 0; i < componentNeighbors.size(); i++) {
+                    const bound_type& range = recvRanges[index][i];
+                    size_type nbytes        = messageSize(range);
+
+                    buffer_type buf = comm.template getBuffer<MemorySpace>(nbytes);
+                    comm.irecv(componentNeighbors[i], tag, *buf, requests[requestIndex++],
+                               nbytes);
+                    buffers.push_back(buf);
+                    ranges.push_back(range);
+                }
+            }
+
+            // pack all fields into one message per neighbor
+            for (size_t index = 0; index < cubeCount; index++) {
+                int tag                        = mpi::tag::HALO_GROUP + index;
+                const auto& componentNeighbors = neighbors[index];
+                for (size_t i = 0; i < componentNeighbors.size(); i++) {
+                    const bound_type& range = sendRanges[index][i];
+
+                    buffer_type buf = comm.template getBuffer<MemorySpace>(messageSize(range));
+                    for (auto& member : members_m) {
+                        member->pack(range, *buf);
+                    }
+                    comm.isend(componentNeighbors[i], tag, *buf, requests[requestIndex++]);
+                    buffers.push_back(buf);
+                }
+            }
+
+            // unpack in the order in which the messages arrive
+            const int nrecvs = static_cast<int>(totalRequests);
+            for (int n = 0; n < nrecvs; ++n) {
+                int completed;
+                MPI_Waitany(nrecvs, requests.data(), &completed, MPI_STATUS_IGNORE);
+
+                buffer_type& buf = buffers[completed];
+                for (auto& member : members_m) {
+                    member->unpack(ranges[completed], *buf, accumulate);
+                }
+                buf->resetReadPos();
+            }
+
+            if (totalRequests > 0) {
+                MPI_Waitall(totalRequests, requests.data() + totalRequests, MPI_STATUSES_IGNORE);
+            }
+
+            for (auto& buf : buffers) {
+                buf->resetWritePos();
+                comm.template freeBuffer<MemorySpace>(buf);
+            }
+        }
+
+        for (auto& member : members_m) {
+            member->applyPeriodicSerialDim(accumulate);
+        }
+    }
+}  // namespace ippl
@@ -16,6 +16,7 @@
 #include "Types/ViewTypes.h"
 
 #include "Communicate/Communicator.h"
+#include "Communicate/SharedWindowPool.h"
 #include "Index/NDIndex.h"
 #include "Partition/Partitioner.h"
 
@@ -339,6 +340,38 @@ namespace ippl {
 
         void updateLayout(const std::vector<NDIndex_t>& domains);
 
+        /*!
+         * Enable or disable the node-aware mapping of local domains to ranks. The partitioner
+         * numbers the local domains such that consecutive indices form compact blocks of the
+         * global domain. With the node-aware mapping, these indices are assigned to the ranks
+         * grouped by shared-memory node instead of in rank order, so that most neighbors of a
+         * rank reside on the same node. The rank numbering of the communicator is unchanged.
+         * If the layout is already initialized, its local domains are remapped; this must
+         * happen before any fields are created on the layout.
+         * @param nodeAware whether to group the local domains by node
+         */
+        void setNodeAwareMapping(bool nodeAware);
+
+        bool isNodeAwareMapping() const { return nodeAware_m; }
+
+        /*!
+         * Get the version of the neighbor lists and ranges. The version changes
+         * whenever the neighbors are recomputed (e.g. by updateLayout), and is
+         * unique among all layouts, so that cached communication plans can
+         * detect that they are out of date.
+         * @return Current layout version
+         */
+        unsigned long getVersion() const { return version_m; }
+
+        /*!
+         * Shared-memory windows of the ranks on the same node, used by the halo exchange
+         * of fields on this layout (see HaloCells::setSharedMemoryExchange). Copies of the
+         * layout share the pool, which is freed collectively with the last of them.
+         */
+        std::shared_ptr<mpi::rma::SharedWindowPool> getSharedWindows() const {
+            return sharedWindows_m;
+        }
+
         bool isAllPeriodic_m;
 
         mpi::Communicator comm;
@@ -358,6 +391,12 @@ namespace ippl {
 
         int getPeriodicOffset(const NDIndex_t& nd, const unsigned int d, const int k);
 
+        /*!
+         * Groups the ranks by shared-memory node, ordered by the lowest rank on each node
+         * @return The rank that owns the local domain with the given partition index
+         */
+        std::vector<int> getNodeOrder() const;
+
         // List of all the neighboring ranks, arranged by ternary encoding
         neighbor_list neighbors_m;
 
@@ -383,6 +422,17 @@ namespace ippl {
         // Nghost needed for computing send/receive ranges
         int nghost_m;
 
+        // Whether local domains are assigned to ranks grouped by node
+        bool nodeAware_m = false;
+
+        // Version of the neighbor lists, see getVersion()
+        unsigned long version_m = 0;
+
+        // Node communicator and shared windows, see getSharedWindows()
+        std::shared_ptr<mpi::rma::SharedWindowPool> sharedWindows_m;
+
+        static inline unsigned long versionCounter_m = 0;
+
         void calcWidths();
     };
 
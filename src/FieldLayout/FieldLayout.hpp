@@ -7,8 +7,10 @@
 //
 #include "Ippl.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <limits>
+#include <numeric>
 
 #include "Utility/IpplException.h"
 #include "Utility/IpplTimings.h"
@@ -38,7 +40,8 @@ namespace ippl {
         : comm(communicator)
         , dLocalDomains_m("local domains (device)", 0)
         , hLocalDomains_m(Kokkos::create_mirror_view(dLocalDomains_m))
-        , nghost_m(1) {
+        , nghost_m(1)
+        , sharedWindows_m(std::make_shared<mpi::rma::SharedWindowPool>(comm)) {
         for (unsigned int d = 0; d < Dim; ++d) {
             minWidth_m[d] = 0;
         }
@@ -113,7 +116,17 @@ namespace ippl {
         Kokkos::resize(hLocalDomains_m, nRanks);
 
         detail::Partitioner<Dim> partitioner;
-        partitioner.split(domain, hLocalDomains_m, isParallel, nRanks);
+        if (nodeAware_m) {
+            host_mirror_type partition("partition", nRanks);
+            partitioner.split(domain, partition, isParallel, nRanks);
+
+            const std::vector<int> order = getNodeOrder();
+            for (int k = 0; k < nRanks; ++k) {
+                hLocalDomains_m(order[k]) = partition(k);
+            }
+        } else {
+            partitioner.split(domain, hLocalDomains_m, isParallel, nRanks);
+        }
 
         findNeighbors(nghost);
 
@@ -122,6 +135,51 @@ namespace ippl {
         calcWidths();
     }
 
+    template <unsigned Dim>
+    void FieldLayout<Dim>::setNodeAwareMapping(bool nodeAware) {
+        if (nodeAware == nodeAware_m) {
+            return;
+        }
+        nodeAware_m = nodeAware;
+
+        const int nRanks = hLocalDomains_m.extent(0);
+        if (nRanks < 2) {
+            return;
+        }
+
+        // The current domains are in the other mapping; permute them instead of partitioning
+        // again so that the sub-domains of a SubFieldLayout are preserved
+        const std::vector<int> order = getNodeOrder();
+        std::vector<NDIndex_t> domains(nRanks);
+        for (int k = 0; k < nRanks; ++k) {
+            if (nodeAware) {
+                domains[order[k]] = hLocalDomains_m(k);
+            } else {
+                domains[k] = hLocalDomains_m(order[k]);
+            }
+        }
+        updateLayout(domains);
+    }
+
+    template <unsigned Dim>
+    std::vector<int> FieldLayout<Dim>::getNodeOrder() const {
+        MPI_Comm nodeComm = sharedWindows_m->getNodeComm();
+
+        // Every node is identified by its lowest rank
+        int leader = comm.rank();
+        MPI_Bcast(&leader, 1, MPI_INT, 0, nodeComm);
+
+        std::vector<int> leaders(comm.size());
+        MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, comm);
+
+        std::vector<int> order(comm.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return leaders[a] < leaders[b];
+        });
+        return order;
+    }
+
     template <unsigned Dim>
     const typename FieldLayout<Dim>::NDIndex_t& FieldLayout<Dim>::getLocalNDIndex() const {
         return hLocalDomains_m(comm.rank());
@@ -245,6 +303,9 @@ namespace ippl {
             neighborsRecvRange_m[i].clear();
         }
 
+        // invalidate communication plans built for the previous neighbors
+        version_m = ++versionCounter_m;
+
         int myRank = comm.rank();
 
         // get my local box
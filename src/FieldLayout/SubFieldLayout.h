@@ -58,9 +58,10 @@ namespace ippl {
          * @param subDomain The sub-region within the full domain, which is partitioned in the same way as the fullomain
          * @param decomp Array specifying which dimensions should be parallel
          * @param isAllPeriodic Whether all dimensions have periodic boundary conditions
+         * @param nghost Number of ghost cells (default 1)
          */
         SubFieldLayout(mpi::Communicator, const NDIndex<Dim>& domain, const NDIndex<Dim>& subDomain, std::array<bool, Dim> decomp,
-                    bool isAllPeriodic = false);
+                    bool isAllPeriodic = false, int nghost = 1);
 
         /**
          * @brief Constructor for full-domain layout.
@@ -69,9 +70,10 @@ namespace ippl {
          * @param domain The full domain that defines the partitioning and is used as the sub-domain simultaneously
          * @param decomp Array specifying which dimensions should be parallel
          * @param isAllPeriodic Whether all dimensions have periodic boundary conditions
+         * @param nghost Number of ghost cells (default 1)
          */
         SubFieldLayout(mpi::Communicator, const NDIndex<Dim>& domain, std::array<bool, Dim> decomp,
-                    bool isAllPeriodic = false);
+                    bool isAllPeriodic = false, int nghost = 1);
 
         /**
          * @brief Destructor: Everything deletes itself automatically
@@ -86,9 +88,10 @@ namespace ippl {
          * @param subDomain The sub-region within the full domain
          * @param decomp Array specifying which dimensions should be parallel
          * @param isAllPeriodic Whether all dimensions have periodic boundary conditions
+         * @param nghost Number of ghost cells (default 1)
          */
         void initialize(const NDIndex<Dim>& domain, const NDIndex<Dim>& subDomain, std::array<bool, Dim> decomp,
-            bool isAllPeriodic = false);
+            bool isAllPeriodic = false, int nghost = 1);
             
         /**
          * @brief Initializes a SubFieldLayout using the domain as both the full domain and sub-domain
@@ -96,9 +99,10 @@ namespace ippl {
          * @param domain The domain to be partitioned
          * @param decomp Array specifying which dimensions should be parallel
          * @param isAllPeriodic Whether all dimensions have periodic boundary conditions
+         * @param nghost Number of ghost cells (default 1)
          */
         void initialize(const NDIndex<Dim>& domain, std::array<bool, Dim> decomp,
-            bool isAllPeriodic = false);
+            bool isAllPeriodic = false, int nghost = 1);
 
         /**
          * @brief Return the original domain before sub-region extraction
@@ -44,9 +44,10 @@ namespace ippl {
     template <unsigned Dim>
     SubFieldLayout<Dim>::SubFieldLayout(mpi::Communicator communicator, const NDIndex<Dim>& domain,
                                         const NDIndex<Dim>& subDomain,
-                                        std::array<bool, Dim> isParallel, bool isAllPeriodic)
+                                        std::array<bool, Dim> isParallel, bool isAllPeriodic,
+                                        int nghost)
         : FieldLayout<Dim>(communicator) {
-        initialize(domain, subDomain, isParallel, isAllPeriodic);
+        initialize(domain, subDomain, isParallel, isAllPeriodic, nghost);
     }
 
     /**
@@ -59,9 +60,10 @@ namespace ippl {
      */
     template <unsigned Dim>
     SubFieldLayout<Dim>::SubFieldLayout(mpi::Communicator communicator, const NDIndex<Dim>& domain,
-                                        std::array<bool, Dim> isParallel, bool isAllPeriodic)
+                                        std::array<bool, Dim> isParallel, bool isAllPeriodic,
+                                        int nghost)
         : FieldLayout<Dim>(communicator) {
-        initialize(domain, isParallel, isAllPeriodic);
+        initialize(domain, isParallel, isAllPeriodic, nghost);
     }
 
     /**
@@ -78,13 +80,14 @@ namespace ippl {
      */
     template <unsigned Dim>
     void SubFieldLayout<Dim>::initialize(const NDIndex<Dim>& domain, const NDIndex<Dim>& subDomain,
-                                         std::array<bool, Dim> isParallel, bool isAllPeriodic) {
+                                         std::array<bool, Dim> isParallel, bool isAllPeriodic,
+                                         int nghost) {
         // Ensure the sub-domain is contained within the main domain
         PAssert(domain.contains(subDomain));
 
         // Call the base class initialize method to set up the main domain and parallel
         // decomposition
-        FieldLayout<Dim>::initialize(domain, isParallel, isAllPeriodic);
+        FieldLayout<Dim>::initialize(domain, isParallel, isAllPeriodic, nghost);
 
         unsigned int nRanks = this->comm.size();
 
@@ -123,10 +126,11 @@ namespace ippl {
      */
     template <unsigned Dim>
     void SubFieldLayout<Dim>::initialize(const NDIndex<Dim>& domain,
-                                         std::array<bool, Dim> isParallel, bool isAllPeriodic) {
+                                         std::array<bool, Dim> isParallel, bool isAllPeriodic,
+                                         int nghost) {
         // Call the base class initialize method to set up the main domain and parallel
         // decomposition
-        FieldLayout<Dim>::initialize(domain, isParallel, isAllPeriodic);
+        FieldLayout<Dim>::initialize(domain, isParallel, isAllPeriodic, nghost);
 
         originDomain_m = domain;
     }
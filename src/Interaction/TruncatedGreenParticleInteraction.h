@@ -7,11 +7,16 @@
 //   It assumes that ParticleContainer implements a function forAllPairs() to iterate over all
 //   relevant particle pairs.
 //
+//   With the parameter 'shape' set to "table", the erfc and exp of the force are replaced by a
+//   tabulated interpolant whose relative error, estimated at sample points, is below
+//   'shape_tolerance'.
+//
 
 #ifndef IPPL_TRUNCATEDGREEN_SHORTRANGE_H
 #define IPPL_TRUNCATEDGREEN_SHORTRANGE_H
 
 #include "ParticleInteractionBase.h"
+#include "TruncatedGreenShapeTable.h"
 
 namespace ippl {
     /*!
@@ -40,6 +45,9 @@ namespace ippl {
          * @param params Parameters, containing at least 'alpha', 'force_constant' and 'rcut'. alpha
          * controls the truncation strength. force_constant to be multiplied with the force. rcut
          * determines the maximal distance between two particles to contribute to the forces.
+         * Optionally 'shape' ("exact" or "table", default "exact") selects how the force shape is
+         * evaluated and 'shape_tolerance' (default 1e-6) is the relative error of the table,
+         * estimated at sample points inside every interval.
          */
         TruncatedGreenParticleInteraction(const ParticleContainer& pc, VectorAttribute& F,
                                           const VectorAttribute& R, const ScalarAttribute& QM,
@@ -57,16 +65,32 @@ namespace ippl {
          */
         void solve() override;
 
+        /*!
+         * Evaluates the short range interactions with the given force shape g(r), see
+         * TruncatedGreenShapeTable.h.
+         * @tparam Shape functor returning g(r)
+         */
+        template <typename Shape>
+        void solve(const Shape& shape);
+
     private:
+        using shape_table_type =
+            detail::TruncatedGreenShapeTable<Scalar_t, typename execution_space::memory_space>;
+
         /*!
          * Helper function to compute the field = - q * forceConstant grad [(1 - erf(alpha *
          * r)) / r]. generated by an interacting particle
          */
+        template <typename Shape>
         KOKKOS_INLINE_FUNCTION static constexpr Vector_t fieldFromPair(const Vector_t& dist,
-                                                                       Scalar_t r2, Scalar_t alpha,
+                                                                       Scalar_t r2,
+                                                                       const Shape& shape,
                                                                        Scalar_t forceConstant,
                                                                        Scalar_t qm);
 
+        ///! Tabulated force shape, rebuilt when alpha, rcut or the tolerance change
+        shape_table_type shapeTable_m;
+
         ///! The electric or gravitational field
         VectorAttribute& Field_m;
         ///! Positions of the particles
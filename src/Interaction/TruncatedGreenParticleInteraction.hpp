@@ -10,27 +10,49 @@
 
 namespace ippl {
     template <typename ParticleContainer, typename ScalarAttribute, typename VectorAttribute>
+    template <typename Shape>
     KOKKOS_INLINE_FUNCTION constexpr
         typename TruncatedGreenParticleInteraction<ParticleContainer, ScalarAttribute,
                                                    VectorAttribute>::Vector_t
         TruncatedGreenParticleInteraction<ParticleContainer, ScalarAttribute,
                                           VectorAttribute>::fieldFromPair(const Vector_t& dist,
                                                                           Scalar_t r2,
-                                                                          Scalar_t alpha,
+                                                                          const Shape& shape,
                                                                           Scalar_t forceConstant,
                                                                           Scalar_t qm) {
         const Scalar_t r = Kokkos::sqrt(r2);
 
-        // F = - q * forceConstant grad [(1 - erf(alpha * r)) / r].
-        return forceConstant * qm * (dist / r)
-               * (2.0 * alpha * Kokkos::exp(-alpha * alpha * r2)
-                      / (Kokkos::sqrt(Kokkos::numbers::pi) * r)
-                  + (1.0 - Kokkos::erf(alpha * r)) / r2);
+        // F = - q * forceConstant grad [(1 - erf(alpha * r)) / r] = q * forceConstant * dist
+        // * g(r) / r^3
+        return forceConstant * qm * shape(r) / (r2 * r) * dist;
     }
 
     template <typename ParticleContainer, typename ScalarAttribute, typename VectorAttribute>
     void TruncatedGreenParticleInteraction<ParticleContainer, ScalarAttribute,
                                            VectorAttribute>::solve() {
+        const auto rcut  = this->params_m.template get<Scalar_t>("rcut");
+        const auto alpha = this->params_m.template get<Scalar_t>("alpha");
+        const auto shape = this->params_m.template get<std::string>("shape", "exact");
+
+        if (shape == "exact") {
+            solve(detail::TruncatedGreenExactShape<Scalar_t>{alpha});
+        } else if (shape == "table") {
+            const auto tolerance =
+                this->params_m.template get<Scalar_t>("shape_tolerance", Scalar_t(1e-6));
+            if (!shapeTable_m.matches(alpha, rcut, tolerance)) {
+                shapeTable_m = shape_table_type(alpha, rcut, tolerance);
+            }
+            solve(shapeTable_m);
+        } else {
+            throw IpplException("TruncatedGreenParticleInteraction::solve",
+                                "Unknown shape '" + shape + "', expected 'exact' or 'table'.");
+        }
+    }
+
+    template <typename ParticleContainer, typename ScalarAttribute, typename VectorAttribute>
+    template <typename Shape>
+    void TruncatedGreenParticleInteraction<ParticleContainer, ScalarAttribute,
+                                           VectorAttribute>::solve(const Shape& shape) {
         static IpplTimings::TimerRef solveTimer =
             IpplTimings::getTimer("TruncatedGreenParticleInteraction::solve()");
         IpplTimings::startTimer(solveTimer);
@@ -41,25 +63,43 @@ namespace ippl {
 
         // get simulation specific data
         const auto rcut2 = std::pow<Scalar_t>(this->params_m.template get<Scalar_t>("rcut"), 2);
-        const auto alpha = this->params_m.template get<Scalar_t>("alpha");
         const auto forceConstant = this->params_m.template get<Scalar_t>("force_constant");
 
         const auto& particleLayout = this->pc_m.getLayout();
 
-        particleLayout.template forEachPair<execution_space>(
-            KOKKOS_LAMBDA(const size_t& i, const size_t& j) {
+        if (particleLayout.getClusterSize() > 0) {
+            // Branch-free cluster pair kernel; i == j and padding are masked by the layout
+            particleLayout.template forEachClusterPair<execution_space>(
+                Field, KOKKOS_LAMBDA(const size_t& i, const size_t& j) {
+                    const Vector_t dist_ij = R(i) - R(j);
+                    const Scalar_t rsq_ij  = dist_ij.dot(dist_ij);
+
+                    return rsq_ij < rcut2
+                               ? Vector_t(-fieldFromPair(dist_ij, rsq_ij, shape, forceConstant,
+                                                         QM(j)))
+                               : Vector_t(Scalar_t(0));
+                });
+            IpplTimings::stopTimer(solveTimer);
+            return;
+        }
+
+        // Each pair is evaluated once; the field at j is the one of i with the opposite
+        // distance, i.e. the same expression with the charge of i and the opposite sign.
+        // The shape is therefore evaluated once per pair for a unit charge.
+        particleLayout.template forEachUniquePair<execution_space>(
+            Field, KOKKOS_LAMBDA(const size_t& i, const size_t& j, Vector_t& Fi, Vector_t& Fj) {
                 const Vector_t dist_ij = R(i) - R(j);
                 const Scalar_t rsq_ij  = dist_ij.dot(dist_ij);
 
                 if (rsq_ij >= rcut2) {
-                    return;
+                    return false;
                 }
 
-                const auto F_ij = fieldFromPair(dist_ij, rsq_ij, alpha, forceConstant, QM(j));
-
-                // add force to particle i, don't do it for j as the ranges of i and j are
-                // asymmetric
-                Kokkos::atomic_sub(&Field(i), F_ij);
+                const Vector_t f_ij =
+                    fieldFromPair(dist_ij, rsq_ij, shape, forceConstant, Scalar_t(1));
+                Fi -= f_ij * QM(j);
+                Fj += f_ij * QM(i);
+                return true;
             });
         IpplTimings::stopTimer(solveTimer);
     }
@@ -0,0 +1,108 @@
+//
+// Class TruncatedGreenShapeTable
+//   Force shapes of the truncated Green's function interaction. The field of a particle at distance
+//   r is forceConstant * q * dist * g(r) / r^3 with the dimensionless shape
+//
+//      g(r) = 2 * alpha * r * exp(-alpha^2 r^2) / sqrt(pi) + erfc(alpha * r),
+//
+//   which is smooth and bounded by one. TruncatedGreenExactShape evaluates g with exp and erfc,
+//   TruncatedGreenShapeTable replaces both by a piecewise cubic Hermite interpolant over [0, rcut].
+//
+
+#ifndef IPPL_TRUNCATEDGREEN_SHAPE_TABLE_H
+#define IPPL_TRUNCATEDGREEN_SHAPE_TABLE_H
+
+#include <Kokkos_Core.hpp>
+
+namespace ippl::detail {
+    /*!
+     * Evaluates the force shape g(r) with the exact special functions.
+     * @tparam T floating point type
+     */
+    template <typename T>
+    struct TruncatedGreenExactShape {
+        T alpha;
+
+        KOKKOS_INLINE_FUNCTION T operator()(T r) const {
+            const T ar = alpha * r;
+            return T(2) * ar * Kokkos::exp(-ar * ar) / Kokkos::sqrt(Kokkos::numbers::pi_v<T>)
+                   + Kokkos::erfc(ar);
+        }
+
+        /*!
+         * Derivative of the force shape with respect to r
+         */
+        KOKKOS_INLINE_FUNCTION T derivative(T r) const {
+            const T ar = alpha * r;
+            return -T(4) * alpha * ar * ar * Kokkos::exp(-ar * ar)
+                   / Kokkos::sqrt(Kokkos::numbers::pi_v<T>);
+        }
+    };
+
+    /*!
+     * Tabulated force shape g(r) on [0, rcut]. The table holds g and its derivative on equidistant
+     * nodes; evaluation is a cubic Hermite interpolation and needs neither exp nor erfc. The number
+     * of nodes is doubled until the relative error, sampled at seven points inside every interval
+     * against the exact shape, is below the requested tolerance. The error between the samples is
+     * not bounded, so the tolerance is a sampled estimate rather than a guarantee.
+     * @tparam T floating point type
+     * @tparam MemorySpace memory space of the table
+     */
+    template <typename T, typename MemorySpace>
+    class TruncatedGreenShapeTable {
+    public:
+        using view_type = Kokkos::View<T* [2], Kokkos::LayoutRight, MemorySpace>;
+        using size_type = typename view_type::size_type;
+
+        TruncatedGreenShapeTable() = default;
+
+        /*!
+         * @param alpha truncation strength
+         * @param rcut upper end of the tabulated range
+         * @param tolerance requested relative error of g at the sample points
+         * @param maxIntervals largest table size before giving up
+         * @throw IpplException if the tolerance cannot be met with maxIntervals intervals
+         */
+        TruncatedGreenShapeTable(T alpha, T rcut, T tolerance, size_type maxIntervals = 1 << 16);
+
+        KOKKOS_INLINE_FUNCTION T operator()(T r) const { return interpolate(table_m, invDr_m, r); }
+
+        /*!
+         * Interpolates g at r from the node values and scaled derivatives in table
+         */
+        template <typename View>
+        KOKKOS_INLINE_FUNCTION static T interpolate(const View& table, T invDr, T r) {
+            const T x         = r * invDr;
+            const size_type n = table.extent(0) - 1;
+            const size_type k = Kokkos::min(static_cast<size_type>(x), n - 1);
+            const T t         = x - static_cast<T>(k);
+            const T s         = T(1) - t;
+            return s * s * ((T(1) + T(2) * t) * table(k, 0) + t * table(k, 1))
+                   + t * t * ((T(1) + T(2) * s) * table(k + 1, 0) - s * table(k + 1, 1));
+        }
+
+        bool matches(T alpha, T rcut, T tolerance) const {
+            return table_m.is_allocated() && alpha == alpha_m && rcut == rcut_m
+                   && tolerance == tolerance_m;
+        }
+
+        size_type getNumIntervals() const { return table_m.extent(0) - 1; }
+
+        /*!
+         * @returns the largest relative error at the sample points while building the table
+         */
+        T getMaxRelativeError() const { return maxError_m; }
+
+    private:
+        view_type table_m;
+        T invDr_m     = 0;
+        T alpha_m     = 0;
+        T rcut_m      = 0;
+        T tolerance_m = 0;
+        T maxError_m  = 0;
+    };
+}  // namespace ippl::detail
+
+#include "TruncatedGreenShapeTable.hpp"
+
+#endif  // IPPL_TRUNCATEDGREEN_SHAPE_TABLE_H
@@ -0,0 +1,69 @@
+//
+// Class TruncatedGreenShapeTable
+//   Force shapes of the truncated Green's function interaction. The field of a particle at distance
+//   r is forceConstant * q * dist * g(r) / r^3 with the dimensionless shape
+//
+//      g(r) = 2 * alpha * r * exp(-alpha^2 r^2) / sqrt(pi) + erfc(alpha * r),
+//
+//   which is smooth and bounded by one. TruncatedGreenExactShape evaluates g with exp and erfc,
+//   TruncatedGreenShapeTable replaces both by a piecewise cubic Hermite interpolant over [0, rcut].
+//
+
+#include <string>
+
+#include "Utility/IpplException.h"
+
+namespace ippl::detail {
+    template <typename T, typename MemorySpace>
+    TruncatedGreenShapeTable<T, MemorySpace>::TruncatedGreenShapeTable(T alpha, T rcut,
+                                                                       T tolerance,
+                                                                       size_type maxIntervals)
+        : alpha_m(alpha)
+        , rcut_m(rcut)
+        , tolerance_m(tolerance) {
+        if (!(rcut > 0) || !(tolerance > 0)) {
+            throw IpplException("TruncatedGreenShapeTable::TruncatedGreenShapeTable",
+                                "The cutoff radius and the tolerance must be positive.");
+        }
+
+        // The table is filled and verified in double precision; the interpolation itself runs in
+        // T so that the verified error includes the rounding of the stored nodes
+        const TruncatedGreenExactShape<double> exact{static_cast<double>(alpha)};
+        // Sample points inside each interval at which the error is checked
+        constexpr double samples[] = {0.125, 0.25, 0.375, 0.5, 0.625, 0.75, 0.875};
+
+        for (size_type n = 16; n <= maxIntervals; n *= 2) {
+            const double dr = static_cast<double>(rcut) / n;
+
+            table_m    = view_type("TruncatedGreenShapeTable", n + 1);
+            auto table = Kokkos::create_mirror_view(table_m);
+            for (size_type k = 0; k <= n; ++k) {
+                const double r = k * dr;
+                table(k, 0)    = static_cast<T>(exact(r));
+                table(k, 1)    = static_cast<T>(exact.derivative(r) * dr);
+            }
+            invDr_m = static_cast<T>(n / static_cast<double>(rcut));
+
+            maxError_m = 0;
+            for (size_type k = 0; k < n; ++k) {
+                for (double t : samples) {
+                    const T r           = static_cast<T>((k + t) * dr);
+                    const double approx = interpolate(table, invDr_m, r);
+                    const double error  = Kokkos::abs(approx - exact(r)) / exact(r);
+                    maxError_m          = Kokkos::max(maxError_m, static_cast<T>(error));
+                }
+            }
+
+            if (maxError_m <= tolerance) {
+                Kokkos::deep_copy(table_m, table);
+                return;
+            }
+        }
+
+        throw IpplException("TruncatedGreenShapeTable::TruncatedGreenShapeTable",
+                            "Relative tolerance " + std::to_string(tolerance)
+                                + " not reached with " + std::to_string(maxIntervals)
+                                + " intervals; the best table has an error of "
+                                + std::to_string(maxError_m) + ".");
+    }
+}  // namespace ippl::detail
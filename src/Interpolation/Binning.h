@@ -222,9 +222,8 @@ namespace ippl {
              * Bins particles into tiles for tiled scatter/gather operations.
              * Uses sort-based binning for efficient GPU execution.
              *
-             * @tparam ParticleT Particle coordinate type
+             * @tparam Positions Position attribute (ParticleAttrib or ParticleAttribSoA)
              * @tparam FieldT Field value type
-             * @tparam ParticleProperties Additional particle attribute properties
              * @tparam Dim Spatial dimension
              *
              * @param particles Particle position attribute
@@ -235,12 +234,13 @@ namespace ippl {
              *
              * @return Tuple of (permutation, bin_offsets, num_tiles)
              */
-            template <typename ParticleT, typename FieldT, class... ParticleProperties,
-                      unsigned Dim>
-            auto bin_particles(
-                const ParticleAttrib<Vector<ParticleT, Dim>, ParticleProperties...>& particles,
-                FieldLayout<Dim> fieldLayout, UniformCartesian<FieldT, Dim> mesh,
-                Vector<int, Dim> tile_size, int kernel_width) {
+            template <typename Positions, typename FieldT, unsigned Dim>
+                requires ippl::detail::VectorAttrib<Positions, Dim>
+            auto bin_particles(const Positions& particles, FieldLayout<Dim> fieldLayout,
+                               UniformCartesian<FieldT, Dim> mesh, Vector<int, Dim> tile_size,
+                               int kernel_width) {
+                using ParticleT =
+                    typename ippl::detail::AttribTraits<Positions>::value_type::value_type;
                 using AttribType   = std::decay_t<decltype(particles)>;
                 using ExecSpace    = typename AttribType::execution_space;
                 using memory_space = typename AttribType::memory_space;
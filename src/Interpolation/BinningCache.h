@@ -0,0 +1,377 @@
+/*!
+ * @file BinningCache.h
+ * @brief Reuse of the particle-to-tile binning across scatter / gather calls.
+ *
+ * A sorted scatter and the subsequent gather of the same time step bin the
+ * same, unchanged positions twice, and from one step to the next most
+ * particles stay in their tile. BinningCache keeps the result of
+ * bin_particles together with the modification counter of the position
+ * attribute (ParticleAttrib::getVersion) and
+ *
+ *  - returns it as-is while the positions have not been modified,
+ *  - re-keys the particles and keeps the permutation if no particle changed
+ *    bin,
+ *  - moves only the particles that changed bin if few of them did,
+ *  - falls back to a full bin_sort otherwise.
+ */
+#ifndef IPPL_INTERPOLATION_BINNING_CACHE_H
+#define IPPL_INTERPOLATION_BINNING_CACHE_H
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Interpolation/Binning.h"
+
+namespace ippl {
+    namespace Interpolation {
+        namespace detail {
+
+            struct BinningCacheEntryBase {
+                virtual ~BinningCacheEntryBase() = default;
+            };
+
+            /*!
+             * @struct BinningCacheEntry
+             * @brief Binning of one position attribute for one tile geometry.
+             */
+            template <unsigned Dim, typename MemorySpace>
+            struct BinningCacheEntry : BinningCacheEntryBase {
+                using size_view = Kokkos::View<size_type*, MemorySpace>;
+                using key_view  = Kokkos::View<uint64_t*, MemorySpace>;
+
+                // What the binning was computed from
+                const void* positions = nullptr;
+                const void* data      = nullptr;
+                size_type version     = 0;
+                size_type n_particles = 0;
+                int kernel_width      = 0;
+                Vector<int, Dim> tile_size;
+                Vector<int, Dim> ngrid_global;
+                Vector<int, Dim> ngrid_local;
+                Vector<int, Dim> local_offset;
+                Vector<double, Dim> origin;
+                Vector<double, Dim> invdx;
+                bool valid = false;
+
+                // Binning result and work arrays of the incremental update
+                Vector<int, Dim> num_tiles;
+                size_view permute, permute_tmp;
+                size_view bin_offsets, offsets_tmp;
+                size_view cursor, stay_rank;
+                key_view keys, new_keys;
+
+                static bool same(const Vector<int, Dim>& a, const Vector<int, Dim>& b) {
+                    for (unsigned d = 0; d < Dim; ++d) {
+                        if (a[d] != b[d]) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                static void ensure(size_view& v, size_t n) {
+                    if (v.extent(0) < n) {
+                        Kokkos::realloc(v, n);
+                    }
+                }
+
+                static void ensure(key_view& v, size_t n) {
+                    if (v.extent(0) < n) {
+                        Kokkos::realloc(v, n);
+                    }
+                }
+            };
+        }  // namespace detail
+
+        /*!
+         * @class BinningCache
+         * @brief Keeps the tile binning of position attributes between calls.
+         *
+         * Share one cache between the Scatter and Gather of a time step by
+         * setting ScatterConfig::binning_cache and GatherConfig::binning_cache.
+         * The binning is reused across both if they use the same tile size and
+         * kernel width; otherwise the cache keeps one entry per geometry.
+         *
+         * Positions are tracked through ParticleAttrib::getVersion. Code that
+         * writes positions through getView() must call markModified() on the
+         * attribute, otherwise a stale binning is returned.
+         *
+         * @tparam Dim Spatial dimension.
+         */
+        template <unsigned Dim>
+        class BinningCache {
+        public:
+            struct Statistics {
+                size_t hits        = 0;  //!< positions unmodified, binning returned as-is
+                size_t unchanged   = 0;  //!< positions modified, but no particle changed bin
+                size_t incremental = 0;  //!< only the particles that changed bin were moved
+                size_t full        = 0;  //!< full bin_sort
+            };
+
+            /*!
+             * @param max_moved_fraction Largest fraction of particles changing bin
+             *        for which the incremental update is used instead of a full sort.
+             * @param max_entries Number of (attribute, geometry) entries kept.
+             */
+            explicit BinningCache(double max_moved_fraction = 0.25, size_t max_entries = 4)
+                : max_moved_fraction_m(max_moved_fraction)
+                , max_entries_m(max_entries) {}
+
+            /*!
+             * Bin the particles into tiles; drop-in replacement for
+             * detail::bin_particles. The returned views are owned by the cache and
+             * stay valid until the next call for the same attribute and geometry.
+             */
+            template <ippl::detail::VectorAttrib<Dim> Positions, typename FieldT>
+            auto bin(const Positions& particles, const FieldLayout<Dim>& fieldLayout,
+                     const UniformCartesian<FieldT, Dim>& mesh, const Vector<int, Dim>& tile_size,
+                     int kernel_width);
+
+            //! Drop all entries.
+            void clear() { entries_m.clear(); }
+
+            const Statistics& getStatistics() const { return stats_m; }
+
+        private:
+            double max_moved_fraction_m;
+            size_t max_entries_m;
+            Statistics stats_m;
+
+            // Most recently used first
+            std::vector<std::unique_ptr<detail::BinningCacheEntryBase>> entries_m;
+        };
+
+        template <unsigned Dim>
+        template <ippl::detail::VectorAttrib<Dim> Positions, typename FieldT>
+        auto BinningCache<Dim>::bin(const Positions& particles, const FieldLayout<Dim>& fieldLayout,
+                                    const UniformCartesian<FieldT, Dim>& mesh,
+                                    const Vector<int, Dim>& tile_size, int kernel_width) {
+            using ParticleT =
+                typename ippl::detail::AttribTraits<Positions>::value_type::value_type;
+            using AttribType   = std::decay_t<decltype(particles)>;
+            using ExecSpace    = typename AttribType::execution_space;
+            using memory_space = typename AttribType::memory_space;
+            using entry_type   = detail::BinningCacheEntry<Dim, memory_space>;
+            using policy_type  = Kokkos::RangePolicy<ExecSpace>;
+            using result_type  = detail::BinningResult<Dim, memory_space>;
+
+            static IpplTimings::TimerRef binningCacheTimer = IpplTimings::getTimer("binningCache");
+            IpplTimings::startTimer(binningCacheTimer);
+
+            const NDIndex<Dim>& lDom = fieldLayout.getLocalNDIndex();
+            const NDIndex<Dim>& gDom = fieldLayout.getDomain();
+
+            Vector<int, Dim> ngrid_global, ngrid_local, local_offset, num_tiles;
+            size_t n_bins = 1;
+            for (unsigned d = 0; d < Dim; ++d) {
+                ngrid_global[d] = gDom[d].length();
+                ngrid_local[d]  = lDom[d].length();
+                local_offset[d] = lDom[d].first();
+                num_tiles[d]    = (ngrid_local[d] + tile_size[d] - 1) / tile_size[d] + 1;
+                n_bins *= num_tiles[d];
+            }
+
+            auto particle_view       = particles.getView();
+            const auto invdx         = 1.0 / mesh.getMeshSpacing();
+            const auto origin        = mesh.getOrigin();
+            const size_t n_particles = particles.getParticleCount();
+
+            // Find the entry of this attribute and tile geometry
+            entry_type* entry = nullptr;
+            for (auto it = entries_m.begin(); it != entries_m.end(); ++it) {
+                auto* e = dynamic_cast<entry_type*>(it->get());
+                if (e && e->positions == &particles && e->kernel_width == kernel_width
+                    && entry_type::same(e->tile_size, tile_size)) {
+                    std::rotate(entries_m.begin(), it, it + 1);
+                    entry = e;
+                    break;
+                }
+            }
+            if (entry == nullptr) {
+                if (entries_m.size() >= max_entries_m && !entries_m.empty()) {
+                    entries_m.pop_back();
+                }
+                entries_m.insert(entries_m.begin(), std::make_unique<entry_type>());
+                entry               = static_cast<entry_type*>(entries_m.front().get());
+                entry->positions    = &particles;
+                entry->kernel_width = kernel_width;
+                entry->tile_size    = tile_size;
+            }
+            entry_type& e = *entry;
+
+            bool sameGeometry = e.valid && e.n_particles == n_particles
+                                && e.data == particle_view.data()
+                                && entry_type::same(e.ngrid_global, ngrid_global)
+                                && entry_type::same(e.ngrid_local, ngrid_local)
+                                && entry_type::same(e.local_offset, local_offset);
+            for (unsigned d = 0; sameGeometry && d < Dim; ++d) {
+                sameGeometry = e.origin[d] == static_cast<double>(origin[d])
+                               && e.invdx[d] == static_cast<double>(invdx[d]);
+            }
+
+            auto finish = [&]() {
+                e.version = particles.getVersion();
+                IpplTimings::stopTimer(binningCacheTimer);
+                return result_type{e.permute, e.bin_offsets, e.num_tiles};
+            };
+
+            if (sameGeometry && e.version == particles.getVersion()) {
+                ++stats_m.hits;
+                return finish();
+            }
+
+            entry_type::ensure(e.permute, n_particles);
+            entry_type::ensure(e.keys, n_particles);
+            entry_type::ensure(e.bin_offsets, n_bins + 1);
+            entry_type::ensure(e.cursor, n_bins + 1);
+
+            auto fullRebin = [&]() {
+                detail::bin_sort<Dim, ParticleT, std::decay_t<decltype(particle_view)>, ExecSpace>(
+                    particle_view, ngrid_global, ngrid_local, local_offset, tile_size, kernel_width,
+                    origin, invdx, e.permute, e.bin_offsets, e.keys, e.cursor, n_particles,
+                    num_tiles);
+
+                e.n_particles  = n_particles;
+                e.data         = particle_view.data();
+                e.ngrid_global = ngrid_global;
+                e.ngrid_local  = ngrid_local;
+                e.local_offset = local_offset;
+                e.num_tiles    = num_tiles;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    e.origin[d] = static_cast<double>(origin[d]);
+                    e.invdx[d]  = static_cast<double>(invdx[d]);
+                }
+                e.valid = true;
+                ++stats_m.full;
+            };
+
+            if (!sameGeometry || n_particles == 0) {
+                fullRebin();
+                return finish();
+            }
+
+            // Re-key all particles and count those that changed bin
+            entry_type::ensure(e.new_keys, n_particles);
+
+            CoordinateTransform<ParticleT, Dim> transform(origin, invdx, ngrid_global);
+            detail::BinComputer<Dim, ParticleT> bin_computer{
+                ngrid_global, local_offset, tile_size, num_tiles, kernel_width, transform};
+
+            auto keys     = e.keys;
+            auto new_keys = e.new_keys;
+            size_t moved  = 0;
+            Kokkos::parallel_reduce(
+                "BinningCache::Rekey", policy_type(0, n_particles),
+                KOKKOS_LAMBDA(const size_t i, size_t& m) {
+                    const uint64_t k = static_cast<uint64_t>(bin_computer(particle_view(i)));
+                    new_keys(i)      = k;
+                    if (k != keys(i)) {
+                        ++m;
+                    }
+                },
+                moved);
+
+            if (moved == 0) {
+                ++stats_m.unchanged;
+                return finish();
+            }
+
+            if (static_cast<double>(moved) > max_moved_fraction_m * n_particles) {
+                fullRebin();
+                return finish();
+            }
+
+            // Incremental update: particles that stayed keep their relative
+            // order within the bin, particles that moved are appended to
+            // their new bin. Only the latter need atomics.
+            entry_type::ensure(e.permute_tmp, n_particles);
+            entry_type::ensure(e.offsets_tmp, n_bins + 1);
+            entry_type::ensure(e.stay_rank, n_particles + 1);
+
+            auto permute     = e.permute;
+            auto permute_new = e.permute_tmp;
+            auto offsets     = e.bin_offsets;
+            auto offsets_new = e.offsets_tmp;
+            auto cursor      = e.cursor;
+            auto stay_rank   = e.stay_rank;
+
+            // New bin counts
+            Kokkos::parallel_for(
+                "BinningCache::OldCounts", policy_type(0, n_bins + 1), KOKKOS_LAMBDA(const size_t b) {
+                    offsets_new(b) = b < n_bins ? offsets(b + 1) - offsets(b) : 0;
+                });
+            Kokkos::parallel_for(
+                "BinningCache::CountMoved", policy_type(0, n_particles),
+                KOKKOS_LAMBDA(const size_t i) {
+                    if (keys(i) != new_keys(i)) {
+                        Kokkos::atomic_dec(&offsets_new(keys(i)));
+                        Kokkos::atomic_inc(&offsets_new(new_keys(i)));
+                    }
+                });
+            Kokkos::parallel_scan(
+                "BinningCache::Offsets", policy_type(0, n_bins + 1),
+                KOKKOS_LAMBDA(const size_t b, size_type& upd, const bool final) {
+                    const size_type cnt = offsets_new(b);
+                    if (final) {
+                        offsets_new(b) = upd;
+                    }
+                    upd += cnt;
+                });
+
+            // Rank of every staying particle among the staying particles, in
+            // the old permutation order
+            Kokkos::parallel_scan(
+                "BinningCache::StayRank", policy_type(0, n_particles + 1),
+                KOKKOS_LAMBDA(const size_t j, size_type& upd, const bool final) {
+                    size_type stays = 0;
+                    if (j < n_particles) {
+                        const size_t i = permute(j);
+                        stays          = keys(i) == new_keys(i) ? 1 : 0;
+                    }
+                    if (final) {
+                        stay_rank(j) = upd;
+                    }
+                    upd += stays;
+                });
+
+            Kokkos::parallel_for(
+                "BinningCache::PlaceStaying", policy_type(0, n_particles),
+                KOKKOS_LAMBDA(const size_t j) {
+                    const size_t i = permute(j);
+                    if (keys(i) == new_keys(i)) {
+                        const size_t b = keys(i);
+                        permute_new(offsets_new(b) + stay_rank(j) - stay_rank(offsets(b))) = i;
+                    }
+                });
+
+            Kokkos::parallel_for(
+                "BinningCache::Cursor", policy_type(0, n_bins), KOKKOS_LAMBDA(const size_t b) {
+                    cursor(b) = offsets_new(b) + stay_rank(offsets(b + 1)) - stay_rank(offsets(b));
+                });
+
+            Kokkos::parallel_for(
+                "BinningCache::PlaceMoved", policy_type(0, n_particles),
+                KOKKOS_LAMBDA(const size_t i) {
+                    if (keys(i) != new_keys(i)) {
+                        const size_t pos =
+                            Kokkos::atomic_fetch_add(&cursor(new_keys(i)), size_t(1));
+                        permute_new(pos) = i;
+                    }
+                });
+            Kokkos::fence();
+
+            std::swap(e.permute, e.permute_tmp);
+            std::swap(e.bin_offsets, e.offsets_tmp);
+            std::swap(e.keys, e.new_keys);
+            ++stats_m.incremental;
+            return finish();
+        }
+
+    }  // namespace Interpolation
+}  // namespace ippl
+
+#endif  // IPPL_INTERPOLATION_BINNING_CACHE_H
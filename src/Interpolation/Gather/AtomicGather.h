@@ -13,6 +13,7 @@
 #include <Kokkos_Core.hpp>
 
 #include "Interpolation/CoordinateTransform.h"
+#include "Interpolation/Kernels.h"
 #include "Interpolation/Gather/GatherArgumentsBase.h"
 #include "Interpolation/WidthDispatcher.h"
 
@@ -50,6 +51,11 @@ namespace ippl::Interpolation::detail {
                 return a;
             }
         };
+
+        // Uniform interface required by Gather::clamp_tile_to_shmem; AtomicGather
+        // stages nothing in team scratch, so any tile fits.
+        static size_t compute_scratch_size(const Vector<int, Dim>& /*tile_size*/) { return 0; }
+
         Arguments args;
 
         struct Stencil {
@@ -62,6 +68,9 @@ namespace ippl::Interpolation::detail {
 
             // Get actual particle index (sorted or direct)
             const size_t p = UseSorting ? args.permute(j) : j;
+            if (args.isTombstone(p)) {
+                return;
+            }
 
             // Build stencil
             CoordinateTransform<RealType, Dim> transform{args.origin, args.invdx, args.n_grid};
@@ -76,7 +85,7 @@ namespace ippl::Interpolation::detail {
                 auto& kernel_vals = stencil.kw[d];
                 for (int i = 0; i < W; ++i) {
                     kernel_vals[i] =
-                        args.kernel((g_pos - (RealType(idx0 + i) + RealType(0.5))) * args.inv_hw);
+                        evalKernel<W>(args.kernel, (g_pos - (RealType(idx0 + i) + RealType(0.5))) * args.inv_hw);
                 }
             });
 
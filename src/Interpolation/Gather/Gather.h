@@ -1,6 +1,7 @@
 /*!
  * @file Gather.h
- * @brief Public Gather facade dispatching to AtomicGather (sorted/unsorted).
+ * @brief Public Gather facade dispatching to AtomicGather (sorted/unsorted)
+ *        and TiledGather.
  */
 #ifndef IPPL_GATHER_H
 #define IPPL_GATHER_H
@@ -8,9 +9,11 @@
 #include "Utility/IpplException.h"
 
 #include "Interpolation/Binning.h"
+#include "Interpolation/BinningCache.h"
 #include "Interpolation/Gather/GatherArgumentsBase.h"
 #include "Interpolation/Gather/GatherConfig.h"
 #include "Interpolation/Gather/AtomicGather.h"
+#include "Interpolation/Gather/TiledGather.h"
 #include "Interpolation/WidthDispatcher.h"
 #include "Particle/ParticleAttrib.h"
 
@@ -52,7 +55,7 @@ namespace ippl {
      * @brief Public functor that interpolates a Field at particle positions.
      *
      * Constructed with a kernel and an optional GatherConfig. The call
-     * operator invokes the configured backend (Atomic / AtomicSort) via
+     * operator invokes the configured backend (Atomic / AtomicSort / Tiled) via
      * WidthDispatcher so the kernel width is known at compile time inside
      * the inner loop.
      *
@@ -73,14 +76,14 @@ namespace ippl {
         /*!
          * @brief Gather field values at particle positions into @p values.
          * @param field     Input field (read-only; halo is filled before reads).
-         * @param positions Particle positions.
-         * @param values    Output values (overwritten).
+         * @param positions Particle positions (ParticleAttrib or ParticleAttribSoA).
+         * @param values    Output values (overwritten). Tombstones of the positions
+         *                  (see ParticleBase::setCompactionThreshold) are left unchanged.
          */
         template <typename ValueT, typename FieldT, class Mesh, class Centering,
-                  class... ViewArgs, typename ParticleT, class... PosProps, class... ValProps>
+                  class... ViewArgs, ippl::detail::VectorAttrib<Dim> Positions, class... ValProps>
         void operator()(Field<FieldT, Dim, Mesh, Centering, ViewArgs...>& field,
-                        const ParticleAttrib<Vector<ParticleT, Dim>, PosProps...>& positions,
-                        ParticleAttrib<ValueT, ValProps...>& values) {
+                        const Positions& positions, ParticleAttrib<ValueT, ValProps...>& values) {
             using Types =
                 Interpolation::detail::DeducedGatherTypes<Kernel, decltype(field),
                                                           decltype(positions), decltype(values)>;
@@ -92,6 +95,9 @@ namespace ippl {
                 case Interpolation::GatherMethod::AtomicSort:
                     dispatch<Interpolation::detail::AtomicGather, Types, true>(field, positions, values);
                     break;
+                case Interpolation::GatherMethod::Tiled:
+                    dispatch<Interpolation::detail::TiledGather, Types, true>(field, positions, values);
+                    break;
                 default:
                     throw IpplException("Gather", "Unknown GatherMethod");
             }
@@ -105,16 +111,25 @@ namespace ippl {
 
             Interpolation::detail::GatherBinningResult<memory_space> binning;
 
+            const int width          = kernel_m.width();
+            const size_t n_particles = positions.getParticleCount();
+
+            // The tile has to be clamped before binning, which depends on it
+            Interpolation::GatherConfig<Dim> config = config_m;
+
             // Check requires_binning using W=1 (trait doesn't depend on W)
             if constexpr (Impl<1, Types, UseSorting>::requires_binning) {
-                binning = performBinning<Types>(positions, field);
+                if (!clamp_tile_to_shmem<Impl, Types, UseSorting>(config, width)) {
+                    // Not even a single cell per tile fits, gather without tiles
+                    dispatch<Interpolation::detail::AtomicGather, Types, true>(field, positions,
+                                                                                values);
+                    return;
+                }
+                binning = performBinning<Types>(positions, field, config.get_tile_size());
             } else if (config_m.do_binning()) {
-                binning = performBinning<Types>(positions, field);
+                binning = performBinning<Types>(positions, field, config.get_tile_size());
             }
 
-            const int width          = kernel_m.width();
-            const size_t n_particles = positions.getParticleCount();
-
             // The halo must be valid before any stencil reads it, and is
             // independent of the runtime kernel width -- fill once outside
             // the WidthDispatcher.
@@ -122,22 +137,75 @@ namespace ippl {
 
             Interpolation::WidthDispatcher<1, std::decay_t<Kernel>::max_width>::dispatch(width, [&]<int W>() {
                 auto args = Impl<W, Types, UseSorting>::Arguments::create(field, positions, values, kernel_m,
-                                                                           config_m, binning);
+                                                                           config, binning);
                 Impl<W, Types, UseSorting> functor(std::move(args));
                 functor.run(n_particles);
             });
         }
 
+        /*!
+         * Shrink the tile until the per-team scratch of the backend fits the limit of the
+         * execution space, one cell at a time along the largest extent (see
+         * Scatter::clamp_tile_to_shmem).
+         * @param cfg configuration whose tile is clamped
+         * @param width runtime kernel width
+         * @returns false if not even a tile of a single cell fits
+         */
+        template <template <int, typename, bool> class Impl, typename Types, bool UseSorting>
+        static bool clamp_tile_to_shmem(Interpolation::GatherConfig<Dim>& cfg, int width) {
+            using team_policy = Kokkos::TeamPolicy<typename Types::execution_space>;
+
+            const size_t avail = team_policy(1, 1).scratch_size_max(0);
+
+            bool fits = true;
+            Interpolation::WidthDispatcher<1, std::decay_t<Kernel>::max_width>::dispatch(
+                width, [&]<int W>() {
+                    Vector<int, Dim> tile = cfg.get_tile_size();
+                    while (Impl<W, Types, UseSorting>::compute_scratch_size(tile) > avail) {
+                        unsigned largest = 0;
+                        for (unsigned d = 1; d < Dim; ++d) {
+                            if (tile[d] > tile[largest]) {
+                                largest = d;
+                            }
+                        }
+                        if (tile[largest] <= 1) {
+                            fits = false;
+                            break;
+                        }
+                        --tile[largest];
+                    }
+                    for (unsigned d = 0; d < Dim; ++d) {
+                        cfg.set_tile_size(d, tile[d]);
+                    }
+                });
+            return fits;
+        }
+
         template <typename Types, typename Positions, typename Field>
-        auto performBinning(const Positions& positions, const Field& field) {
+        auto performBinning(const Positions& positions, const Field& field,
+                            const Vector<int, Dim>& tile_size) {
             using memory_space = typename Types::memory_space;
 
-            auto [permute, bin_offsets, num_tiles] =
-                Interpolation::detail::bin_particles(positions, field.getLayout(), field.get_mesh(),
-                                                     config_m.get_tile_size(), kernel_m.width());
+            Vector<int, Dim> num_tiles;
+            Kokkos::View<ippl::detail::size_type*, memory_space> permute, bin_offsets;
+            if (config_m.binning_cache) {
+                auto cached = config_m.binning_cache->bin(positions, field.getLayout(),
+                                                          field.get_mesh(), tile_size,
+                                                          kernel_m.width());
+                permute     = cached.permute;
+                bin_offsets = cached.bin_offsets;
+                num_tiles   = cached.num_tiles;
+            } else {
+                std::tie(permute, bin_offsets, num_tiles) = Interpolation::detail::bin_particles(
+                    positions, field.getLayout(), field.get_mesh(), tile_size, kernel_m.width());
+            }
 
-            return Interpolation::detail::GatherBinningResult<memory_space>{permute, bin_offsets,
-                                                                            num_tiles};
+            Interpolation::detail::GatherBinningResult<memory_space> result{permute, bin_offsets,
+                                                                            Vector<int, 3>(1)};
+            for (unsigned d = 0; d < Dim; ++d) {
+                result.num_tiles[d] = num_tiles[d];
+            }
+            return result;
         }
 
         Kernel kernel_m;
@@ -7,6 +7,7 @@
 
 #include "Types/IpplTypes.h"
 #include "Types/Vector.h"
+#include "Types/ViewTypes.h"
 
 namespace ippl::Interpolation::detail {
 
@@ -55,6 +56,13 @@ namespace ippl::Interpolation::detail {
         Vector<RealType, Dim> invdx;
         RealType inv_hw;
         bool add_to_attribute;
+        //! Liveness of the particle slots, empty if the particles have no tombstones
+        ippl::detail::mask_type<typename PositionViewType::memory_space> valid;
+
+        //! Whether slot p is a tombstone whose value must be left alone
+        KOKKOS_INLINE_FUNCTION bool isTombstone(size_t p) const {
+            return valid.extent(0) > 0 && !valid(p);
+        }
 
     protected:
         template <typename Field, typename Positions, typename Values, typename Kernel>
@@ -66,6 +74,7 @@ namespace ippl::Interpolation::detail {
             nghost = field.getNghost();
             kernel = k;
             add_to_attribute = add_to;
+            valid            = positions.getValidMask();
 
             const auto& layout = field.getLayout();
             const auto& lDom   = layout.getLocalNDIndex();
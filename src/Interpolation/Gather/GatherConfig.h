@@ -7,6 +7,7 @@
 #define IPPL_GATHER_CONFIG_H
 
 #include <array>
+#include <memory>
 #include <mutex>
 #include <optional>
 
@@ -17,6 +18,9 @@
 namespace ippl {
     namespace Interpolation {
 
+        template <unsigned Dim>
+        class BinningCache;
+
         /**
          * @brief Gather method for grid-to-particle interpolation.
          *
@@ -25,10 +29,14 @@ namespace ippl {
          *   Scatter API).
          * - AtomicSort: same gather kernel, with a binning pre-pass that
          *   improves cache locality for clustered particle distributions.
+         * - Tiled: binned particles; each team stages the field block of its
+         *   tile in scratch memory once and serves all of the tile's
+         *   particles from it (counterpart of ScatterMethod::Tiled).
          */
         enum class GatherMethod {
             Atomic,
-            AtomicSort
+            AtomicSort,
+            Tiled
         };
 
         struct GatherCacheEntry {
@@ -82,6 +90,9 @@ namespace ippl {
 
             bool add_to_attribute = false;
 
+            // Optional binning cache, see ScatterConfig::binning_cache
+            std::shared_ptr<BinningCache<Dim>> binning_cache;
+
             /**
              * @brief Default constructor - initializes tile sizes based on Dim
              */
@@ -147,7 +158,7 @@ namespace ippl {
             }
 
             bool do_binning() const {
-                return method == GatherMethod::AtomicSort;
+                return method == GatherMethod::AtomicSort || method == GatherMethod::Tiled;
             }
 
             /**
@@ -0,0 +1,251 @@
+/*!
+ * @file TiledGather.h
+ * @brief Particle-tile gather: bin -> stage field block in team scratch -> read.
+ *
+ * Counterpart of TiledScatter. Each team owns one tile of the grid and copies
+ * the (tile + W + 1)^Dim field block its particles can touch into team
+ * scratch once; all particles binned to the tile then read their stencils
+ * from scratch instead of global memory. Pays off for wide kernels and high
+ * particles-per-cell, where every field value is read many times.
+ */
+#ifndef IPPL_TILED_GATHER_H
+#define IPPL_TILED_GATHER_H
+
+#include <Kokkos_Core.hpp>
+
+#include "Interpolation/CoordinateTransform.h"
+#include "Interpolation/Gather/GatherArgumentsBase.h"
+#include "Interpolation/Kernels.h"
+
+namespace ippl::Interpolation::detail {
+
+    /*!
+     * @struct TiledGather
+     * @brief Compile-time-width tiled gather functor used by Gather::dispatch.
+     * @tparam W          Compile-time kernel width.
+     * @tparam Types      GatherTypes bundle.
+     * @tparam UseSorting Must be true; the tiles are taken from the binning.
+     */
+    template <int W, class Types, bool UseSorting = true>
+    struct TiledGather {
+        static_assert(UseSorting,
+                      "TiledGather assumes bin-partitioned particles (UseSorting must be true).");
+
+        static constexpr bool requires_binning = true;  // algorithmically required
+        static constexpr unsigned Dim          = Types::Dim;
+        static constexpr int half_left         = (W + 1) / 2;
+
+        using RealType        = typename Types::RealType;
+        using ValueType       = typename Types::ValueType;
+        using memory_space    = typename Types::memory_space;
+        using execution_space = typename Types::execution_space;
+        using grid_value_t    = typename Types::GridViewType::non_const_value_type;
+
+        using team_policy   = Kokkos::TeamPolicy<execution_space>;
+        using team_member   = typename team_policy::member_type;
+        using scratch_space = typename execution_space::scratch_memory_space;
+
+        using scratch_view =
+            Kokkos::View<grid_value_t*, scratch_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+        struct Arguments : GatherArgumentsBase<Arguments, Types> {
+            Kokkos::View<ippl::detail::size_type*, memory_space> permute;
+            Kokkos::View<ippl::detail::size_type*, memory_space> bin_offsets;
+            Vector<int, Dim> num_tiles;
+            Vector<int, Dim> tile_size;
+            int team_size;
+
+            template <class Field, class Positions, class Values, class Kernel>
+            static Arguments create(const Field& field, const Positions& pos, Values& vals,
+                                    const Kernel& k, const GatherConfig<Dim>& cfg,
+                                    const GatherBinningResult<memory_space>& binning = {}) {
+                Arguments a;
+                a.initBase(field, pos, vals, k, cfg.add_to_attribute);
+                a.permute     = binning.permute;
+                a.bin_offsets = binning.bin_offsets;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    a.num_tiles[d] = binning.num_tiles[d];
+                }
+                a.tile_size = cfg.get_tile_size();
+                a.team_size = cfg.team_size;
+                return a;
+            }
+        };
+
+        Arguments args;
+
+        struct Stencil {
+            Kokkos::Array<int, Dim> base;  // stencil leftmost indices relative to the block
+            Kokkos::Array<Kokkos::Array<RealType, W>, Dim> kw;
+        };
+
+        KOKKOS_INLINE_FUNCTION Vector<int, Dim> block_size() const {
+            Vector<int, Dim> bs;
+            for (unsigned d = 0; d < Dim; ++d)
+                bs[d] = args.tile_size[d] + W + 1;
+            return bs;
+        }
+
+        KOKKOS_INLINE_FUNCTION size_t block_total() const {
+            size_t n = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n *= static_cast<size_t>(args.tile_size[d] + W + 1);
+            return n;
+        }
+
+        KOKKOS_INLINE_FUNCTION Vector<int, Dim> decode_tile_base(size_t tile_id) const {
+            Vector<int, Dim> tile_base;
+            for (size_t t = tile_id, d = Dim; d-- > 0;) {
+                tile_base[d] = static_cast<int>(t % static_cast<size_t>(args.num_tiles[d]))
+                               * args.tile_size[d];
+                t /= static_cast<size_t>(args.num_tiles[d]);
+            }
+            return tile_base;
+        }
+
+        //! Grid view index of a block coordinate, or false if outside the local view.
+        KOKKOS_INLINE_FUNCTION bool block_to_grid(const Vector<int, Dim>& tile_base,
+                                                  const Kokkos::Array<int, Dim>& bc,
+                                                  Kokkos::Array<int, Dim>& gc) const {
+            for (unsigned d = 0; d < Dim; ++d) {
+                const int local = tile_base[d] + bc[d] - half_left;
+                if (local < -args.nghost || local >= args.n_grid_local[d] + args.nghost)
+                    return false;
+                gc[d] = local + args.nghost;
+            }
+            return true;
+        }
+
+        template <size_t... Is>
+        KOKKOS_INLINE_FUNCTION grid_value_t read_grid(const Kokkos::Array<int, Dim>& gc,
+                                                      std::index_sequence<Is...>) const {
+            return args.grid(gc[Is]...);
+        }
+
+        KOKKOS_INLINE_FUNCTION void store(size_t p, const grid_value_t& out) const {
+            if constexpr (std::is_same_v<Kokkos::complex<RealType>, grid_value_t>
+                          && std::is_same_v<ValueType, RealType>) {
+                if (args.add_to_attribute)
+                    args.values(p) = args.values(p) + out.real();
+                else
+                    args.values(p) = out.real();
+            } else {
+                if (args.add_to_attribute)
+                    args.values(p) = args.values(p) + out;
+                else
+                    args.values(p) = out;
+            }
+        }
+
+        KOKKOS_INLINE_FUNCTION void operator()(const team_member& team) const {
+            const size_t tile_id = team.league_rank();
+            const size_t pstart  = args.bin_offsets(tile_id);
+            const size_t pend    = args.bin_offsets(tile_id + 1);
+            if (pstart == pend)
+                return;
+
+            const auto tile_base = decode_tile_base(tile_id);
+            const auto bs        = block_size();
+            const size_t total   = block_total();
+
+            // Stage the field block once per tile
+            scratch_view block(team.team_scratch(0), total);
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(team, total), [&](size_t idx) {
+                Kokkos::Array<int, Dim> bc{}, gc{};
+                size_t rem = idx;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    bc[d] = static_cast<int>(rem % static_cast<size_t>(bs[d]));
+                    rem /= static_cast<size_t>(bs[d]);
+                }
+                block(idx) = block_to_grid(tile_base, bc, gc)
+                                 ? read_grid(gc, std::make_index_sequence<Dim>{})
+                                 : grid_value_t(0);
+            });
+            team.team_barrier();
+
+            const CoordinateTransform<RealType, Dim> transform{args.origin, args.invdx,
+                                                               args.n_grid};
+
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(team, pstart, pend), [&](size_t ip) {
+                const size_t p = args.permute(ip);
+                if (args.isTombstone(p)) {
+                    return;
+                }
+
+                Stencil stencil{};
+                bool inside = true;
+                for_constexpr(std::make_integer_sequence<int, Dim>{}, [&]<int d>() {
+                    const RealType g = transform.toGridCoordinate(args.x(p)[d], d);
+                    const int idx0   = transform.getStencilBase(g - RealType(0.5), W);
+
+                    stencil.base[d] = idx0 - args.local_offset[d] + half_left - tile_base[d];
+                    inside = inside && stencil.base[d] >= 0 && stencil.base[d] + W <= bs[d];
+
+                    for (int i = 0; i < W; ++i) {
+                        stencil.kw[d][i] = evalKernel<W>(
+                            args.kernel, (g - (RealType(idx0 + i) + RealType(0.5))) * args.inv_hw);
+                    }
+                });
+
+                // Particles clamped into a boundary tile may reach outside the
+                // staged block; those read from global memory.
+                grid_value_t out = grid_value_t(0);
+                auto rec = [&]<unsigned D>(auto&& self, RealType wprod,
+                                           Kokkos::Array<int, Dim> bc) -> void {
+                    for (int i = 0; i < W; ++i) {
+                        bc[D]            = stencil.base[D] + i;
+                        const RealType w = wprod * stencil.kw[D][i];
+                        if constexpr (D == 0) {
+                            if (inside) {
+                                size_t idx = 0, stride = 1;
+                                for (unsigned d = 0; d < Dim; ++d) {
+                                    idx += static_cast<size_t>(bc[d]) * stride;
+                                    stride *= static_cast<size_t>(bs[d]);
+                                }
+                                out += block(idx) * w;
+                            } else {
+                                Kokkos::Array<int, Dim> gc{};
+                                if (block_to_grid(tile_base, bc, gc))
+                                    out += read_grid(gc, std::make_index_sequence<Dim>{}) * w;
+                            }
+                        } else {
+                            self.template operator()<D - 1>(self, w, bc);
+                        }
+                    }
+                };
+                rec.template operator()<Dim - 1>(rec, RealType(1), {});
+
+                store(p, out);
+            });
+        }
+
+        static size_t compute_scratch_size(const Vector<int, Dim>& tile_size) {
+            size_t n = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n *= static_cast<size_t>(tile_size[d] + W + 1);
+            // Use shmem_size() to account for Kokkos alignment overhead
+            return scratch_view::shmem_size(n);
+        }
+
+        void run(size_t) {
+            const size_t scratch = compute_scratch_size(args.tile_size);
+
+            size_t n_tiles = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n_tiles *= static_cast<size_t>(args.num_tiles[d]);
+
+            // Host backends may not support the configured team size
+            team_policy probe(n_tiles, 1);
+            probe.set_scratch_size(0, Kokkos::PerTeam(scratch));
+            const int max_team = probe.team_size_max(*this, Kokkos::ParallelForTag());
+            const int team     = Kokkos::max(1, Kokkos::min(args.team_size, max_team));
+
+            Kokkos::parallel_for(
+                "TiledGather",
+                team_policy(n_tiles, team).set_scratch_size(0, Kokkos::PerTeam(scratch)), *this);
+        }
+    };
+
+}  // namespace ippl::Interpolation::detail
+
+#endif  // IPPL_TILED_GATHER_H
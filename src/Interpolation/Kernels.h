@@ -1,6 +1,6 @@
 /*!
  * @file Kernels.h
- * @brief Built-in interpolation kernels (NGP through Quartic).
+ * @brief Built-in interpolation kernels (NGP through Quartic, ES).
  *
  * Each kernel exposes a uniform interface used by the tiled scatter / gather
  * code: a callable @c operator()(T) returning the kernel value, a static
@@ -13,6 +13,10 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
 namespace ippl {
     namespace Interpolation {
 
@@ -169,6 +173,167 @@ namespace ippl {
             KOKKOS_INLINE_FUNCTION static constexpr int width() { return 5; }
         };
 
+        /**
+         * @brief "Exponential of semicircle" (ES) kernel with run-time width.
+         *
+         * Normalized form: phi(x) = exp(beta * (sqrt(1 - x^2) - 1)) for |x| < 1, else 0
+         *
+         * The ES kernel is the spreading kernel of type-1/2 NUFFTs; with
+         * beta ~ 2.30 * w (upsampling factor 2) it reaches a relative accuracy of
+         * about 10^(1-w). The width is a run-time value: the scatter / gather
+         * backends dispatch on it with WidthDispatcher and evaluate the kernel via
+         * eval<W>(), which replaces exp/sqrt by a piecewise polynomial. The stencil
+         * point spacing in x is 2/w, so [-1, 1] is split into w intervals, each of
+         * which holds exactly one stencil point, and each interval is approximated
+         * by a polynomial of degree w + 2 (Chebyshev interpolation, evaluated with
+         * Horner's scheme).
+         */
+        template <typename T = double>
+        struct ESKernel {
+            using value_type                         = T;
+            static constexpr bool has_width_template = true;
+            static constexpr int max_width           = 14;
+
+            //! Maximum number of polynomial coefficients per interval
+            static constexpr int max_coeffs = max_width + 3;
+
+            //! Number of polynomial coefficients per interval for width W
+            template <int W>
+            static constexpr int num_coeffs = W + 3;
+
+            /**
+             * @param w    kernel width in grid points (1 <= w <= max_width)
+             * @param beta shape parameter; 2.30 * w if not positive
+             */
+            ESKernel(int w = 6, T beta = T(0))
+                : width_m(w)
+                , beta_m(beta > T(0) ? beta : T(2.30) * T(w)) {
+                if (w < 1 || w > max_width) {
+                    throw std::runtime_error("ESKernel: width " + std::to_string(w)
+                                             + " not in [1, " + std::to_string(max_width) + "]");
+                }
+                computeCoefficients();
+            }
+
+            KOKKOS_INLINE_FUNCTION int width() const { return width_m; }
+
+            KOKKOS_INLINE_FUNCTION T beta() const { return beta_m; }
+
+            /**
+             * @brief Exact evaluation.
+             */
+            KOKKOS_INLINE_FUNCTION T operator()(T x) const {
+                const T x2 = x * x;
+                return x2 < T(1) ? Kokkos::exp(beta_m * (Kokkos::sqrt(T(1) - x2) - T(1))) : T(0);
+            }
+
+            /**
+             * @brief Fast evaluation with the piecewise polynomial; W must be the
+             * kernel width.
+             */
+            template <int W>
+            KOKKOS_INLINE_FUNCTION T eval(T x) const {
+                constexpr int nc = num_coeffs<W>;
+
+                // map [-1, 1] to [0, W) and find the interval
+                const T s = (x + T(1)) * T(0.5) * T(W);
+                if (!(s >= T(0) && s < T(W))) {
+                    return T(0);
+                }
+                const int j = static_cast<int>(s);
+                const T t   = T(2) * (s - T(j)) - T(1);
+
+                const T* c = coeffs_m.data() + j * max_coeffs;
+                T result   = c[nc - 1];
+                for (int k = nc - 2; k >= 0; --k) {
+                    result = result * t + c[k];
+                }
+                return result;
+            }
+
+        private:
+            /**
+             * @brief Fit the polynomial of each interval on the host.
+             *
+             * The kernel is interpolated at the Chebyshev nodes of each interval,
+             * and the Chebyshev coefficients are converted to monomial coefficients
+             * in the interval-local variable t in [-1, 1].
+             */
+            void computeCoefficients() {
+                const int w  = width_m;
+                const int nc = w + 3;
+                const double pi = 3.14159265358979323846;
+                const double beta = static_cast<double>(beta_m);
+
+                auto phi = [beta](double x) {
+                    const double x2 = x * x;
+                    return x2 < 1.0 ? std::exp(beta * (std::sqrt(1.0 - x2) - 1.0)) : 0.0;
+                };
+
+                // monomial coefficients of the Chebyshev polynomials T_0 ... T_{nc-1}
+                double cheb[max_coeffs][max_coeffs] = {};
+                cheb[0][0] = 1.0;
+                if (nc > 1) {
+                    cheb[1][1] = 1.0;
+                }
+                for (int k = 2; k < nc; ++k) {
+                    for (int m = 0; m < nc; ++m) {
+                        cheb[k][m] = (m > 0 ? 2.0 * cheb[k - 1][m - 1] : 0.0) - cheb[k - 2][m];
+                    }
+                }
+
+                for (int j = 0; j < max_width; ++j) {
+                    for (int m = 0; m < max_coeffs; ++m) {
+                        coeffs_m[j * max_coeffs + m] = T(0);
+                    }
+                    if (j >= w) {
+                        continue;
+                    }
+
+                    // interval j covers x in [-1 + 2j/w, -1 + 2(j+1)/w]
+                    const double center = -1.0 + (2.0 * j + 1.0) / w;
+                    const double half   = 1.0 / w;
+
+                    double fvals[max_coeffs];
+                    for (int n = 0; n < nc; ++n) {
+                        const double tn = std::cos(pi * (n + 0.5) / nc);
+                        fvals[n]        = phi(center + half * tn);
+                    }
+
+                    for (int k = 0; k < nc; ++k) {
+                        double ck = 0.0;
+                        for (int n = 0; n < nc; ++n) {
+                            ck += fvals[n] * std::cos(pi * k * (n + 0.5) / nc);
+                        }
+                        ck *= (k == 0 ? 1.0 : 2.0) / nc;
+
+                        for (int m = 0; m <= k; ++m) {
+                            coeffs_m[j * max_coeffs + m] += T(ck * cheb[k][m]);
+                        }
+                    }
+                }
+            }
+
+            int width_m;
+            T beta_m;
+            Kokkos::Array<T, max_width * max_coeffs> coeffs_m;
+        };
+
+        /**
+         * @brief Evaluate a kernel inside a backend instantiated for width W.
+         *
+         * Kernels with @c has_width_template use their fast width-templated
+         * evaluation, all others their call operator.
+         */
+        template <int W, typename Kernel, typename T>
+        KOKKOS_INLINE_FUNCTION T evalKernel(const Kernel& kernel, T x) {
+            if constexpr (Kernel::has_width_template) {
+                return kernel.template eval<W>(x);
+            } else {
+                return kernel(x);
+            }
+        }
+
     }  // namespace Interpolation
 }  // namespace ippl
 
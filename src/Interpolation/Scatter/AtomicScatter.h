@@ -12,6 +12,7 @@
 #include <Kokkos_Core.hpp>
 
 #include "Interpolation/CoordinateTransform.h"
+#include "Interpolation/Kernels.h"
 #include "Interpolation/Scatter/ScatterArgumentsBase.h"
 
 namespace ippl::Interpolation::detail {
@@ -136,6 +137,8 @@ namespace ippl::Interpolation::detail {
             size_t p = i_in;
             if constexpr (Policy::use_sorting)
                 p = args.permute(i_in);
+            if (args.isTombstone(p))
+                return;
 
             CoordinateTransform<RealType, Dim> transform{args.origin, args.invdx, args.n_grid};
             const RealType inv_hw = args.inv_hw;
@@ -151,11 +154,7 @@ namespace ippl::Interpolation::detail {
                 const RealType g0    = (g - (RealType(idx) + RealType(0.5))) * inv_hw;
                 for (int k = 0; k < W; ++k) {
                     const RealType xi = g0 - RealType(k) * inv_hw;
-                    if constexpr (Types::KernelType::has_width_template) {
-                        kw[d][k] = args.kernel.template eval<W>(xi);
-                    } else {
-                        kw[d][k] = args.kernel(xi);
-                    }
+                    kw[d][k]          = evalKernel<W>(args.kernel, xi);
                 }
             }
 
@@ -202,6 +201,8 @@ namespace ippl::Interpolation::detail {
 
             if constexpr (Policy::use_sorting)
                 p_global = args.permute(p_global);
+            if (args.isTombstone(p_global))
+                return;
 
             CoordinateTransform<RealType, Dim> transform{args.origin, args.invdx, args.n_grid};
 
@@ -229,10 +230,7 @@ namespace ippl::Interpolation::detail {
                 constexpr int D = decltype(Dtag)::value;
                 Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, W), [&](const int i) {
                     const RealType xi = g0d - RealType(i) * inv_hw;
-                    if constexpr (Types::KernelType::has_width_template)
-                        kw_ptr[D * W + i] = args.kernel.template eval<W>(xi);
-                    else
-                        kw_ptr[D * W + i] = args.kernel(xi);
+                    kw_ptr[D * W + i] = evalKernel<W>(args.kernel, xi);
                 });
             };
 
@@ -68,6 +68,7 @@ namespace ippl::Interpolation::AutoTune {
             switch (m) {
                 case GatherMethod::Atomic:     return "Atomic";
                 case GatherMethod::AtomicSort: return "AtomicSort";
+                case GatherMethod::Tiled:      return "Tiled";
             }
             return "Atomic";
         }
@@ -443,9 +444,11 @@ namespace ippl::Interpolation::AutoTune {
             }
 
             for (const auto& t : std::vector<Vector<int, 3>>{{4, 4, 4}, {8, 8, 8}}) {
-                const double tp = time_gather<ExecSpace>(GatherMethod::AtomicSort, t);
-                if (tp > best.throughput_Mpts_s) {
-                    best = GatherSample{GatherMethod::AtomicSort, t[0], t[1], t[2], tp};
+                for (GatherMethod m : {GatherMethod::AtomicSort, GatherMethod::Tiled}) {
+                    const double tp = time_gather<ExecSpace>(m, t);
+                    if (tp > best.throughput_Mpts_s) {
+                        best = GatherSample{m, t[0], t[1], t[2], tp};
+                    }
                 }
             }
             return best;
@@ -733,11 +736,12 @@ namespace ippl::Interpolation::AutoTune {
                         best = GatherSample{GatherMethod::Atomic, 1, 1, 1, atomic_tp};
                     }
                     for (const auto& t : sort_tiles) {
-                        const double tp = time_gather<ExecSpace>(
-                            GatherMethod::AtomicSort, t, N, nParticle, host_backend ? 5 : 7);
-                        if (tp > best.throughput_Mpts_s) {
-                            best =
-                                GatherSample{GatherMethod::AtomicSort, t[0], t[1], t[2], tp};
+                        for (GatherMethod m : {GatherMethod::AtomicSort, GatherMethod::Tiled}) {
+                            const double tp = time_gather<ExecSpace>(m, t, N, nParticle,
+                                                                     host_backend ? 5 : 7);
+                            if (tp > best.throughput_Mpts_s) {
+                                best = GatherSample{m, t[0], t[1], t[2], tp};
+                            }
                         }
                     }
                 }
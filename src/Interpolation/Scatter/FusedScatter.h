@@ -0,0 +1,370 @@
+/*!
+ * @file FusedScatter.h
+ * @brief Scatter several particle attributes onto several fields in one pass.
+ *
+ * Deposits such as rho, Jx, Jy and Jz share the particle positions and hence
+ * the stencil base and kernel weights. The functors in this file compute the
+ * stencil once per particle and reuse each weight product for all N targets,
+ * instead of re-reading the positions and re-evaluating the kernel N times.
+ * They mirror AtomicScatter and TiledScatter, respectively.
+ */
+#ifndef IPPL_FUSED_SCATTER_H
+#define IPPL_FUSED_SCATTER_H
+
+#include <Kokkos_Core.hpp>
+
+#include <array>
+
+#include "Interpolation/CoordinateTransform.h"
+#include "Interpolation/Kernels.h"
+#include "Interpolation/Scatter/ScatterArgumentsBase.h"
+
+namespace ippl::Interpolation::detail {
+
+    /*!
+     * @struct FusedScatterTypes
+     * @brief ScatterTypes bundle extended by the number of (field, values)
+     *        targets deposited in one pass.
+     */
+    template <class BaseTypes, int N>
+    struct FusedScatterTypes : BaseTypes {
+        static_assert(N >= 1, "FusedScatter: at least one target is required");
+        static constexpr int num_targets = N;
+    };
+
+    /*!
+     * @struct FusedScatterArgumentsBase
+     * @brief ScatterArgumentsBase holding the grid and values views of all
+     *        targets. The inherited @c grid / @c values refer to target 0.
+     */
+    template <typename Derived, typename Types>
+    struct FusedScatterArgumentsBase : ScatterArgumentsBase<Derived, Types> {
+        static constexpr int N = Types::num_targets;
+        using GridViewType     = typename Types::GridViewType;
+        using ValuesViewType   = typename Types::ValuesViewType;
+
+        Kokkos::Array<GridViewType, N> grids;
+        Kokkos::Array<ValuesViewType, N> vals;
+
+    protected:
+        template <typename Field, typename Positions, typename Values, typename Kernel>
+        void initFused(const std::array<Field*, N>& fields, const Positions& positions,
+                       const std::array<const Values*, N>& values, const Kernel& k) {
+            this->initBase(*fields[0], positions, *values[0], k);
+            for (int t = 0; t < N; ++t) {
+                grids[t] = fields[t]->getView();
+                vals[t]  = values[t]->getView();
+            }
+        }
+    };
+
+    /*!
+     * @struct FusedAtomicScatter
+     * @brief Per-particle multi-target scatter with global atomics.
+     *
+     * One thread per particle computes the stencil and adds
+     * value_t * weight to every target. Unlike AtomicScatter there is no
+     * team path for wide kernels: the per-particle work already grows with
+     * the number of targets.
+     */
+    template <int W, class Types, class Policy>
+    struct FusedAtomicScatter {
+        static constexpr bool requires_binning = false;
+        static constexpr unsigned Dim          = Types::Dim;
+        static constexpr int N                 = Types::num_targets;
+
+        using RealType        = typename Types::RealType;
+        using ValueType       = typename Types::ValueType;
+        using memory_space    = typename Types::memory_space;
+        using execution_space = typename Types::execution_space;
+        using grid_value_t    = typename Types::GridViewType::non_const_value_type;
+
+        struct Arguments : FusedScatterArgumentsBase<Arguments, Types> {
+            Kokkos::View<ippl::detail::size_type*, memory_space> permute;
+
+            template <class Field, class Positions, class Values, class Kernel>
+            static Arguments create(const std::array<Field*, N>& fields, const Positions& pos,
+                                    const std::array<const Values*, N>& vals, const Kernel& k,
+                                    const ScatterConfig<Dim>& /*cfg*/,
+                                    const BinningResult<Dim, memory_space>& binning = {}) {
+                Arguments a;
+                a.initFused(fields, pos, vals, k);
+                if constexpr (Policy::use_sorting) {
+                    a.permute = binning.permute;
+                }
+                return a;
+            }
+        };
+
+        template <bool /*IsComplex*/>
+        static size_t compute_scratch_size(const Vector<int, Dim>& /*tile_size*/,
+                                           int /*team_size*/, int /*z_batches*/ = 1) {
+            return 0;
+        }
+
+        Arguments args;
+
+        FusedAtomicScatter(const Arguments& a)
+            : args(a) {}
+
+        KOKKOS_INLINE_FUNCTION void operator()(const size_t i) const {
+            size_t p = i;
+            if constexpr (Policy::use_sorting)
+                p = args.permute(i);
+            if (args.isTombstone(p))
+                return;
+
+            const CoordinateTransform<RealType, Dim> transform{args.origin, args.invdx,
+                                                               args.n_grid};
+
+            Kokkos::Array<int, Dim> base;
+            Kokkos::Array<Kokkos::Array<RealType, W>, Dim> kw;
+            for_constexpr(std::make_integer_sequence<int, Dim>{}, [&]<int d>() {
+                const RealType g = transform.toGridCoordinate(args.x(p)[d], d);
+                const int idx0   = transform.getStencilBase(g - RealType(0.5), W);
+
+                base[d] = idx0 - args.local_offset[d] + args.nghost;
+                for (int k = 0; k < W; ++k) {
+                    kw[d][k] = evalKernel<W>(
+                        args.kernel, (g - (RealType(idx0 + k) + RealType(0.5))) * args.inv_hw);
+                }
+            });
+
+            Kokkos::Array<ValueType, N> v;
+            for (int t = 0; t < N; ++t)
+                v[t] = args.vals[t](p);
+
+            auto scatter = [&]<unsigned D>(auto&& self, RealType wprod,
+                                           Kokkos::Array<int, Dim> gc) -> void {
+                for (int k = 0; k < W; ++k) {
+                    gc[D]            = base[D] + k;
+                    const RealType w = wprod * kw[D][k];
+                    if constexpr (D == 0) {
+                        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                            for (int t = 0; t < N; ++t) {
+                                Kokkos::atomic_add(&args.grids[t](gc[Is]...),
+                                                   static_cast<grid_value_t>(v[t] * w));
+                            }
+                        }(std::make_index_sequence<Dim>{});
+                    } else {
+                        self.template operator()<D - 1>(self, w, gc);
+                    }
+                }
+            };
+            scatter.template operator()<Dim - 1>(scatter, RealType(1), {});
+        }
+
+        void run(size_t) {
+            Kokkos::parallel_for("FusedAtomicScatter",
+                                 Kokkos::RangePolicy<execution_space>(0, args.n_particles), *this);
+        }
+    };
+
+    /*!
+     * @struct FusedTiledScatter
+     * @brief Multi-target variant of TiledScatter.
+     *
+     * Each team keeps one scratch histogram per target for its tile, so the
+     * scratch footprint grows by a factor N; Scatter::clamp_tile_to_shmem
+     * shrinks the tile accordingly. Only real-valued grids are supported.
+     */
+    template <int W, class Types, class Policy>
+    struct FusedTiledScatter {
+        static_assert(Policy::use_sorting,
+                      "FusedTiledScatter assumes bin-partitioned particles (Policy::use_sorting "
+                      "must be true).");
+
+        static constexpr bool requires_binning = true;
+        static constexpr unsigned Dim          = Types::Dim;
+        static constexpr int N                 = Types::num_targets;
+        static constexpr int half_left         = (W + 1) / 2;
+
+        using RealType        = typename Types::RealType;
+        using ValueType       = typename Types::ValueType;
+        using memory_space    = typename Types::memory_space;
+        using execution_space = typename Types::execution_space;
+        using grid_value_t    = typename Types::GridViewType::non_const_value_type;
+
+        static_assert(!std::is_same_v<grid_value_t, Kokkos::complex<RealType>>,
+                      "FusedTiledScatter: complex-valued fields are not supported");
+
+        using team_policy   = Kokkos::TeamPolicy<execution_space>;
+        using team_member   = typename team_policy::member_type;
+        using scratch_space = typename execution_space::scratch_memory_space;
+
+        using scratch_view =
+            Kokkos::View<RealType*, scratch_space, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+        struct Arguments : FusedScatterArgumentsBase<Arguments, Types> {
+            Kokkos::View<ippl::detail::size_type*, memory_space> permute;
+            Kokkos::View<ippl::detail::size_type*, memory_space> bin_offsets;
+            Vector<int, Dim> num_tiles;
+            Vector<int, Dim> tile_size;
+            int team_size;
+
+            template <class Field, class Positions, class Values, class Kernel>
+            static Arguments create(const std::array<Field*, N>& fields, const Positions& pos,
+                                    const std::array<const Values*, N>& vals, const Kernel& k,
+                                    const ScatterConfig<Dim>& config,
+                                    const BinningResult<Dim, memory_space>& binning = {}) {
+                Arguments a;
+                a.initFused(fields, pos, vals, k);
+                a.permute     = binning.permute;
+                a.bin_offsets = binning.bin_offsets;
+                a.num_tiles   = binning.num_tiles;
+                a.tile_size   = config.get_tile_size();
+#ifdef KOKKOS_ENABLE_SERIAL
+                constexpr bool host_only = std::is_same_v<execution_space, Kokkos::Serial>;
+#else
+                constexpr bool host_only = false;
+#endif
+                a.team_size = host_only ? 1 : config.team_size;
+                return a;
+            }
+        };
+
+        Arguments args;
+
+        KOKKOS_INLINE_FUNCTION Vector<int, Dim> hist_size() const {
+            Vector<int, Dim> hs;
+            for (unsigned d = 0; d < Dim; ++d)
+                hs[d] = args.tile_size[d] + W + 1;
+            return hs;
+        }
+
+        KOKKOS_INLINE_FUNCTION size_t hist_total() const {
+            size_t n = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n *= static_cast<size_t>(args.tile_size[d] + W + 1);
+            return n;
+        }
+
+        KOKKOS_INLINE_FUNCTION Vector<int, Dim> decode_tile_base(size_t tile_id) const {
+            Vector<int, Dim> tile_base;
+            for (size_t t = tile_id, d = Dim; d-- > 0;) {
+                tile_base[d] = static_cast<int>(t % static_cast<size_t>(args.num_tiles[d]))
+                               * args.tile_size[d];
+                t /= static_cast<size_t>(args.num_tiles[d]);
+            }
+            return tile_base;
+        }
+
+        KOKKOS_INLINE_FUNCTION void operator()(const team_member& team) const {
+            const size_t tile_id = team.league_rank();
+            const auto tile_base = decode_tile_base(tile_id);
+
+            const auto hs      = hist_size();
+            const size_t total = hist_total();
+
+            // Histogram of target t occupies [t * total, (t + 1) * total)
+            scratch_view hist(team.team_scratch(0), N * total);
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N * total),
+                                 [&](size_t idx) { hist(idx) = 0; });
+            team.team_barrier();
+
+            const CoordinateTransform<RealType, Dim> transform{args.origin, args.invdx,
+                                                               args.n_grid};
+
+            const size_t pstart = args.bin_offsets(tile_id);
+            const size_t pend   = args.bin_offsets(tile_id + 1);
+
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(team, pstart, pend), [&](size_t ip) {
+                const size_t p = args.permute(ip);
+                if (args.isTombstone(p)) {
+                    return;
+                }
+
+                Kokkos::Array<int, Dim> base;
+                Kokkos::Array<Kokkos::Array<RealType, W>, Dim> kw;
+                for_constexpr(std::make_integer_sequence<int, Dim>{}, [&]<int d>() {
+                    const RealType g = transform.toGridCoordinate(args.x(p)[d], d);
+                    const int idx0   = transform.getStencilBase(g - RealType(0.5), W);
+
+                    base[d] = idx0 - args.local_offset[d] + half_left - tile_base[d];
+                    for (int k = 0; k < W; ++k) {
+                        kw[d][k] = evalKernel<W>(
+                            args.kernel, (g - (RealType(idx0 + k) + RealType(0.5))) * args.inv_hw);
+                    }
+                });
+
+                Kokkos::Array<ValueType, N> v;
+                for (int t = 0; t < N; ++t)
+                    v[t] = args.vals[t](p);
+
+                auto scatter = [&]<unsigned D>(auto&& self, RealType wprod,
+                                               Kokkos::Array<int, Dim> hc) -> void {
+                    for (int k = 0; k < W; ++k) {
+                        hc[D]            = base[D] + k;
+                        const RealType w = wprod * kw[D][k];
+                        if constexpr (D == 0) {
+                            bool inside = true;
+                            size_t idx = 0, stride = 1;
+                            for (unsigned d = 0; d < Dim; ++d) {
+                                inside = inside && hc[d] >= 0 && hc[d] < hs[d];
+                                idx += static_cast<size_t>(hc[d]) * stride;
+                                stride *= static_cast<size_t>(hs[d]);
+                            }
+                            if (!inside)
+                                continue;
+                            for (int t = 0; t < N; ++t)
+                                Kokkos::atomic_add(&hist(t * total + idx),
+                                                   static_cast<RealType>(v[t] * w));
+                        } else {
+                            self.template operator()<D - 1>(self, w, hc);
+                        }
+                    }
+                };
+                scatter.template operator()<Dim - 1>(scatter, RealType(1), {});
+            });
+
+            team.team_barrier();
+
+            // Flush all histograms to their grids
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(team, total), [&](size_t idx) {
+                Kokkos::Array<int, Dim> gc{};
+                size_t rem = idx;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    const int hc = static_cast<int>(rem % static_cast<size_t>(hs[d]));
+                    rem /= static_cast<size_t>(hs[d]);
+
+                    const int local = tile_base[d] + hc - half_left;
+                    if (local < -args.nghost || local >= args.n_grid_local[d] + args.nghost)
+                        return;
+                    gc[d] = local + args.nghost;
+                }
+
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    for (int t = 0; t < N; ++t) {
+                        Kokkos::atomic_add(&args.grids[t](gc[Is]...),
+                                           static_cast<grid_value_t>(hist(t * total + idx)));
+                    }
+                }(std::make_index_sequence<Dim>{});
+            });
+        }
+
+        template <bool /*IsComplex*/>
+        static size_t compute_scratch_size(const Vector<int, Dim>& tile_size, int /* team_size */,
+                                           int /* z_batches */ = 1) {
+            size_t n = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n *= static_cast<size_t>(tile_size[d] + W + 1);
+            return scratch_view::shmem_size(N * n);
+        }
+
+        void run(size_t) {
+            const size_t scratch = compute_scratch_size<false>(args.tile_size, 0);
+
+            size_t n_tiles = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n_tiles *= static_cast<size_t>(args.num_tiles[d]);
+
+            Kokkos::parallel_for(
+                "FusedTiledScatter",
+                team_policy(n_tiles, args.team_size).set_scratch_size(0, Kokkos::PerTeam(scratch)),
+                *this);
+        }
+    };
+
+}  // namespace ippl::Interpolation::detail
+
+#endif  // IPPL_FUSED_SCATTER_H
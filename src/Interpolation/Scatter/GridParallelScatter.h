@@ -12,6 +12,8 @@
 
 #include <type_traits>
 
+#include "Interpolation/Kernels.h"
+
 namespace ippl::Interpolation::detail {
 
     //! Compile-time integer power: @c int_pow(base, exp) == @c base^exp.
@@ -262,6 +264,21 @@ namespace ippl::Interpolation::detail {
                 Kokkos::parallel_for(Kokkos::TeamThreadRange(team, batch_size), [&](const int bi) {
                     const size_t p = args.permute(batch_begin + static_cast<size_t>(bi));
 
+                    // A tombstone keeps its slot in the batch, but with zero weights at an
+                    // in-bounds shift, since its position may lie outside the tile
+                    if (args.isTombstone(p)) {
+                        RealType* const kw = kerevals + static_cast<size_t>(bi) * ker_stride;
+                        for (int wi = 0; wi < 3 * W; ++wi)
+                            kw[wi] = RealType(0);
+                        shifts_x[bi] = 0;
+                        shifts_y[bi] = 0;
+                        shifts_z[bi] = 0;
+                        vals_r[bi]   = RealType(0);
+                        if constexpr (needs_imag)
+                            vals_i[bi] = RealType(0);
+                        return;
+                    }
+
                     const RealType gp0 = transform.template toGridCoordinate<0>(args.x(p)[0]);
                     const RealType gp1 = transform.template toGridCoordinate<1>(args.x(p)[1]);
                     const RealType gp2 = transform.template toGridCoordinate<2>(args.x(p)[2]);
@@ -275,12 +292,12 @@ namespace ippl::Interpolation::detail {
 #pragma unroll
 #endif
                     for (int wi = 0; wi < W; ++wi) {
-                        kw[wi]         = args.kernel((gp0 - (RealType(idx0 + wi) + RealType(0.5)))
-                                                     * args.inv_hw);
-                        kw[W + wi]     = args.kernel((gp1 - (RealType(idx1 + wi) + RealType(0.5)))
-                                                     * args.inv_hw);
-                        kw[2 * W + wi] = args.kernel((gp2 - (RealType(idx2 + wi) + RealType(0.5)))
-                                                     * args.inv_hw);
+                        kw[wi] = evalKernel<W>(
+                            args.kernel, (gp0 - (RealType(idx0 + wi) + RealType(0.5))) * args.inv_hw);
+                        kw[W + wi] = evalKernel<W>(
+                            args.kernel, (gp1 - (RealType(idx1 + wi) + RealType(0.5))) * args.inv_hw);
+                        kw[2 * W + wi] = evalKernel<W>(
+                            args.kernel, (gp2 - (RealType(idx2 + wi) + RealType(0.5))) * args.inv_hw);
                     }
 
                     const int sx = idx0 - args.local_offset[0] + half_left - tile_base_x;
@@ -628,12 +645,25 @@ namespace ippl::Interpolation::detail {
                     const size_t p     = args.permute(batch_begin + static_cast<size_t>(bi));
                     RealType* const kw = kerevals + static_cast<size_t>(bi) * ker_stride;
 
+                    // See the 3D kernel: tombstones contribute zeros at shift 0
+                    if (args.isTombstone(p)) {
+                        for (unsigned d = 0; d < Dim; ++d) {
+                            for (int wi = 0; wi < W; ++wi)
+                                kw[d * W + wi] = RealType(0);
+                            shifts[static_cast<size_t>(bi) * Dim + d] = 0;
+                        }
+                        vals_r[bi] = RealType(0);
+                        if constexpr (needs_imag)
+                            vals_i[bi] = RealType(0);
+                        return;
+                    }
+
                     for (unsigned d = 0; d < Dim; ++d) {
                         const RealType gp = transform.toGridCoordinate(args.x(p)[d], d);
                         const int idx0    = transform.getStencilBase(gp - RealType(0.5), W);
                         for (int wi = 0; wi < W; ++wi)
-                            kw[d * W + wi] = args.kernel(
-                                (gp - (RealType(idx0 + wi) + RealType(0.5))) * args.inv_hw);
+                            kw[d * W + wi] = evalKernel<W>(
+                                args.kernel, (gp - (RealType(idx0 + wi) + RealType(0.5))) * args.inv_hw);
                         shifts[static_cast<size_t>(bi) * Dim + d] =
                             idx0 - args.local_offset[d] + half_left - tile_base[d];
                     }
@@ -6,12 +6,20 @@
 #ifndef IPPL_SCATTER_H
 #define IPPL_SCATTER_H
 
+#include <array>
+#include <tuple>
+
+#include "Utility/IpplException.h"
 #include "Utility/Tuning.h"
 
+#include "Field/HaloGroup.h"
+
 #include "Interpolation/Binning.h"
+#include "Interpolation/BinningCache.h"
 #include "Interpolation/Scatter/ScatterArgumentsBase.h"
 #include "Interpolation/Scatter/ScatterConfig.h"
 #include "Interpolation/Scatter/AtomicScatter.h"
+#include "Interpolation/Scatter/FusedScatter.h"
 #include "Interpolation/Scatter/GridParallelScatter.h"
 #include "Interpolation/Scatter/TileSizeCache.h"
 #include "Interpolation/Scatter/TiledScatter.h"
@@ -110,11 +118,14 @@ namespace ippl {
          *  - When `enable_tuning=false` and `lock_method=false`, the resolved
          *    method may be re-selected from `TileSizeCache::get_best(...)`,
          *    which mutates `config_m.method` for subsequent calls.
+         *
+         * The positions may be a ParticleAttrib or a ParticleAttribSoA. Tombstones
+         * of the positions (see ParticleBase::setCompactionThreshold) are skipped.
          */
         template <typename ValueT, typename FieldT, class Mesh, class Centering, class... ViewArgs,
-                  typename ParticleT, class... PosProps, class... ValProps>
+                  ippl::detail::VectorAttrib<Dim> Positions, class... ValProps>
         void operator()(Field<FieldT, Dim, Mesh, Centering, ViewArgs...>& field,
-                        const ParticleAttrib<Vector<ParticleT, Dim>, PosProps...>& positions,
+                        const Positions& positions,
                         const ParticleAttrib<ValueT, ValProps...>& values) {
             using Types =
                 Interpolation::detail::DeducedScatterTypes<Kernel, decltype(field),
@@ -126,6 +137,140 @@ namespace ippl {
             const size_t n_particles = positions.getParticleCount();
             const double rho_est     = estimate_rho(field, n_particles);
 
+            select_method<Types>(field, is_complex_field, rho_est);
+
+            const auto method = config_m.method;
+
+            const bool run_atomic = (method == Interpolation::ScatterMethod::Atomic);
+
+            if (run_atomic) {
+                if (config_m.sort) {
+                    dispatch<Interpolation::detail::AtomicScatter, Types,
+                             Interpolation::detail::SortedPolicy>(field, positions, values,
+                                                                  rho_est);
+                } else {
+                    dispatch<Interpolation::detail::AtomicScatter, Types,
+                             Interpolation::detail::UnsortedPolicy>(field, positions, values,
+                                                                    rho_est);
+                }
+                return;
+            }
+
+            if (method == Interpolation::ScatterMethod::Tiled) {
+                dispatch<Interpolation::detail::TiledScatter, Types,
+                         Interpolation::detail::SortedPolicy>(field, positions, values, rho_est);
+                return;
+            }
+
+            if (method == Interpolation::ScatterMethod::OutputFocused) {
+                dispatch<Interpolation::detail::GridParallelScatter, Types,
+                         Interpolation::detail::SortedPolicy>(field, positions, values, rho_est);
+            }
+        }
+
+        /**
+         * @brief Scatter several attributes from the same `positions` into
+         *        several fields in a single particle pass.
+         *
+         * `values[i]` is deposited into the i-th field of `fields`. The stencil
+         * and kernel weights are computed once per particle and reused for all
+         * targets, e.g. for the charge and current densities of a PIC step:
+         *
+         *   scatter(std::tie(rho, Jx, Jy, Jz), R, q, qvx, qvy, qvz);
+         *
+         * All fields must have the same (real) type, layout and number of ghost
+         * cells, and all attributes the same type. Atomic uses FusedAtomicScatter;
+         * Tiled and OutputFocused both use FusedTiledScatter. Like the single
+         * target overload, each field is overwritten and its halo accumulated,
+         * with one message per neighbor for all fields. Tombstones are skipped
+         * as well.
+         */
+        template <typename... FieldTs, ippl::detail::VectorAttrib<Dim> Positions,
+                  typename... ValueAttribs>
+        void operator()(std::tuple<FieldTs&...> fields, const Positions& positions,
+                        const ValueAttribs&... values) {
+            constexpr int N = sizeof...(FieldTs);
+            static_assert(N >= 1 && N == sizeof...(ValueAttribs),
+                          "Scatter: one value attribute is required per field");
+
+            using FirstField  = std::tuple_element_t<0, std::tuple<FieldTs...>>;
+            using FirstValues = std::tuple_element_t<0, std::tuple<ValueAttribs...>>;
+            static_assert((std::is_same_v<FieldTs, FirstField> && ...),
+                          "Scatter: all fused fields must have the same type");
+            static_assert((std::is_same_v<ValueAttribs, FirstValues> && ...),
+                          "Scatter: all fused attributes must have the same type");
+            static_assert(!ippl::detail::is_kokkos_complex<typename FirstField::value_type>::value,
+                          "Scatter: fused scatter supports real-valued fields only");
+
+            using Types = Interpolation::detail::FusedScatterTypes<
+                Interpolation::detail::DeducedScatterTypes<Kernel, FirstField,
+                                                           decltype(positions), FirstValues>,
+                N>;
+
+            std::array<FirstField*, N> fieldPtrs =
+                std::apply([](FieldTs&... f) { return std::array<FirstField*, N>{&f...}; }, fields);
+            std::array<const FirstValues*, N> valuePtrs{&values...};
+
+            for (auto* f : fieldPtrs) {
+                if (&f->getLayout() != &fieldPtrs[0]->getLayout()
+                    || f->getNghost() != fieldPtrs[0]->getNghost()) {
+                    throw IpplException("Scatter::operator()",
+                                        "Fused fields must share the same layout and number of "
+                                        "ghost cells.");
+                }
+            }
+
+            const FirstField& field  = *fieldPtrs[0];
+            const size_t n_particles = positions.getParticleCount();
+            const double rho_est     = estimate_rho(field, n_particles);
+
+            select_method<Types>(field, false, rho_est);
+
+            if (config_m.method == Interpolation::ScatterMethod::Atomic) {
+                if (config_m.sort) {
+                    dispatch_fused<Interpolation::detail::FusedAtomicScatter, Types,
+                                   Interpolation::detail::SortedPolicy>(fieldPtrs, positions,
+                                                                        valuePtrs, rho_est);
+                } else {
+                    dispatch_fused<Interpolation::detail::FusedAtomicScatter, Types,
+                                   Interpolation::detail::UnsortedPolicy>(fieldPtrs, positions,
+                                                                          valuePtrs, rho_est);
+                }
+                return;
+            }
+
+            dispatch_fused<Interpolation::detail::FusedTiledScatter, Types,
+                           Interpolation::detail::SortedPolicy>(fieldPtrs, positions, valuePtrs,
+                                                                rho_est);
+        }
+
+    private:
+        // ------------------------------------------------------------------
+        // estimate_rho: LOCAL particles / LOCAL grid points.
+        //
+        // Uses getLocalNDIndex() for the rank-local owned domain, matching
+        // getParticleCount() which returns the rank-local particle count.
+        // The previous version used getDomain() (global) with local particle
+        // counts, under-estimating rho by a factor of #ranks.
+        // ------------------------------------------------------------------
+        template <typename FieldT, class Mesh, class Centering, class... ViewArgs>
+        static double estimate_rho(const Field<FieldT, Dim, Mesh, Centering, ViewArgs...>& field,
+                                   size_t n_particles) {
+            const auto& local_dom = field.getLayout().getLocalNDIndex();
+            size_t n_grid         = 1;
+            for (unsigned d = 0; d < Dim; ++d)
+                n_grid *= static_cast<size_t>(local_dom[d].length());
+            return (n_grid > 0) ? static_cast<double>(n_particles) / static_cast<double>(n_grid)
+                                : 1.0;
+        }
+
+        // ------------------------------------------------------------------
+        // select_method: resolve config_m.method for the coming call.
+        // ------------------------------------------------------------------
+        template <typename Types, typename FieldT, class Mesh, class Centering, class... ViewArgs>
+        void select_method(const Field<FieldT, Dim, Mesh, Centering, ViewArgs...>& field,
+                           bool is_complex_field, double rho_est) {
+
             // Auto-select the best method from the benchmark cache when not
             // tuning and not locked. Tile/team/osub/z_batches are applied later
             // in resolve_config for all methods, whether auto-selected or
@@ -184,54 +329,6 @@ namespace ippl {
                     config_m.method = Interpolation::ScatterMethod::Atomic;
                 }
             }
-
-            const auto method = config_m.method;
-
-            const bool run_atomic = (method == Interpolation::ScatterMethod::Atomic);
-
-            if (run_atomic) {
-                if (config_m.sort) {
-                    dispatch<Interpolation::detail::AtomicScatter, Types,
-                             Interpolation::detail::SortedPolicy>(field, positions, values,
-                                                                  rho_est);
-                } else {
-                    dispatch<Interpolation::detail::AtomicScatter, Types,
-                             Interpolation::detail::UnsortedPolicy>(field, positions, values,
-                                                                    rho_est);
-                }
-                return;
-            }
-
-            if (method == Interpolation::ScatterMethod::Tiled) {
-                dispatch<Interpolation::detail::TiledScatter, Types,
-                         Interpolation::detail::SortedPolicy>(field, positions, values, rho_est);
-                return;
-            }
-
-            if (method == Interpolation::ScatterMethod::OutputFocused) {
-                dispatch<Interpolation::detail::GridParallelScatter, Types,
-                         Interpolation::detail::SortedPolicy>(field, positions, values, rho_est);
-            }
-        }
-
-    private:
-        // ------------------------------------------------------------------
-        // estimate_rho: LOCAL particles / LOCAL grid points.
-        //
-        // Uses getLocalNDIndex() for the rank-local owned domain, matching
-        // getParticleCount() which returns the rank-local particle count.
-        // The previous version used getDomain() (global) with local particle
-        // counts, under-estimating rho by a factor of #ranks.
-        // ------------------------------------------------------------------
-        template <typename FieldT, class Mesh, class Centering, class... ViewArgs>
-        static double estimate_rho(const Field<FieldT, Dim, Mesh, Centering, ViewArgs...>& field,
-                                   size_t n_particles) {
-            const auto& local_dom = field.getLayout().getLocalNDIndex();
-            size_t n_grid         = 1;
-            for (unsigned d = 0; d < Dim; ++d)
-                n_grid *= static_cast<size_t>(local_dom[d].length());
-            return (n_grid > 0) ? static_cast<double>(n_particles) / static_cast<double>(n_grid)
-                                : 1.0;
         }
 
         // ------------------------------------------------------------------
@@ -395,6 +492,71 @@ namespace ippl {
             });
         }
 
+        // ------------------------------------------------------------------
+        // dispatch_fused: dispatch for the multi-target overload. Same steps
+        // as dispatch, but zeroes and halo-accumulates every target field.
+        // ------------------------------------------------------------------
+        template <template <int, class, class> class Impl, class Types, class Policy, class Field,
+                  size_t N, class Positions, class Values>
+        void dispatch_fused(const std::array<Field*, N>& fields, const Positions& positions,
+                            const std::array<const Values*, N>& values, double rho_est) {
+            using memory_space = typename Types::memory_space;
+            using RealType     = typename Types::RealType;
+
+            const int width          = kernel_m.width();
+            const size_t n_particles = positions.getParticleCount();
+            Field& field             = *fields[0];
+
+            Interpolation::WidthDispatcher<1, std::decay_t<decltype(kernel_m)>::max_width>::dispatch(width, [&]<int W>() {
+                auto tuned_config = resolve_config<Impl, W, Types, Policy, false>(rho_est);
+
+                if constexpr (Impl<W, Types, Policy>::requires_binning) {
+                    if (config_m.enable_tuning) {
+                        Vector<int, Dim> tuned_tile =
+                            get_tuned_tile_size<Impl, W, Types, Policy, false>(
+                                field, tuned_config.get_tile_size());
+                        tuned_config.set_tile_size(tuned_tile);
+                    }
+                }
+
+                clamp_tile_to_shmem<Impl, W, Types, Policy, false>(tuned_config);
+
+                const Vector<int, Dim> tile_size = tuned_config.get_tile_size();
+
+                Interpolation::detail::BinningResult<Dim, memory_space> binning;
+                if constexpr (Impl<W, Types, Policy>::requires_binning) {
+                    binning = performBinning<Types>(positions, field, tile_size);
+                } else if (config_m.do_binning()) {
+                    binning = performBinning<Types>(positions, field, tile_size);
+                }
+
+                auto args = Impl<W, Types, Policy>::Arguments::create(
+                    fields, positions, values, kernel_m, tuned_config, binning);
+                Impl<W, Types, Policy> functor{std::move(args)};
+
+                for (auto* f : fields) {
+                    *f = 0.0;
+                }
+
+                functor.run(n_particles);
+                Kokkos::fence();
+
+                if constexpr (Impl<W, Types, Policy>::requires_binning) {
+                    if (config_m.enable_tuning) {
+                        auto& tuner = Interpolation::detail::get_scatter_tuner<Impl, Dim, RealType,
+                                                                               false>();
+                        tuner.end();
+                    }
+                }
+
+                HaloGroup<Dim, memory_space> halo;
+                for (auto* f : fields) {
+                    halo.add(*f);
+                }
+                halo.accumulateHalo();
+            });
+        }
+
         template <template <int, class, class> class Impl, int W, class Types, class Policy,
                   bool IsComplex, class Field>
         Vector<int, Dim> get_tuned_tile_size(const Field& /*field*/,
@@ -423,7 +585,12 @@ namespace ippl {
         template <typename Types, typename Positions, typename Field>
         auto performBinning(const Positions& positions, const Field& field,
                             const Vector<int, Dim>& tile_size) {
-            using memory_space                     = typename Types::memory_space;
+            using memory_space = typename Types::memory_space;
+            if (config_m.binning_cache) {
+                return config_m.binning_cache->bin(positions, field.getLayout(), field.get_mesh(),
+                                                   tile_size, kernel_m.width());
+            }
+
             auto [permute, bin_offsets, num_tiles] = Interpolation::detail::bin_particles(
                 positions, field.getLayout(), field.get_mesh(), tile_size, kernel_m.width());
 
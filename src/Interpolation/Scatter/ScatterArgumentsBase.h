@@ -6,6 +6,7 @@
 #define IPPL_SCATTER_ARGUMENTS_BASE_H
 
 #include "Types/Vector.h"
+#include "Types/ViewTypes.h"
 
 namespace ippl::Interpolation::detail {
 
@@ -71,6 +72,13 @@ namespace ippl::Interpolation::detail {
         Vector<RealType, Dim> invdx;
         RealType inv_hw;
         size_t n_particles;
+        //! Liveness of the particle slots, empty if the particles have no tombstones
+        ippl::detail::mask_type<memory_space> valid;
+
+        //! Whether slot p is a tombstone that must not be scattered
+        KOKKOS_INLINE_FUNCTION bool isTombstone(size_t p) const {
+            return valid.extent(0) > 0 && !valid(p);
+        }
 
     protected:
         template <typename Field, typename Positions, typename Values, typename Kernel>
@@ -82,6 +90,7 @@ namespace ippl::Interpolation::detail {
             nghost = field.getNghost();
             kernel = k;
             n_particles = positions.getParticleCount();
+            valid       = positions.getValidMask();
 
             const auto& layout = field.getLayout();
             const auto& lDom   = layout.getLocalNDIndex();
@@ -10,6 +10,7 @@
 #define IPPL_SCATTER_CONFIG_H
 
 #include <array>
+#include <memory>
 
 #include <Kokkos_Core.hpp>
 
@@ -18,6 +19,9 @@
 namespace ippl {
     namespace Interpolation {
 
+        template <unsigned Dim>
+        class BinningCache;
+
         /**
          * @brief Scatter algorithm for particle -> grid interpolation.
          *
@@ -64,6 +68,11 @@ namespace ippl {
             // Default 1 means no batching (process all z-stencil points at once).
             int z_batches = 1;
 
+            // Optional binning cache shared with other scatters / gathers of the
+            // same particles. When set, the binning is reused while the positions
+            // are unchanged and updated incrementally otherwise.
+            std::shared_ptr<BinningCache<Dim>> binning_cache;
+
             /**
              * @brief Default constructor - initializes tile sizes based on Dim.
              *
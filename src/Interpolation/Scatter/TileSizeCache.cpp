@@ -269,6 +269,8 @@ void GatherCache::load() {
 
         if (fields[0] == "AtomicSort") {
             entry_.method = GatherMethod::AtomicSort;
+        } else if (fields[0] == "Tiled") {
+            entry_.method = GatherMethod::Tiled;
         } else {
             entry_.method = GatherMethod::Atomic;
         }
@@ -14,6 +14,7 @@
 #include <Kokkos_Core.hpp>
 
 #include "Interpolation/CoordinateTransform.h"
+#include "Interpolation/Kernels.h"
 #include "Interpolation/Scatter/ScatterArgumentsBase.h"
 
 namespace ippl::Interpolation::detail {
@@ -218,6 +219,9 @@ namespace ippl::Interpolation::detail {
 
             Kokkos::parallel_for(Kokkos::TeamThreadRange(team, pstart, pend), [&](size_t ip) {
                 const size_t p = args.permute(ip);
+                if (args.isTombstone(p)) {
+                    return;
+                }
                 const auto val = args.values(p);
 
                 Stencil stencil{};
@@ -229,7 +233,7 @@ namespace ippl::Interpolation::detail {
                     stencil.base[d] = idx0 - args.local_offset[d];
 
                     for (int i = 0; i < W; ++i) {
-                        stencil.kw[d][i] = args.kernel((g - (RealType(idx0 + i) + RealType(0.5))) * args.inv_hw);
+                        stencil.kw[d][i] = evalKernel<W>(args.kernel, (g - (RealType(idx0 + i) + RealType(0.5))) * args.inv_hw);
                     }
                 });
 
@@ -11,6 +11,7 @@
 
 #include "Utility/IpplInfo.h"
 
+#include "Communicate/SharedWindowPool.h"
 #include "Interpolation/Scatter/AutoTune.h"
 #include "Particle/SortBuffer.h"
 
@@ -109,6 +110,7 @@ namespace ippl {
     void finalize() {
         Comm->deleteAllBuffers();
         ippl::detail::finalizeBinSortBuffers();
+        mpi::rma::finalizeSharedWindowPools();
         Kokkos::finalize();
         // we must first delete the communicator and
         // afterwards the MPI environment
@@ -8,6 +8,8 @@
 #include "Field/BareField.h"
 #include "Field/Field.h"
 #include "Field/BConds.h"
+#include "Field/HaloGroup.h"
+#include "Field/DeepHalo.h"
 
 // IPPL Utilities
 // #include "Utility/Timer.h"
@@ -31,9 +33,15 @@
 
 #include "Types/Vector.h"
 
+#include "Particle/ParticleAttribSoA.h"
 #include "Particle/ParticleBase.h"
 #include "Particle/ParticleSpatialLayout.h"
 
+#include "Expression/IpplFuse.h"
+
+// NUFFT (requires the particle interpolation engines)
+#include "FFT/Transform/NUFFT.h"
+
 // // IPPL Load balancing
 #include "Decomposition/OrthogonalRecursiveBisection.h"
 
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "Field/BcTypes.h"
+#include "Field/DeepHalo.h"
 
 #include "Types/Vector.h"
 
@@ -52,6 +53,9 @@ namespace ippl {
 
             Field u, f;
 
+            //! Scratch field of the deep-halo Jacobi smoother, only allocated if nghost > 1
+            Field unew;
+
             /**
              * @brief Construct a new Level object.
              *
@@ -59,17 +63,23 @@ namespace ippl {
              * @param m Shared pointer to the mesh.
              * @param l Shared pointer to the layout.
              * @param bcs Reference to the boundary conditions to apply.
+             * @param nghost Number of ghost cells of the fields.
              */
             template <typename BCType>
-            Level(std::shared_ptr<mesh_type> m, std::shared_ptr<layout_type> l, BCType& bcs)
+            Level(std::shared_ptr<mesh_type> m, std::shared_ptr<layout_type> l, BCType& bcs,
+                  int nghost = 1)
                 : mesh_ptr(m)
                 , layout_ptr(l)
-                , u(*m, *l)
-                , f(*m, *l) {
+                , u(*m, *l, nghost)
+                , f(*m, *l, nghost) {
                 // Apply boundary conditions to all fields
                 u.setFieldBC(bcs);
                 f.setFieldBC(bcs);
 
+                if (nghost > 1) {
+                    unew.initialize(*m, *l, nghost);
+                }
+
                 // Extract grid info from the provided mesh and layout
                 origin      = m->getOrigin();
                 auto domain = l->getDomain();
@@ -101,6 +111,52 @@ namespace ippl {
 
             return diag;
         }
+
+        /**
+         * @brief Damped Jacobi sweep for the second order Laplacian, unew = u + omega/diag * (f -
+         * A u), where A is the negative Laplacian whose diagonal is given by compute_diag.
+         *
+         * @tparam ViewType The view type of the fields.
+         * @tparam Dim The dimension of the fields.
+         */
+        template <typename ViewType, unsigned Dim>
+        struct JacobiSweep {
+            using value_type = typename ViewType::value_type;
+            using index_array_type =
+                typename RangePolicy<Dim, typename ViewType::execution_space>::index_array_type;
+
+            ViewType u, f, unew;
+            Vector<double, Dim> ihx2;
+            double omega_diag;
+
+            KOKKOS_INLINE_FUNCTION void operator()(const index_array_type& args) const {
+                const value_type uc = apply(u, args);
+
+                value_type Au = 0;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    index_array_type lo = args, hi = args;
+                    lo[d] -= 1;
+                    hi[d] += 1;
+                    Au += (2 * uc - apply(u, lo) - apply(u, hi)) * ihx2[d];
+                }
+                apply(unew, args) = uc + omega_diag * (apply(f, args) - Au);
+            }
+        };
+
+        /**
+         * @brief Copies a view element-wise, used to write back a Jacobi sweep.
+         */
+        template <typename ViewType, unsigned Dim>
+        struct CopySweep {
+            using index_array_type =
+                typename RangePolicy<Dim, typename ViewType::execution_space>::index_array_type;
+
+            ViewType dst, src;
+
+            KOKKOS_INLINE_FUNCTION void operator()(const index_array_type& args) const {
+                apply(dst, args) = apply(src, args);
+            }
+        };
     }  // namespace multigrid
 
     /**
@@ -129,17 +185,23 @@ namespace ippl {
          * @param min_cells_per_rank_per_dim Minimum number of cells per rank per dimension on the
          * coarsest level (default: 4).
          * @param communication Whether to perform halo communication (default: true).
+         * @param halo_depth Number of ghost layers of the level fields (default: 1). With a depth
+         * k > 1 the Jacobi smoother exchanges halos only once every k sweeps (see
+         * smooth_jacobi). This requires op to be the negative Laplacian, which is verified on
+         * first use.
          */
         multigrid_preconditioner(OperatorF&& op, unsigned pre_smooth_iters = 2,
                                  unsigned post_smooth_iters = 2, double omega_jacobi = 0.8,
-                                 int min_cells_per_rank_per_dim = 4, bool communication = true)
+                                 int min_cells_per_rank_per_dim = 4, bool communication = true,
+                                 int halo_depth = 1)
             : preconditioner<Field>("Multigrid")
             , op_(std::forward<OperatorF>(op))
             , nu1_(pre_smooth_iters)
             , nu2_(post_smooth_iters)
             , omega_(omega_jacobi)
             , min_cells_per_rank_per_dim_(min_cells_per_rank_per_dim)
-            , communication_(communication) {}
+            , communication_(communication)
+            , halo_depth_(halo_depth) {}
 
         // --- DEBUGGING ---
 
@@ -173,7 +235,7 @@ namespace ippl {
             IpplTimings::TimerRef mg = IpplTimings::getTimer("MG-PRECOND");
             IpplTimings::startTimer(mg);
 
-            L_[0].f = b.deepCopy();
+            copy_owned(b, L_[0].f);
 
             // Remove Volume average if periodic
             if (is_all_periodic_) {
@@ -196,7 +258,7 @@ namespace ippl {
             }
 
             // Write the result into the caller-provided buffer
-            Kokkos::deep_copy(result.getView(), L_[0].u.getView());
+            copy_owned(L_[0].u, result);
 
             IpplTimings::stopTimer(mg);
         }
@@ -242,6 +304,9 @@ namespace ippl {
                 ++nlevels;
             }
 
+            // the halo may not be deeper than the local extent on the coarsest level
+            const int nghost = std::max(1, std::min(halo_depth_, at_level));
+
             // reserve full vector to avoid implicit copying when adding new elements
             L_.clear();
             L_.reserve(nlevels);
@@ -261,7 +326,8 @@ namespace ippl {
                 }
 
                 auto level_layout = std::make_shared<ippl::SubFieldLayout<Dim>>(
-                    fine_layout.comm, fine_domain, sub_domain, decomp, fine_layout.isAllPeriodic_m);
+                    fine_layout.comm, fine_domain, sub_domain, decomp, fine_layout.isAllPeriodic_m,
+                    nghost);
 
                 auto level_mesh =
                     std::make_shared<mesh_type>(sub_domain, level_hx, fine_mesh.getOrigin());
@@ -292,7 +358,7 @@ namespace ippl {
                     }
                 }
 
-                L_.emplace_back(level_mesh, level_layout, level_bcs);
+                L_.emplace_back(level_mesh, level_layout, level_bcs, nghost);
             }
 
             IpplTimings::stopTimer(init_fields);
@@ -482,7 +548,9 @@ namespace ippl {
         double omega_;
         int min_cells_per_rank_per_dim_;
         bool communication_;
-        bool is_all_periodic_ = false;
+        int halo_depth_;
+        bool is_all_periodic_       = false;
+        bool deep_operator_checked_ = false;
 
         // --- DEBUGGING ---
 
@@ -565,6 +633,36 @@ namespace ippl {
         }
         // --- END OF DEBUGGING ---
 
+        /**
+         * @brief Copies the owned cells of a field into another field on the same local domain,
+         * which may have a different number of ghost cells.
+         *
+         * @param src The field to copy from.
+         * @param dst The field to copy to.
+         */
+        void copy_owned(const Field& src, Field& dst) {
+            if (src.getNghost() == dst.getNghost()) {
+                Kokkos::deep_copy(dst.getView(), src.getView());
+                return;
+            }
+
+            const int shift = src.getNghost() - dst.getNghost();
+            auto sview      = src.getView();
+            auto dview      = dst.getView();
+
+            using index_array_type = typename RangePolicy<Dim>::index_array_type;
+            ippl::parallel_for(
+                "copy_owned", dst.getFieldRangePolicy(),
+                KOKKOS_LAMBDA(const index_array_type& args) {
+                    index_array_type idx = args;
+                    for (unsigned d = 0; d < Dim; ++d) {
+                        idx[d] += shift;
+                    }
+                    apply(dview, args) = apply(sview, idx);
+                });
+            ippl::fence();
+        }
+
         /**
          * @brief Computes the residual of the current solution.
          *
@@ -610,6 +708,9 @@ namespace ippl {
         /**
          * @brief Performs Jacobi smoothing on a given level.
          *
+         * If the level fields have more than one ghost layer and the boundary conditions allow
+         * it, the halo of u is only exchanged once every nghost sweeps (see deepHaloSweeps).
+         *
          * @param level The level index to be smoothed.
          * @param iters The number of smoothing iterations to perform.
          */
@@ -623,6 +724,16 @@ namespace ippl {
 
             const auto diag = multigrid::compute_diag(lev);
 
+            if (communication_ && u.getNghost() > 1 && deepHaloDepth(u) > 1) {
+                if (!deep_operator_checked_) {
+                    check_deep_operator(level);
+                    deep_operator_checked_ = true;
+                }
+                smooth_jacobi_deep(level, iters, diag);
+                IpplTimings::stopTimer(jacobi);
+                return;
+            }
+
             for (unsigned it = 0; it < iters; ++it) {
                 if (communication_)
                     u.fillHalo();
@@ -632,6 +743,99 @@ namespace ippl {
             }
             IpplTimings::stopTimer(jacobi);
         }
+
+        /**
+         * @brief Jacobi smoothing with deep halos.
+         *
+         * The sweeps are computed on a region that shrinks by one layer per sweep, starting
+         * from the owned cells grown by nghost - 1 layers, such that the ghost cells of u are
+         * only exchanged once every nghost sweeps. The operator is applied as the second order
+         * Laplacian matching compute_diag.
+         *
+         * @param level The level index to be smoothed.
+         * @param iters The number of smoothing iterations to perform.
+         * @param diag The diagonal of the operator.
+         */
+        void smooth_jacobi_deep(const size_t level, const unsigned iters, const double diag) {
+            auto& lev = L_[level];
+            auto& u    = lev.u;
+            auto& f    = lev.f;
+            auto& unew = lev.unew;
+
+            // the source does not change during smoothing
+            f.fillHalo();
+
+            auto sweep = make_jacobi_sweep(level, u, f, unew, omega_ / diag);
+            multigrid::CopySweep<typename Field::view_type, Dim> copy{u.getView(), unew.getView()};
+
+            deepHaloSweeps(u, iters, 1, [&](const auto& policy) {
+                ippl::parallel_for("smooth_jacobi_deep", policy, sweep);
+                ippl::parallel_for("smooth_jacobi_deep_copy", policy, copy);
+            });
+            ippl::fence();
+        }
+
+        /**
+         * @brief Creates the Jacobi sweep unew = u + omega_diag * (f - A u) of a level, where A
+         * is the negative Laplacian.
+         */
+        multigrid::JacobiSweep<typename Field::view_type, Dim> make_jacobi_sweep(
+            const size_t level, Field& u, Field& f, Field& unew, const double omega_diag) const {
+            multigrid::JacobiSweep<typename Field::view_type, Dim> sweep{
+                u.getView(), f.getView(), unew.getView(), {}, omega_diag};
+            for (unsigned d = 0; d < Dim; ++d) {
+                sweep.ihx2[d] = 1.0 / (L_[level].hx[d] * L_[level].hx[d]);
+            }
+            return sweep;
+        }
+
+        /**
+         * @brief Verifies that op_ is the negative Laplacian hard-coded in the deep-halo sweep.
+         *
+         * The operator cannot be used in the sweep itself, since applying it exchanges the
+         * halo. Instead, both are applied to a probe field and compared.
+         *
+         * @param level The level index on which to compare.
+         * @throw IpplException if the operator differs from the negative Laplacian.
+         */
+        void check_deep_operator(const size_t level) {
+            auto& lev = L_[level];
+
+            Field probe = lev.u.deepCopy();
+            probe.setFieldBC(lev.u.getFieldBC());
+
+            using index_array_type = typename RangePolicy<Dim>::index_array_type;
+            auto view              = probe.getView();
+            ippl::parallel_for(
+                "check_deep_operator_probe", probe.getFieldRangePolicy(),
+                KOKKOS_LAMBDA(const index_array_type& args) {
+                    double phase = 0.3;
+                    for (unsigned d = 0; d < Dim; ++d) {
+                        phase += (0.7 + 0.6 * d) * args[d];
+                    }
+                    apply(view, args) = Kokkos::sin(phase);
+                });
+
+            // op_ exchanges the halo of the probe and applies its boundary conditions
+            Field applied = probe.deepCopy();
+            applied       = op_(probe);
+
+            // With a zero source and omega / diag = 1 the sweep computes probe - A probe
+            Field stencil = probe.deepCopy();
+            Field zero    = probe.deepCopy();
+            zero          = 0.0;
+            auto sweep    = make_jacobi_sweep(level, probe, zero, stencil, 1.0);
+            ippl::parallel_for("check_deep_operator", probe.getFieldRangePolicy(), sweep);
+            stencil = probe - stencil;
+
+            const double scale = norm(stencil, 0);
+            applied            = applied - stencil;
+            if (norm(applied, 0) > 1e-8 * scale) {
+                throw IpplException("multigrid_preconditioner::smooth_jacobi",
+                                    "Smoothing with halo_depth > 1 requires the operator to be "
+                                    "the negative Laplacian.");
+            }
+        }
     };
 }  // namespace ippl
 
@@ -30,6 +30,7 @@ namespace ippl {
         inline constexpr double mg_omega       = 0.8;
         inline constexpr int mg_min_cells = 4;
         inline constexpr bool mg_communication = false;
+        inline constexpr int mg_halo_depth     = 1;
 
         inline constexpr std::array<const char*, 8> valid_types = {
             "jacobi",         "newton",       "chebyshev", "richardson",
@@ -130,7 +131,8 @@ namespace ippl {
             [[maybe_unused]] int mg_min_cells_per_rank_per_dim =
                 pcg_preconditioner_defaults::mg_min_cells,
             [[maybe_unused]] bool mg_communication =
-                pcg_preconditioner_defaults::mg_communication) {}
+                pcg_preconditioner_defaults::mg_communication,
+            [[maybe_unused]] int mg_halo_depth = pcg_preconditioner_defaults::mg_halo_depth) {}
         /*!
          * Query how many iterations were required to obtain the solution
          * the last time this solver was used
@@ -470,7 +472,8 @@ namespace ippl {
                 pcg_preconditioner_defaults::mg_omega,  // This is a dummy default parameter, actual
                                                         // default parameter should be set in main
             int mg_min_cells_per_rank_per_dim = pcg_preconditioner_defaults::mg_min_cells,
-            bool mg_communication = pcg_preconditioner_defaults::mg_communication) override {
+            bool mg_communication = pcg_preconditioner_defaults::mg_communication,
+            int mg_halo_depth     = pcg_preconditioner_defaults::mg_halo_depth) override {
             if (preconditioner_type == "jacobi") {
                 // Turn on damping parameter
                 /*
@@ -515,7 +518,7 @@ namespace ippl {
                 preconditioner_m =
                     std::move(std::make_unique<multigrid_preconditioner<FieldLHS, OperatorF>>(
                         std::move(op), mg_pre, mg_post, mg_omega, mg_min_cells_per_rank_per_dim,
-                        mg_communication));
+                        mg_communication, mg_halo_depth));
             } else {
                 preconditioner_m = std::move(std::make_unique<preconditioner<FieldLHS>>());
             }
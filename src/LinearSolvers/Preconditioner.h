@@ -18,10 +18,10 @@
 // IMPORTANT: takes the field by *reference*, not by value. A by-value
 // signature would copy the Field on every call -- BareField has shared-
 // ownership Kokkos::View members, so the data isn't actually copied, but
-// the embedded HaloCells::haloData_m buffer that the halo exchange grows
-// via Kokkos::realloc only grows on the copy and never propagates back to
-// the original. The result was a fresh cudaMalloc per op_m() call in
-// multi-rank runs (see nsys profile in ~/prof/pif-pr-verify).
+// the halo exchange buffers that HaloCells allocates lazily are only
+// created on the copy and never propagate back to the original. The
+// result was a fresh cudaMalloc per op_m() call in multi-rank runs
+// (see nsys profile in ~/prof/pif-pr-verify).
 #define IPPL_SOLVER_OPERATOR_WRAPPER(fun, type) \
     [](type& arg) {                             \
         return fun(arg);                        \
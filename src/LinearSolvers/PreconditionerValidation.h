@@ -24,7 +24,8 @@ namespace ippl::preconditioner_validation {
     inline void sanitizeParams(const std::string& preconditioner_type, Inform& warn, int& level,
                                int& degree, int& richardson_iterations, int& inner, int& outer,
                                double& omega, int* communication, int& mg_pre, int& mg_post,
-                               double& mg_omega, int& mg_min_cells) {
+                               double& mg_omega, int& mg_min_cells,
+                               int* mg_halo_depth = nullptr) {
         auto warnAndDefault = [&](const std::string& what, const std::string& value,
                                   const std::string& default_value) {
             warn << "Invalid " << what << "='" << value << "' for preconditioner '"
@@ -88,6 +89,11 @@ namespace ippl::preconditioner_validation {
                            std::to_string(pcg_preconditioner_defaults::mg_min_cells));
             mg_min_cells = pcg_preconditioner_defaults::mg_min_cells;
         }
+        if (mg_halo_depth != nullptr && *mg_halo_depth < 1) {
+            warnAndDefault("mg_halo_depth", std::to_string(*mg_halo_depth),
+                           std::to_string(pcg_preconditioner_defaults::mg_halo_depth));
+            *mg_halo_depth = pcg_preconditioner_defaults::mg_halo_depth;
+        }
     }
 }  // namespace ippl::preconditioner_validation
 
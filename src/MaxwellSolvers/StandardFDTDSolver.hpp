@@ -44,34 +44,46 @@ namespace ippl {
                 ? 1
                 : 0;  // 1 if absorbing, 0 otherwise, indicates the start index of the field
 
+        using exec_space       = typename EMField::execution_space;
+        using index_array_type = typename RangePolicy<Dim, exec_space>::index_array_type;
+
         // Update the field values
-        Kokkos::parallel_for(
-            "Source field update", ippl::getRangePolicy(aview, nghost),
-            KOKKOS_LAMBDA(const size_t i, const size_t j, const size_t k) {
-                // global indices
-                const uint32_t ig = i + ldom.first()[0];
-                const uint32_t jg = j + ldom.first()[1];
-                const uint32_t kg = k + ldom.first()[2];
-                // check if at a boundary of the field
-                uint32_t val =
-                    uint32_t(ig == one_if_absorbing_otherwise_0)
-                    + (uint32_t(jg == one_if_absorbing_otherwise_0) << 1)
-                    + (uint32_t(kg == one_if_absorbing_otherwise_0) << 2)
-                    + (uint32_t(ig == true_nr[0] - one_if_absorbing_otherwise_0 - 1) << 3)
-                    + (uint32_t(jg == true_nr[1] - one_if_absorbing_otherwise_0 - 1) << 4)
-                    + (uint32_t(kg == true_nr[2] - one_if_absorbing_otherwise_0 - 1) << 5);
-                // update the interior field values
-                if (val == 0) {
-                    SourceVector_t interior = -anm1view(i, j, k) + a1 * aview(i, j, k)
-                                              + a2 * (aview(i + 1, j, k) + aview(i - 1, j, k))
-                                              + a4 * (aview(i, j + 1, k) + aview(i, j - 1, k))
-                                              + a6 * (aview(i, j, k + 1) + aview(i, j, k - 1))
-                                              + a8 * source_view(i, j, k);
-                    anp1view(i, j, k) = interior;
-                }
-            });
+        auto update = KOKKOS_LAMBDA(const index_array_type& args) {
+            const size_t i = args[0];
+            const size_t j = args[1];
+            const size_t k = args[2];
+            // global indices
+            const uint32_t ig = i + ldom.first()[0];
+            const uint32_t jg = j + ldom.first()[1];
+            const uint32_t kg = k + ldom.first()[2];
+            // check if at a boundary of the field
+            uint32_t val = uint32_t(ig == one_if_absorbing_otherwise_0)
+                           + (uint32_t(jg == one_if_absorbing_otherwise_0) << 1)
+                           + (uint32_t(kg == one_if_absorbing_otherwise_0) << 2)
+                           + (uint32_t(ig == true_nr[0] - one_if_absorbing_otherwise_0 - 1) << 3)
+                           + (uint32_t(jg == true_nr[1] - one_if_absorbing_otherwise_0 - 1) << 4)
+                           + (uint32_t(kg == true_nr[2] - one_if_absorbing_otherwise_0 - 1) << 5);
+            // update the interior field values
+            if (val == 0) {
+                SourceVector_t interior = -anm1view(i, j, k) + a1 * aview(i, j, k)
+                                          + a2 * (aview(i + 1, j, k) + aview(i - 1, j, k))
+                                          + a4 * (aview(i, j + 1, k) + aview(i, j - 1, k))
+                                          + a6 * (aview(i, j, k + 1) + aview(i, j, k - 1))
+                                          + a8 * source_view(i, j, k);
+                anp1view(i, j, k) = interior;
+            }
+        };
+
+        // The cells that are sent to the neighbours are updated first, so that their
+        // exchange overlaps with the update of the interior
+        ippl::parallel_for_boundary("Source field update (boundary)", aview, nghost, nghost,
+                                    update);
+        Kokkos::fence();
+        this->A_np1.fillHaloBegin();
+        ippl::parallel_for_interior("Source field update (interior)", aview, nghost, nghost,
+                                    update);
         Kokkos::fence();
-        this->A_np1.fillHalo();
+        this->A_np1.fillHaloEnd();
         this->applyBCs();
     }
 
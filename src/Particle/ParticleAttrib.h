@@ -87,16 +87,35 @@ namespace ippl {
             ar.serialize(dview_m, hash, nsends);
         }
 
+        void serializeMessages(detail::Archive<memory_space>& ar, const hash_type& hash,
+                               const detail::MessageLayout<memory_space>& layout,
+                               size_type nsends) override {
+            ar.serializeMessages(dview_m, hash, layout, nsends);
+        }
+
         void deserialize(detail::Archive<memory_space>& ar, size_type nrecvs) override {
             ar.deserialize(buf_m, nrecvs);
         }
 
         void deserialize(detail::Archive<memory_space>& ar, size_type offset,
                          size_type nrecvs) override {
+            this->markModified();
             this->reserve(offset + nrecvs);
             ar.deserialize(dview_m, offset, nrecvs);
         }
 
+        void deserialize(detail::Archive<memory_space>& ar, const hash_type& slots,
+                         size_type nrecvs) override {
+            this->markModified();
+            ar.deserialize(dview_m, slots, nrecvs);
+        }
+
+        void sendBlock(int rank, int tag, size_type begin, size_type count,
+                       std::vector<MPI_Request>& requests) override;
+
+        void recvBlock(int rank, int tag, size_type offset, size_type count,
+                       std::vector<MPI_Request>& requests) override;
+
         KOKKOS_INLINE_FUNCTION virtual ~ParticleAttrib() = default;
 
         size_type size() const override { return dview_m.extent(0); }
@@ -149,6 +168,17 @@ namespace ippl {
 
         host_mirror_type getHostMirror() const { return Kokkos::create_mirror(getView()); }
 
+        /*!
+         * Modification counter of the attribute values. It is incremented by every
+         * member function that writes particle data (assignment, destroy, unpack,
+         * permutation, ...). Code that writes through getView() must call
+         * markModified() itself. Used to detect whether derived data, e.g. the
+         * particle binning of Interpolation::BinningCache, is still valid.
+         */
+        size_type getVersion() const { return version_m; }
+
+        void markModified() const { ++version_m; }
+
         void set_name(const std::string& name_) override {
             size_t len = name_.size();
             if (len >= detail::ATTRIB_NAME_MAX_LEN) {
@@ -260,6 +290,8 @@ namespace ippl {
     private:
         view_type dview_m{"ParticleAttrib::dview", 0};
         view_type buf_m{"ParticleAttrib::buf", 0};
+
+        mutable size_type version_m = 0;
     };
 
     namespace detail {
@@ -272,6 +304,18 @@ namespace ippl {
             using view_type =
                 std::decay_t<decltype(std::declval<ParticleAttrib<T, Props...>>().getView())>;
         };
+
+        /*!
+         * Attributes of Vector<T, Dim> values with AttribTraits, e.g. positions stored in a
+         * ParticleAttrib or a ParticleAttribSoA. Their views return per particle an object
+         * whose components are accessed with operator[].
+         */
+        template <typename Attrib, unsigned Dim>
+        concept VectorAttrib =
+            requires { typename AttribTraits<Attrib>::value_type::value_type; }
+            && std::is_same_v<
+                typename AttribTraits<Attrib>::value_type,
+                Vector<typename AttribTraits<Attrib>::value_type::value_type, Dim>>;
     }  // namespace detail
 }  // namespace ippl
 
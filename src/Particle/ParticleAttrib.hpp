@@ -56,10 +56,32 @@ namespace ippl {
         }
     }
 
+    template <typename T, class... Properties>
+    void ParticleAttrib<T, Properties...>::sendBlock(int rank, int tag, size_type begin,
+                                                     size_type count,
+                                                     std::vector<MPI_Request>& requests) {
+        requests.push_back(MPI_REQUEST_NULL);
+        Comm->isendBytes(rank, tag, dview_m.data() + begin, count * sizeof(value_type),
+                         requests.back());
+    }
+
+    template <typename T, class... Properties>
+    void ParticleAttrib<T, Properties...>::recvBlock(int rank, int tag, size_type offset,
+                                                     size_type count,
+                                                     std::vector<MPI_Request>& requests) {
+        this->markModified();
+        this->reserve(offset + count);
+        requests.push_back(MPI_REQUEST_NULL);
+        Comm->irecvBytes(rank, tag, dview_m.data() + offset, count * sizeof(value_type),
+                         requests.back());
+    }
+
     template <typename T, class... Properties>
     void ParticleAttrib<T, Properties...>::destroy(const hash_type& deleteIndex,
                                                    const hash_type& keepIndex,
                                                    size_type invalidCount) {
+        this->markModified();
+
         // Replace all invalid particles in the valid region with valid
         // particles in the invalid region
         auto dview        = dview_m;
@@ -87,6 +109,8 @@ namespace ippl {
 
     template <typename T, class... Properties>
     void ParticleAttrib<T, Properties...>::unpack(size_type nrecvs) {
+        this->markModified();
+
         size_type required = *(this->localNum_mp) + nrecvs;
         this->resize(required);
 
@@ -102,11 +126,20 @@ namespace ippl {
 
     template <typename T, class... Properties>
     ParticleAttrib<T, Properties...>& ParticleAttrib<T, Properties...>::operator=(T x) {
+        this->markModified();
+
         auto dview        = dview_m;
+        auto valid        = this->getValidMask();
+        const bool masked = valid.extent(0) > 0;
         using policy_type = Kokkos::RangePolicy<execution_space>;
         Kokkos::parallel_for(
             "ParticleAttrib::operator=()", policy_type(0, *(this->localNum_mp)),
-            KOKKOS_LAMBDA(const size_t i) { dview(i) = x; });
+            KOKKOS_LAMBDA(const size_t i) {
+                if (masked && !valid(i)) {
+                    return;
+                }
+                dview(i) = x;
+            });
         return *this;
     }
 
@@ -114,13 +147,22 @@ namespace ippl {
     template <typename E, size_t N>
     ParticleAttrib<T, Properties...>& ParticleAttrib<T, Properties...>::operator=(
         detail::Expression<E, N> const& expr) {
+        this->markModified();
+
         const E expr_ = static_cast<const E&>(expr);
 
         auto dview        = dview_m;
+        auto valid        = this->getValidMask();
+        const bool masked = valid.extent(0) > 0;
         using policy_type = Kokkos::RangePolicy<execution_space>;
         Kokkos::parallel_for(
             "ParticleAttrib::operator=()", policy_type(0, *(this->localNum_mp)),
-            KOKKOS_LAMBDA(const size_t i) { dview(i) = expr_(i); });
+            KOKKOS_LAMBDA(const size_t i) {
+                if (masked && !valid(i)) {
+                    return;
+                }
+                dview(i) = expr_(i);
+            });
         return *this;
     }
 
@@ -159,13 +201,20 @@ namespace ippl {
               << endl;
             ippl::Comm->abort();
         }
-        auto dview  = dview_m;
-        auto ppview = pp.getView();
+        auto dview        = dview_m;
+        auto ppview       = pp.getView();
+        auto valid        = this->getValidMask();
+        const bool masked = valid.extent(0) > 0;
         Kokkos::parallel_for(
             "ParticleAttrib::scatter", iteration_policy, KOKKOS_LAMBDA(const size_t idx) {
                 // map index to possible hash_map
                 size_t mapped_idx = useHashView ? hash_array(idx) : idx;
 
+                // tombstones do not deposit
+                if (masked && !valid(mapped_idx)) {
+                    return;
+                }
+
                 vector_type l                        = (ppview(mapped_idx) - origin) * invdx + 0.5;
                 Vector<int, Field::dim> index        = l;
                 Vector<PositionType, Field::dim> whi = l - index;
@@ -190,6 +239,8 @@ namespace ippl {
     void ParticleAttrib<T, Properties...>::gather(
         Field& f, const ParticleAttrib<Vector<P2, Field::dim>, Properties...>& pp,
         const bool addToAttribute) {
+        this->markModified();
+
         constexpr unsigned Dim = Field::dim;
         using PositionType     = typename Field::Mesh_t::value_type;
 
@@ -217,10 +268,16 @@ namespace ippl {
 
         auto dview        = dview_m;
         auto ppview       = pp.getView();
+        auto valid        = this->getValidMask();
+        const bool masked = valid.extent(0) > 0;
         using policy_type = Kokkos::RangePolicy<execution_space>;
         Kokkos::parallel_for(
             "ParticleAttrib::gather", policy_type(0, *(this->localNum_mp)),
             KOKKOS_LAMBDA(const size_t idx) {
+                if (masked && !valid(idx)) {
+                    return;
+                }
+
                 vector_type l                        = (ppview(idx) - origin) * invdx + 0.5;
                 Vector<int, Field::dim> index        = l;
                 Vector<PositionType, Field::dim> whi = l - index;
@@ -242,6 +299,8 @@ namespace ippl {
 
     template <typename T, class... Properties>
     void ParticleAttrib<T, Properties...>::applyPermutation(const hash_type& permutation) {
+        this->markModified();
+
         const auto view = this->getView();
         const auto size = this->getParticleCount();
 
@@ -260,18 +319,19 @@ namespace ippl {
 
     template <typename T, class... Properties>
     void ParticleAttrib<T, Properties...>::internalCopy(const hash_type& indices) {
+        this->markModified();
+
         auto copySize     = indices.size();
         using policy_type = Kokkos::RangePolicy<execution_space>;
-        auto view         = this->getView();
         const auto size   = this->getParticleCount();
 
-        // ada: PR501 comment not taken with logic hunk: snapshot count before create() increments
-        // localNum_mp.
-        create(copySize);  // localNum_mp becomes oldSize + copySize
+        // Grow before capturing the view, create() may reallocate
+        create(copySize, true);
 
+        auto dview = dview_m;
         Kokkos::parallel_for(
             "Copy to temp", policy_type(0, copySize),
-            KOKKOS_LAMBDA(const size_type& i) { view(size + i) = view(i); });
+            KOKKOS_LAMBDA(const size_type& i) { dview(size + i) = dview(indices(i)); });
 
         Kokkos::fence();
     }
@@ -357,10 +417,15 @@ namespace ippl {
     T ParticleAttrib<T, Properties...>::name() {                  \
         T temp            = 0.0;                                  \
         auto dview        = dview_m;                              \
+        auto valid        = this->getValidMask();                 \
+        const bool masked = valid.extent(0) > 0;                  \
         using policy_type = Kokkos::RangePolicy<execution_space>; \
         Kokkos::parallel_reduce(                                  \
             "fun", policy_type(0, *(this->localNum_mp)),          \
             KOKKOS_LAMBDA(const size_t i, T& valL) {              \
+                if (masked && !valid(i)) {                        \
+                    return;                                       \
+                }                                                 \
                 T myVal = dview(i);                               \
                 op;                                               \
             },                                                    \
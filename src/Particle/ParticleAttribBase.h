@@ -15,6 +15,8 @@
 #define IPPL_PARTICLE_ATTRIB_BASE_H
 
 #include <cstring>
+#include <mpi.h>
+#include <vector>
 
 #include "Types/IpplTypes.h"
 #include "Types/ViewTypes.h"
@@ -36,6 +38,7 @@ namespace ippl {
 
         public:
             using hash_type       = ippl::detail::hash_type<MemorySpace>;
+            using mask_type       = ippl::detail::mask_type<MemorySpace>;
             using memory_space    = MemorySpace;
             using execution_space = typename memory_space::execution_space;
 
@@ -80,9 +83,28 @@ namespace ippl {
             virtual void serialize(Archive<memory_space>& ar, size_type nsends)   = 0;
             virtual void serialize(detail::Archive<memory_space>& ar, const hash_type& hash,
                                    size_type nsends)                              = 0;
+            // Serialize the particles hash(k) into the messages of layout, see
+            // Archive::serializeMessages. Does not fence.
+            virtual void serializeMessages(detail::Archive<memory_space>& ar, const hash_type& hash,
+                                           const MessageLayout<memory_space>& layout,
+                                           size_type nsends) = 0;
             virtual void deserialize(Archive<memory_space>& ar, size_type nrecvs) = 0;
             virtual void deserialize(detail::Archive<memory_space>& ar, size_type offset,
                                      size_type nrecvs)                            = 0;
+            // Deserialize the i-th received particle into slot slots(i). The capacity must
+            // already hold all slots.
+            virtual void deserialize(detail::Archive<memory_space>& ar, const hash_type& slots,
+                                     size_type nrecvs) = 0;
+
+            // Transfer the contiguous range [begin, begin + count) straight between the
+            // attribute storage and another rank, without packing it into an archive. One
+            // request per message is appended to requests. The send range must stay unchanged
+            // until the requests complete. The receive grows the capacity to offset + count
+            // before it is posted; the capacity must not change again until it completes.
+            virtual void sendBlock(int rank, int tag, size_type begin, size_type count,
+                                   std::vector<MPI_Request>& requests) = 0;
+            virtual void recvBlock(int rank, int tag, size_type offset, size_type count,
+                                   std::vector<MPI_Request>& requests) = 0;
 
             virtual size_type size() const = 0;
 
@@ -91,11 +113,25 @@ namespace ippl {
             void setParticleCount(size_type& num) { localNum_mp = &num; }
             size_type getParticleCount() const { return *localNum_mp; }
 
+            void setValidMask(const mask_type& mask, const size_type& holes) {
+                validMask_mp = &mask;
+                holeCount_mp = &holes;
+            }
+
+            //! Whether some slots in [0, getParticleCount()) are tombstones
+            //! (see ParticleBase::setCompactionThreshold)
+            bool hasHoles() const { return holeCount_mp != nullptr && *holeCount_mp > 0; }
+
+            //! Per-slot liveness, or an empty view if every slot holds a particle
+            mask_type getValidMask() const { return hasHoles() ? *validMask_mp : mask_type(); }
+
             virtual void applyPermutation(const hash_type&) = 0;
             virtual void internalCopy(const hash_type&)     = 0;
 
         protected:
             const size_type* localNum_mp;
+            const mask_type* validMask_mp = nullptr;
+            const size_type* holeCount_mp = nullptr;
             char name_m[ATTRIB_NAME_MAX_LEN];
         };
     }  // namespace detail
@@ -0,0 +1,311 @@
+//
+// Class ParticleAttribSoA
+//   Structure-of-arrays particle attribute for Vector<T, Dim> values.
+//
+//   ParticleAttrib<Vector<T, Dim>> stores the vectors of all particles one
+//   after the other, so reading one component of many particles is a strided
+//   access. ParticleAttribSoA stores every component in its own contiguous
+//   column of a LayoutLeft view instead. Kernels that loop over particles then
+//   load each component with unit stride, which vectorizes on CPUs and
+//   coalesces on GPUs.
+//
+//   Element access returns a reference proxy that behaves like a Vector in
+//   expressions, interpolation (Scatter, Gather), particle boundary conditions
+//   and (de-)serialization, so the attribute can be used in place of
+//   ParticleAttrib<Vector<T, Dim>>:
+//
+//     ippl::ParticleAttribSoA<double, 3> P;
+//     bunch.addAttribute(P);
+//     P = P + dt * E;
+//
+#ifndef IPPL_PARTICLE_ATTRIB_SOA_H
+#define IPPL_PARTICLE_ATTRIB_SOA_H
+
+#include <cstring>
+
+#include "Expression/IpplExpressions.h"
+
+#include "Particle/ParticleAttrib.h"
+#include "Particle/ParticleAttribBase.h"
+
+namespace ippl {
+    namespace detail {
+        /*!
+         * Reference to the Dim components of one particle in a structure-of-arrays
+         * attribute. Component d lives at ptr[d * stride]. The proxy is itself a
+         * vector expression, hence it can be mixed with Vector in arithmetic and
+         * converted to a Vector. Assignments write through to the attribute.
+         * @tparam T component type
+         * @tparam Dim number of components
+         */
+        template <typename T, unsigned Dim>
+        struct SoAVectorRef
+            : public Expression<SoAVectorRef<T, Dim>, sizeof(T*) + sizeof(size_t)> {
+            typedef T value_type;
+            constexpr static unsigned dim = Dim;
+
+            KOKKOS_INLINE_FUNCTION SoAVectorRef(T* ptr, size_t stride)
+                : ptr_m(ptr)
+                , stride_m(stride) {}
+
+            KOKKOS_DEFAULTED_FUNCTION SoAVectorRef(const SoAVectorRef&) = default;
+
+            KOKKOS_INLINE_FUNCTION T& operator[](unsigned d) const { return ptr_m[d * stride_m]; }
+
+            /*!
+             * Assign a vector expression. The expression is evaluated completely
+             * before any component is written, so it may read the referenced
+             * particle itself (e.g. P = cross(P, B)).
+             */
+            template <typename E, size_t N>
+            KOKKOS_INLINE_FUNCTION const SoAVectorRef& operator=(
+                const Expression<E, N>& expr) const {
+                const Vector<T, Dim> value(expr);
+                for (unsigned d = 0; d < Dim; ++d) {
+                    (*this)[d] = value[d];
+                }
+                return *this;
+            }
+
+            KOKKOS_INLINE_FUNCTION const SoAVectorRef& operator=(const SoAVectorRef& other) const {
+                return *this = static_cast<const Expression<SoAVectorRef, sizeof(T*)
+                                                                              + sizeof(size_t)>&>(
+                           other);
+            }
+
+            KOKKOS_INLINE_FUNCTION const SoAVectorRef& operator=(const T& value) const {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    (*this)[d] = value;
+                }
+                return *this;
+            }
+
+            template <typename E, size_t N>
+            KOKKOS_INLINE_FUNCTION const SoAVectorRef& operator+=(
+                const Expression<E, N>& expr) const {
+                const Vector<T, Dim> value(expr);
+                for (unsigned d = 0; d < Dim; ++d) {
+                    (*this)[d] += value[d];
+                }
+                return *this;
+            }
+
+            template <typename E, size_t N>
+            KOKKOS_INLINE_FUNCTION const SoAVectorRef& operator-=(
+                const Expression<E, N>& expr) const {
+                const Vector<T, Dim> value(expr);
+                for (unsigned d = 0; d < Dim; ++d) {
+                    (*this)[d] -= value[d];
+                }
+                return *this;
+            }
+
+        private:
+            T* ptr_m;
+            size_t stride_m;
+        };
+
+        /*!
+         * View-like accessor of a structure-of-arrays attribute restricted to the
+         * first n particles. It provides the subset of the Kokkos::View interface
+         * the particle kernels use: operator()(i), extent(0) and size().
+         * @tparam T component type
+         * @tparam Dim number of components
+         * @tparam MemorySpace memory space of the data
+         */
+        template <typename T, unsigned Dim, class MemorySpace>
+        class SoAVectorView {
+        public:
+            //! Storage: column d holds component d of all particles
+            using data_type      = Kokkos::View<T**, Kokkos::LayoutLeft, MemorySpace>;
+            using component_type = Kokkos::View<T*, Kokkos::LayoutLeft, MemorySpace>;
+
+            typedef Vector<T, Dim> value_type;
+            typedef Vector<T, Dim> non_const_value_type;
+            using reference_type = SoAVectorRef<T, Dim>;
+
+            using memory_space     = typename data_type::memory_space;
+            using execution_space  = typename data_type::execution_space;
+            using host_mirror_type = SoAVectorView<T, Dim, Kokkos::HostSpace>;
+
+            SoAVectorView() = default;
+
+            SoAVectorView(const data_type& data, size_t n)
+                : data_m(data)
+                , n_m(n) {}
+
+            KOKKOS_INLINE_FUNCTION reference_type operator()(const size_t i) const {
+                return reference_type(data_m.data() + i, data_m.stride(1));
+            }
+
+            KOKKOS_INLINE_FUNCTION size_t extent(unsigned r) const { return r == 0 ? n_m : 1; }
+
+            KOKKOS_INLINE_FUNCTION size_t size() const { return n_m; }
+
+            //! Start of the storage, identifies the allocation like Kokkos::View::data()
+            KOKKOS_INLINE_FUNCTION T* data() const { return data_m.data(); }
+
+            //! Contiguous view of component d of the first size() particles
+            component_type component(unsigned d) const {
+                return Kokkos::subview(data_m, Kokkos::make_pair(size_t(0), n_m), d);
+            }
+
+            //! The underlying storage, including the capacity beyond size()
+            const data_type& getData() const { return data_m; }
+
+        private:
+            data_type data_m;
+            size_t n_m = 0;
+        };
+    }  // namespace detail
+
+    /*!
+     * Particle attribute of Vector<T, Dim> values stored as structure of arrays.
+     * @tparam T component type
+     * @tparam Dim number of components
+     * @tparam Properties Kokkos view properties (memory space)
+     */
+    template <typename T, unsigned Dim, class... Properties>
+    class ParticleAttribSoA
+        : public detail::ParticleAttribBase<>::with_properties<Properties...>,
+          public detail::Expression<
+              ParticleAttribSoA<T, Dim, Properties...>,
+              sizeof(detail::SoAVectorView<
+                     T, Dim,
+                     typename detail::ParticleAttribBase<>::with_properties<
+                         Properties...>::memory_space>)> {
+    public:
+        typedef Vector<T, Dim> value_type;
+        constexpr static unsigned dim = 1;
+
+        using Base = typename detail::ParticleAttribBase<>::with_properties<Properties...>;
+
+        using hash_type = typename Base::hash_type;
+
+        using memory_space    = typename Base::memory_space;
+        using execution_space = typename Base::execution_space;
+
+        using view_type        = detail::SoAVectorView<T, Dim, memory_space>;
+        using data_type        = typename view_type::data_type;
+        using host_mirror_type = typename view_type::host_mirror_type;
+
+        using size_type = detail::size_type;
+
+        void create(size_type, bool non_destructive = false) override;
+
+        void alloc(size_type) override;
+
+        void reserve(size_type) override;
+
+        void destroy(const hash_type& deleteIndex, const hash_type& keepIndex,
+                     size_type invalidCount) override;
+
+        void pack(const hash_type&) override;
+
+        void unpack(size_type) override;
+
+        // Components are serialized one after the other, each as a contiguous
+        // block; this is the same number of bytes as the AoS attribute.
+        void serialize(detail::Archive<memory_space>& ar, size_type nsends) override;
+
+        void serialize(detail::Archive<memory_space>& ar, const hash_type& hash,
+                       size_type nsends) override;
+
+        void serializeMessages(detail::Archive<memory_space>& ar, const hash_type& hash,
+                               const detail::MessageLayout<memory_space>& layout,
+                               size_type nsends) override;
+
+        void deserialize(detail::Archive<memory_space>& ar, size_type nrecvs) override;
+
+        void deserialize(detail::Archive<memory_space>& ar, size_type offset,
+                         size_type nrecvs) override;
+
+        void deserialize(detail::Archive<memory_space>& ar, const hash_type& slots,
+                         size_type nrecvs) override;
+
+        // One message per component, each column is contiguous
+        void sendBlock(int rank, int tag, size_type begin, size_type count,
+                       std::vector<MPI_Request>& requests) override;
+
+        void recvBlock(int rank, int tag, size_type offset, size_type count,
+                       std::vector<MPI_Request>& requests) override;
+
+        KOKKOS_INLINE_FUNCTION virtual ~ParticleAttribSoA() = default;
+
+        size_type size() const override { return dview_m.extent(0); }
+
+        size_type packedSize(const size_type count) const override {
+            return count * Dim * sizeof(T);
+        }
+
+        //! Resize the capacity, preserving existing entries on grow
+        void resize(size_type n) { Kokkos::resize(dview_m, n, Dim); }
+
+        //! Reallocate the capacity, discarding existing entries
+        void realloc(size_type n) { Kokkos::realloc(dview_m, n, Dim); }
+
+        KOKKOS_INLINE_FUNCTION detail::SoAVectorRef<T, Dim> operator()(const size_t i) const {
+            return detail::SoAVectorRef<T, Dim>(dview_m.data() + i, dview_m.stride(1));
+        }
+
+        //! Accessor covering the live particle range [0, getParticleCount())
+        view_type getView() const { return view_type(dview_m, *(this->localNum_mp)); }
+
+        //! Uninitialized host mirror of the whole storage (see SoAVectorView::getData)
+        host_mirror_type getHostMirror() const {
+            return host_mirror_type(Kokkos::create_mirror(dview_m), *(this->localNum_mp));
+        }
+
+        //! See ParticleAttrib::getVersion
+        size_type getVersion() const { return version_m; }
+
+        void markModified() const { ++version_m; }
+
+        void set_name(const std::string& name_) override {
+            size_t len = name_.size();
+            if (len >= detail::ATTRIB_NAME_MAX_LEN) {
+                len = detail::ATTRIB_NAME_MAX_LEN - 1;
+            }
+            std::memcpy(this->name_m, name_.c_str(), len);
+            this->name_m[len] = '\0';
+        }
+
+        std::string get_name() const override { return std::string(this->name_m); }
+
+        /*!
+         * Assign the same vector to all particles.
+         */
+        ParticleAttribSoA<T, Dim, Properties...>& operator=(const value_type& x);
+
+        /*!
+         * Assign an arbitrary particle attribute expression
+         * @tparam E expression type
+         * @tparam N size of the expression
+         * @param expr is the expression
+         */
+        template <typename E, size_t N>
+        ParticleAttribSoA<T, Dim, Properties...>& operator=(detail::Expression<E, N> const& expr);
+
+        void applyPermutation(const hash_type& permutation) override;
+
+        void internalCopy(const hash_type& indices) override;
+
+    private:
+        data_type dview_m{"ParticleAttribSoA::dview", 0, Dim};
+        data_type buf_m{"ParticleAttribSoA::buf", 0, Dim};
+
+        mutable size_type version_m = 0;
+    };
+
+    namespace detail {
+        template <typename T, unsigned Dim, class... Props>
+        struct AttribTraits<ParticleAttribSoA<T, Dim, Props...>> {
+            using value_type = Vector<T, Dim>;
+            using view_type  = typename ParticleAttribSoA<T, Dim, Props...>::view_type;
+        };
+    }  // namespace detail
+}  // namespace ippl
+
+#include "Particle/ParticleAttribSoA.hpp"
+
+#endif
@@ -0,0 +1,271 @@
+//
+// Class ParticleAttribSoA
+//   Structure-of-arrays particle attribute for Vector<T, Dim> values.
+//
+#include "Ippl.h"
+
+namespace ippl {
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::create(size_type n, bool non_destructive) {
+        size_type required = *(this->localNum_mp) + n;
+        if (this->size() < required) {
+            int overalloc = Comm->getDefaultOverallocation();
+            if (non_destructive) {
+                this->resize(required * overalloc);
+            } else {
+                this->realloc(required * overalloc);
+            }
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::alloc(size_type n) {
+        int overalloc = Comm->getDefaultOverallocation();
+        this->realloc(n * overalloc);
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::reserve(size_type n) {
+        if (this->size() < n) {
+            this->resize(n);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::sendBlock(int rank, int tag, size_type begin,
+                                                             size_type count,
+                                                             std::vector<MPI_Request>& requests) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            requests.push_back(MPI_REQUEST_NULL);
+            const T* column = dview_m.data() + d * dview_m.stride(1);
+            Comm->isendBytes(rank, tag, column + begin, count * sizeof(T), requests.back());
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::recvBlock(int rank, int tag, size_type offset,
+                                                             size_type count,
+                                                             std::vector<MPI_Request>& requests) {
+        this->markModified();
+        this->reserve(offset + count);
+        for (unsigned d = 0; d < Dim; ++d) {
+            requests.push_back(MPI_REQUEST_NULL);
+            T* column = dview_m.data() + d * dview_m.stride(1);
+            Comm->irecvBytes(rank, tag, column + offset, count * sizeof(T), requests.back());
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::destroy(const hash_type& deleteIndex,
+                                                           const hash_type& keepIndex,
+                                                           size_type invalidCount) {
+        this->markModified();
+
+        auto dview        = dview_m;
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "ParticleAttribSoA::destroy()", policy_type(0, invalidCount),
+            KOKKOS_LAMBDA(const size_t i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    dview(deleteIndex(i), d) = dview(keepIndex(i), d);
+                }
+            });
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::pack(const hash_type& hash) {
+        auto size = hash.extent(0);
+        if (buf_m.extent(0) < size) {
+            int overalloc = Comm->getDefaultOverallocation();
+            Kokkos::realloc(buf_m, size * overalloc, Dim);
+        }
+
+        auto buf          = buf_m;
+        auto dview        = dview_m;
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "ParticleAttribSoA::pack()", policy_type(0, size), KOKKOS_LAMBDA(const size_t i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    buf(i, d) = dview(hash(i), d);
+                }
+            });
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::unpack(size_type nrecvs) {
+        this->markModified();
+
+        size_type required = *(this->localNum_mp) + nrecvs;
+        this->reserve(required);
+
+        size_type count   = *(this->localNum_mp);
+        auto buf          = buf_m;
+        auto dview        = dview_m;
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "ParticleAttribSoA::unpack()", policy_type(0, nrecvs), KOKKOS_LAMBDA(const size_t i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    dview(count + i, d) = buf(i, d);
+                }
+            });
+        Kokkos::fence();
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::serialize(detail::Archive<memory_space>& ar,
+                                                             size_type nsends) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            ar.serialize(Kokkos::subview(dview_m, Kokkos::ALL, d), nsends);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::serialize(detail::Archive<memory_space>& ar,
+                                                             const hash_type& hash,
+                                                             size_type nsends) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            ar.serialize(Kokkos::subview(dview_m, Kokkos::ALL, d), hash, nsends);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::serializeMessages(
+        detail::Archive<memory_space>& ar, const hash_type& hash,
+        const detail::MessageLayout<memory_space>& layout, size_type nsends) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            ar.serializeMessages(Kokkos::subview(dview_m, Kokkos::ALL, d), hash, layout, nsends);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::deserialize(detail::Archive<memory_space>& ar,
+                                                               size_type nrecvs) {
+        // The columns are views into buf_m, so it has to be large enough
+        // before the archive writes to them
+        if (buf_m.extent(0) < nrecvs) {
+            Kokkos::realloc(buf_m, nrecvs, Dim);
+        }
+        for (unsigned d = 0; d < Dim; ++d) {
+            auto column = Kokkos::subview(buf_m, Kokkos::ALL, d);
+            ar.deserialize(column, nrecvs);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::deserialize(detail::Archive<memory_space>& ar,
+                                                               size_type offset,
+                                                               size_type nrecvs) {
+        this->markModified();
+        this->reserve(offset + nrecvs);
+        for (unsigned d = 0; d < Dim; ++d) {
+            auto column = Kokkos::subview(dview_m, Kokkos::ALL, d);
+            ar.deserialize(column, offset, nrecvs);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::deserialize(detail::Archive<memory_space>& ar,
+                                                               const hash_type& slots,
+                                                               size_type nrecvs) {
+        this->markModified();
+        for (unsigned d = 0; d < Dim; ++d) {
+            auto column = Kokkos::subview(dview_m, Kokkos::ALL, d);
+            ar.deserialize(column, slots, nrecvs);
+        }
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    ParticleAttribSoA<T, Dim, Properties...>& ParticleAttribSoA<T, Dim, Properties...>::operator=(
+        const value_type& x) {
+        this->markModified();
+
+        auto dview        = dview_m;
+        auto valid        = this->getValidMask();
+        const bool masked = valid.extent(0) > 0;
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "ParticleAttribSoA::operator=()", policy_type(0, *(this->localNum_mp)),
+            KOKKOS_LAMBDA(const size_t i) {
+                if (masked && !valid(i)) {
+                    return;
+                }
+                for (unsigned d = 0; d < Dim; ++d) {
+                    dview(i, d) = x[d];
+                }
+            });
+        return *this;
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    template <typename E, size_t N>
+    ParticleAttribSoA<T, Dim, Properties...>& ParticleAttribSoA<T, Dim, Properties...>::operator=(
+        detail::Expression<E, N> const& expr) {
+        this->markModified();
+
+        const E expr_ = static_cast<const E&>(expr);
+
+        auto view         = this->getView();
+        auto valid        = this->getValidMask();
+        const bool masked = valid.extent(0) > 0;
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "ParticleAttribSoA::operator=()", policy_type(0, *(this->localNum_mp)),
+            KOKKOS_LAMBDA(const size_t i) {
+                if (masked && !valid(i)) {
+                    return;
+                }
+                view(i) = expr_(i);
+            });
+        return *this;
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::applyPermutation(const hash_type& permutation) {
+        this->markModified();
+
+        const auto size = this->getParticleCount();
+        auto dview      = dview_m;
+
+        data_type temp("copy", size, Dim);
+
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "Copy to temp", policy_type(0, size), KOKKOS_LAMBDA(const size_type& i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    temp(permutation(i), d) = dview(i, d);
+                }
+            });
+
+        Kokkos::parallel_for(
+            "Copy from temp", policy_type(0, size), KOKKOS_LAMBDA(const size_type& i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    dview(i, d) = temp(i, d);
+                }
+            });
+        Kokkos::fence();
+    }
+
+    template <typename T, unsigned Dim, class... Properties>
+    void ParticleAttribSoA<T, Dim, Properties...>::internalCopy(const hash_type& indices) {
+        this->markModified();
+
+        auto copySize   = indices.size();
+        const auto size = this->getParticleCount();
+
+        // Grow before capturing the view, create() may reallocate
+        create(copySize, true);
+
+        auto dview        = dview_m;
+        using policy_type = Kokkos::RangePolicy<execution_space>;
+        Kokkos::parallel_for(
+            "Copy to temp", policy_type(0, copySize), KOKKOS_LAMBDA(const size_type& i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    dview(size + i, d) = dview(indices(i), d);
+                }
+            });
+
+        Kokkos::fence();
+    }
+
+}  // namespace ippl
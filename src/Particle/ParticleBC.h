@@ -5,6 +5,10 @@
 #ifndef IPPL_PARTICLE_BC_H
 #define IPPL_PARTICLE_BC_H
 
+#include <array>
+
+#include "Types/Vector.h"
+
 #include "Region/NDRegion.h"
 
 namespace ippl {
@@ -17,6 +21,33 @@ namespace ippl {
 
     namespace detail {
 
+        /*!
+         * Single-coordinate kernels of the boundary conditions. The functors
+         * below apply them to a view, PositionBC to a position held in registers.
+         */
+        template <typename V>
+        KOKKOS_INLINE_FUNCTION void applyPeriodicBC(V& value, double extent, double middle) {
+            value = value - extent * (int)((value - middle) * 2 / extent);
+        }
+
+        template <typename V>
+        KOKKOS_INLINE_FUNCTION void applyReflectiveBC(V& value, double minval, double maxval,
+                                                      bool isUpper) {
+            bool tooHigh = value >= maxval;
+            bool tooLow  = value < minval;
+            value += 2
+                     * ((tooHigh && isUpper) * (maxval - value)
+                        + (tooLow && !isUpper) * (minval - value));
+        }
+
+        template <typename V>
+        KOKKOS_INLINE_FUNCTION void applySinkBC(V& value, double minval, double maxval,
+                                                bool isUpper) {
+            bool tooHigh = value >= maxval;
+            bool tooLow  = value < minval;
+            value += (tooHigh && isUpper) * (maxval - value) + (tooLow && !isUpper) * (minval - value);
+        }
+
         template <typename T, unsigned Dim, class ViewType>
         struct ParticleBC {
             using value_type = typename ViewType::value_type::value_type;
@@ -72,7 +103,7 @@ namespace ippl {
 
             KOKKOS_INLINE_FUNCTION void operator()(const size_t& i) const {
                 value_type& value = this->view_m(i)[this->dim_m];
-                value             = value - extent_m * (int)((value - middle_m) * 2 / extent_m);
+                applyPeriodicBC(value, extent_m, middle_m);
             }
 
             KOKKOS_DEFAULTED_FUNCTION
@@ -96,11 +127,7 @@ namespace ippl {
 
             KOKKOS_INLINE_FUNCTION void operator()(const size_t& i) const {
                 value_type& value = this->view_m(i)[this->dim_m];
-                bool tooHigh      = value >= maxval_m;
-                bool tooLow       = value < minval_m;
-                value += 2
-                         * ((tooHigh && isUpper_m) * (maxval_m - value)
-                            + (tooLow && !isUpper_m) * (minval_m - value));
+                applyReflectiveBC(value, minval_m, maxval_m, isUpper_m);
             }
 
             KOKKOS_DEFAULTED_FUNCTION
@@ -124,16 +151,68 @@ namespace ippl {
 
             KOKKOS_INLINE_FUNCTION void operator()(const size_t& i) const {
                 value_type& value = this->view_m(i)[this->dim_m];
-                bool tooHigh      = value >= maxval_m;
-                bool tooLow       = value < minval_m;
-                value += (tooHigh && isUpper_m) * (maxval_m - value)
-                         + (tooLow && !isUpper_m) * (minval_m - value);
+                applySinkBC(value, minval_m, maxval_m, isUpper_m);
             }
 
             KOKKOS_DEFAULTED_FUNCTION
             ~SinkBC() = default;
         };
 
+        /*!
+         * The boundary conditions of all faces, applied to one position.
+         * Applying it to every particle gives the same result as
+         * ParticleLayout::applyBC, but it can be called from a kernel that
+         * also updates the position, saving a pass over the positions.
+         */
+        template <typename T, unsigned Dim>
+        struct PositionBC {
+            KOKKOS_DEFAULTED_FUNCTION
+            PositionBC() = default;
+
+            PositionBC(const std::array<BC, 2 * Dim>& bcs, const NDRegion<T, Dim>& nr) {
+                for (unsigned face = 0; face < 2 * Dim; ++face) {
+                    bcs_m[face] = bcs[face];
+                }
+                for (unsigned d = 0; d < Dim; ++d) {
+                    minval_m[d] = nr[d].min();
+                    maxval_m[d] = nr[d].max();
+                    extent_m[d] = nr[d].length();
+                    middle_m[d] = (minval_m[d] + maxval_m[d]) / 2;
+                }
+            }
+
+            KOKKOS_INLINE_FUNCTION void operator()(Vector<T, Dim>& pos) const {
+                // Same face order as ParticleLayout::applyBC
+                for (unsigned face = 0; face < 2 * Dim; ++face) {
+                    const unsigned d   = face / 2;
+                    const bool isUpper = face & 1;
+                    switch (bcs_m[face]) {
+                        case BC::PERIODIC:
+                            if (!isUpper) {
+                                applyPeriodicBC(pos[d], extent_m[d], middle_m[d]);
+                            }
+                            break;
+                        case BC::REFLECTIVE:
+                            applyReflectiveBC(pos[d], minval_m[d], maxval_m[d], isUpper);
+                            break;
+                        case BC::SINK:
+                            applySinkBC(pos[d], minval_m[d], maxval_m[d], isUpper);
+                            break;
+                        case BC::NO:
+                        default:
+                            break;
+                    }
+                }
+            }
+
+        private:
+            BC bcs_m[2 * Dim];
+            double minval_m[Dim];
+            double maxval_m[Dim];
+            double extent_m[Dim];
+            double middle_m[Dim];
+        };
+
     }  // namespace detail
 }  // namespace ippl
 
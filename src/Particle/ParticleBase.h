@@ -57,9 +57,12 @@
 
 #include "Types/IpplTypes.h"
 
+#include "Utility/IpplException.h"
 #include "Utility/TypeUtils.h"
 
+#include "Communicate/Compression.h"
 #include "Particle/ParticleLayout.h"
+#include "Particle/ParticleSort.h"
 
 namespace ippl {
 
@@ -108,8 +111,13 @@ namespace ippl {
 
         using hash_container_type = typename detail::ContainerForAllSpaces<detail::hash_type>::type;
 
+        using mask_container_type = typename detail::ContainerForAllSpaces<detail::mask_type>::type;
+
         using size_type = detail::size_type;
 
+        using spatial_sort_policy_type =
+            SpatialSortPolicy<typename vector_type::value_type, vector_type::dim>;
+
     public:
         //! view of particle positions
         particle_position_type R;
@@ -150,11 +158,21 @@ namespace ippl {
         void initialize(Layout_t& layout);
 
         /*!
-         * @returns processor local number of particles
+         * @returns processor local number of particles. In tombstone mode
+         * this is the number of slots, including getHoleCount() tombstones.
          */
         size_type getLocalNum() const { return localNum_m; }
 
-        void setLocalNum(size_type size) { localNum_m = size; }
+        /*!
+         * Set the number of local slots. Slots added in tombstone mode are live.
+         * @param size new number of local slots
+         */
+        void setLocalNum(size_type size) {
+            if (size > localNum_m) {
+                markLive(localNum_m, size);
+            }
+            localNum_m = size;
+        }
 
         /*!
          * @returns total number of particles (across all processes)
@@ -292,12 +310,95 @@ namespace ippl {
         // This is a collective call.
         void update() { layout_m->update(*this); }
 
+        /*!
+         * Enable tombstone mode. destroy() then only marks the destroyed
+         * particles as tombstones in a per-slot mask instead of compacting
+         * all attributes. The storage is compacted once the tombstones exceed
+         * the given fraction of the local slots, or by compact(). Layout
+         * updates and sortSpatially keep the tombstones. ParticleAttrib and
+         * ParticleAttribSoA expressions, ParticleAttrib reductions, the
+         * member scatter and gather and the Scatter, Gather and NUFFT engines
+         * skip tombstones; other kernels must check getValidMask().
+         * @param maxHoleFraction compaction threshold; a negative value
+         * disables tombstone mode and compacts the current tombstones
+         */
+        void setCompactionThreshold(double maxHoleFraction);
+
+        /*!
+         * Compress the messages of particle exchanges between ranks (see mpi::Compression).
+         * This is a collective setting: all ranks must use the same compression. The
+         * messages mix the attribute types, so only lossless compression is supported;
+         * wordSize should be the size of the dominant attribute scalar. Experimental, see
+         * mpi::Compression.
+         * @param compression the compression of subsequent sends and receives
+         */
+        void setCompression(const mpi::Compression& compression);
+
+        const mpi::Compression& getCompression() const { return compression_m; }
+
+        /*!
+         * @returns the number of local tombstones
+         */
+        size_type getHoleCount() const { return holeCount_m; }
+
+        /*!
+         * @tparam MemorySpace the memory space of the mask
+         * @returns the per-slot liveness mask, or an empty view if there are
+         * no tombstones
+         */
+        template <typename MemorySpace = typename particle_position_type::memory_space>
+        detail::mask_type<MemorySpace> getValidMask() const {
+            return holeCount_m > 0 ? validMask_m.template get<MemorySpace>()
+                                   : detail::mask_type<MemorySpace>();
+        }
+
+        /*!
+         * Remove all tombstones by moving live particles from the end of the
+         * storage into the holes. This is not a collective call.
+         */
+        void compact();
+
+        /*!
+         * Move the tombstones along with a permutation of the attributes,
+         * see ParticleAttrib::applyPermutation. Layouts which reorder the
+         * particles have to call this as well. This is not a collective call.
+         * @param newIndex destination slot of every slot in [0, getLocalNum())
+         */
+        template <typename HashType>
+        void permuteValidMask(const HashType& newIndex);
+
+        /*!
+         * Locality metric of the local particle storage order: the mean over
+         * all consecutive particle pairs (i, i+1) of the largest per-axis
+         * distance between their cells, i.e. how many cells apart a stencil
+         * centred on particle i+1 is from the one of particle i. Values near
+         * zero mean that neighbouring particles touch the same grid lines.
+         * @param cellWidth the cell size, usually the mesh spacing
+         * @returns the mean distance in cells (0 for fewer than two particles)
+         */
+        double meanStencilDistance(const vector_type& cellWidth) const;
+
+        /*!
+         * Reorder the local particles along a space-filling curve so that
+         * particles close in space are also close in memory, which improves
+         * the cache reuse of scatter, gather and pair interactions. All
+         * registered attributes are permuted. The curve is laid over the
+         * bounding box of the local particles with the policy's cell width.
+         * This is not a collective call.
+         * @param policy curve, cell width and adaptive trigger
+         * @returns whether the particles were reordered; false if the
+         * locality metric did not exceed policy.maxMeanDistance
+         */
+        bool sortSpatially(const spatial_sort_policy_type& policy);
+
         /*
          * The following functions should not be called in an application.
          */
 
         /* This function does not alter the totalNum_m member function. It should only be called
          * during the update function where we know the number of particles remains the same.
+         * Tombstones must not be part of the invalid set and destroyNum must not count them. In
+         * tombstone mode the invalid particles become tombstones as in destroy().
          */
         template <typename memory_space, typename execution_space, typename F,
                   typename... Properties>
@@ -329,15 +430,68 @@ namespace ippl {
         MPI_Request sendToRank(int rank, int tag, const HashType& hash);
 
         /*!
-         * Receives particles from another rank
+         * Sends particles to several ranks. Every attribute is packed for all destinations
+         * by a single kernel into one buffer per memory space, in which the message of each
+         * destination is contiguous; the host then waits once and posts one send per
+         * destination from its part of the buffer. The messages are the same as those of
+         * sendToRank, so they are received with postRecvFromRank or recvFromRank.
+         * @tparam HashType the hash view type
+         * @param ranks the destination ranks
+         * @param counts the number of particles sent to each destination
+         * @param tag the MPI tag
+         * @param hash the particles to send, grouped by destination in the order of ranks
+         * @param requests destination vector in which to store the MPI requests
+         */
+        template <typename HashType>
+        void sendToRanks(const std::vector<int>& ranks, const std::vector<size_type>& counts,
+                         int tag, const HashType& hash, std::vector<MPI_Request>& requests);
+
+        /*!
+         * Receives particles from another rank. In tombstone mode they fill the
+         * tombstones first; only the rest is appended.
          * @param rank the source rank
          * @param tag the MPI tag
          * @param nRecvs the number of particles to receive
          */
         void recvFromRank(int rank, int tag, size_type nRecvs);
 
-        std::pair<MPI_Request, std::function<void(size_type)>> postRecvFromRank(int rank, int tag,
-                                                                                size_type nRecvs);
+        /*!
+         * Posts the receive of particles from another rank
+         * @param rank the source rank
+         * @param tag the MPI tag
+         * @param nRecvs the number of particles to receive
+         * @returns the request and a function that stores the particles once the request
+         * has completed, in the tombstones first as recvFromRank
+         */
+        std::pair<MPI_Request, std::function<void()>> postRecvFromRank(int rank, int tag,
+                                                                      size_type nRecvs);
+
+        /*!
+         * Sends the contiguous particles [begin, begin + count) straight from the attribute
+         * storage, without packing them into a buffer. The particles must not be modified,
+         * and the attributes not resized, until the requests have completed.
+         * @param rank the destination rank
+         * @param tag the MPI tag
+         * @param begin index of the first particle to send
+         * @param count the number of particles to send
+         * @param requests destination vector in which to store the MPI requests
+         */
+        void sendBlockToRank(int rank, int tag, size_type begin, size_type count,
+                             std::vector<MPI_Request>& requests);
+
+        /*!
+         * Posts the receive of particles sent with sendBlockToRank straight into the attribute
+         * storage at [offset, offset + count). The capacity is grown before the receives are
+         * posted and must not change until the requests have completed. The local particle
+         * count is not changed.
+         * @param rank the source rank
+         * @param tag the MPI tag
+         * @param offset index of the first received particle
+         * @param count the number of particles to receive
+         * @param requests destination vector in which to store the MPI requests
+         */
+        void postRecvBlockFromRank(int rank, int tag, size_type offset, size_type count,
+                                   std::vector<MPI_Request>& requests);
 
         /*!
          * Serialize to do MPI calls.
@@ -400,6 +554,47 @@ namespace ippl {
         //! buffers for particle partitioning
         hash_container_type deleteIndex_m;
         hash_container_type keepIndex_m;
+
+        //! inverse permutation of sortSpatially, reused across calls
+        hash_container_type sortIndex_m;
+
+        //! destination slots of received particles, see takeReceiveSlots
+        hash_container_type recvSlots_m;
+
+        //! tombstone mode: liveness of the slots [0, localNum_m), valid if holeCount_m > 0
+        mask_container_type validMask_m;
+
+        //! number of tombstones in [0, localNum_m)
+        size_type holeCount_m = 0;
+
+        //! see setCompactionThreshold; negative if tombstone mode is off
+        double maxHoleFraction_m = -1;
+
+        //! see setCompression
+        mpi::Compression compression_m;
+
+        //! grow the masks of all spaces in use (and of MemorySpace) to n slots
+        template <typename MemorySpace>
+        void reserveValidMask(size_type n);
+
+        //! mark the slots [begin, end) live if there are tombstones
+        void markLive(size_type begin, size_type end);
+
+        /*!
+         * Take the slots for nRecvs received particles: the first tombstones in ascending
+         * order, then new slots behind the local ones. The slots are live afterwards.
+         * @returns whether any tombstone is filled; only then recvSlots_m holds the slots,
+         * otherwise they are [getLocalNum() - nRecvs, getLocalNum())
+         */
+        bool takeReceiveSlots(size_type nRecvs);
+
+        //! flag the invalid particles as tombstones and compact above the threshold
+        template <typename memory_space, typename execution_space, typename F>
+        void markTombstones(const F& invalid_functor, const size_type destroyNum);
+
+        //! move the live particles into the slots of the invalid ones and the tombstones
+        template <typename memory_space, typename execution_space, typename F>
+        void removeParticles(const F& invalid_functor, const size_type invalidNum);
     };
 }  // namespace ippl
 
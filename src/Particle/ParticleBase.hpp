@@ -75,6 +75,7 @@ namespace ippl {
     void ParticleBase<PLayout, IP...>::addAttribute(detail::ParticleAttribBase<MemorySpace>& pa) {
         attributes_m.template get<MemorySpace>().push_back(&pa);
         pa.setParticleCount(localNum_m);
+        pa.setValidMask(validMask_m.template get<MemorySpace>(), holeCount_m);
     }
 
     template <class PLayout, typename... IP>
@@ -114,10 +115,12 @@ namespace ippl {
             }
 
             // remember that we're creating these new particles
+            markLive(localNum_m, localNum_m + nLocal);
             localNum_m += nLocal;
         }
 
-        Comm->allreduce(localNum_m, totalNum_m, 1, std::plus<size_type>());
+        const size_type liveNum = localNum_m - holeCount_m;
+        Comm->allreduce(liveNum, totalNum_m, 1, std::plus<size_type>());
     }
 
     template <class PLayout, typename... IP>
@@ -169,14 +172,147 @@ namespace ippl {
                                                const size_type destroyNum) {
         this->internalDestroy(invalid, destroyNum);
 
-        Comm->allreduce(localNum_m, totalNum_m, 1, std::plus<size_type>());
+        const size_type liveNum = localNum_m - holeCount_m;
+        Comm->allreduce(liveNum, totalNum_m, 1, std::plus<size_type>());
+    }
+
+    template <class PLayout, typename... IP>
+    void ParticleBase<PLayout, IP...>::setCompactionThreshold(double maxHoleFraction) {
+        maxHoleFraction_m = maxHoleFraction;
+        if (maxHoleFraction_m < 0) {
+            compact();
+        }
+    }
+
+    template <class PLayout, typename... IP>
+    void ParticleBase<PLayout, IP...>::setCompression(const mpi::Compression& compression) {
+        if (compression.truncate) {
+            throw IpplException("ParticleBase::setCompression",
+                                "Particle messages cannot be truncated, they mix the attribute "
+                                "types.");
+        }
+        compression_m = compression;
+    }
+
+    template <class PLayout, typename... IP>
+    void ParticleBase<PLayout, IP...>::compact() {
+        if (holeCount_m == 0) {
+            return;
+        }
+        // removeParticles removes the tombstones on top of the (empty) invalid set
+        removeParticles<typename particle_position_type::memory_space,
+                        typename particle_position_type::execution_space>(
+            KOKKOS_LAMBDA(const size_t) { return false; }, 0);
+    }
+
+    template <class PLayout, typename... IP>
+    template <typename HashType>
+    void ParticleBase<PLayout, IP...>::permuteValidMask(const HashType& newIndex) {
+        if (holeCount_m == 0) {
+            return;
+        }
+        using memory_space    = typename HashType::memory_space;
+        using execution_space = typename HashType::execution_space;
+
+        reserveValidMask<memory_space>(localNum_m);
+
+        auto& mask = validMask_m.template get<memory_space>();
+        detail::mask_type<memory_space> permuted("permuted mask", localNum_m);
+        Kokkos::parallel_for(
+            "ParticleBase::permuteValidMask()", Kokkos::RangePolicy<execution_space>(0, localNum_m),
+            KOKKOS_LAMBDA(const size_t i) { permuted(newIndex(i)) = mask(i); });
+        Kokkos::deep_copy(Kokkos::subview(mask, std::make_pair(size_type(0), localNum_m)),
+                          permuted);
+
+        validMask_m.template copyToOtherSpaces<memory_space>([&]<typename MemorySpace>() {
+            return attributes_m.template get<MemorySpace>().size() > 0;
+        });
+    }
+
+    template <class PLayout, typename... IP>
+    template <typename MemorySpace>
+    void ParticleBase<PLayout, IP...>::reserveValidMask(size_type n) {
+        detail::runForAllSpaces([&]<typename Space>() {
+            if (attributes_m.template get<Space>().size() > 0
+                || std::is_same_v<Space, MemorySpace>) {
+                auto& mask = validMask_m.template get<Space>();
+                if (mask.size() < n) {
+                    int overalloc = Comm->getDefaultOverallocation();
+                    Kokkos::resize(mask, n * overalloc);
+                }
+            }
+        });
+    }
+
+    template <class PLayout, typename... IP>
+    void ParticleBase<PLayout, IP...>::markLive(size_type begin, size_type end) {
+        if (holeCount_m == 0 || begin >= end) {
+            return;
+        }
+        reserveValidMask<typename particle_position_type::memory_space>(end);
+        detail::runForAllSpaces([&]<typename MemorySpace>() {
+            auto& mask = validMask_m.template get<MemorySpace>();
+            if (mask.size() >= end) {
+                Kokkos::deep_copy(Kokkos::subview(mask, std::make_pair(begin, end)), true);
+            }
+        });
     }
 
     template <class PLayout, typename... IP>
     template <typename memory_space, typename execution_space, typename F, typename... Properties>
     void ParticleBase<PLayout, IP...>::internalDestroy(const F& invalid_functor,
                                                        const size_type destroyNum) {
-        PAssert(destroyNum <= localNum_m);
+        if (maxHoleFraction_m < 0) {
+            removeParticles<memory_space, execution_space>(invalid_functor, destroyNum);
+        } else {
+            markTombstones<memory_space, execution_space>(invalid_functor, destroyNum);
+        }
+    }
+
+    template <class PLayout, typename... IP>
+    template <typename memory_space, typename execution_space, typename F>
+    void ParticleBase<PLayout, IP...>::markTombstones(const F& invalid_functor,
+                                                      const size_type destroyNum) {
+        PAssert(destroyNum + holeCount_m <= localNum_m);
+        if (destroyNum == 0) {
+            return;
+        }
+
+        reserveValidMask<memory_space>(localNum_m);
+
+        auto& mask       = validMask_m.template get<memory_space>();
+        const bool fresh = holeCount_m == 0;
+        Kokkos::parallel_for(
+            "ParticleBase::destroy()::tombstones",
+            Kokkos::RangePolicy<execution_space>(0, localNum_m), KOKKOS_LAMBDA(const size_t i) {
+                mask(i) = (fresh || mask(i)) && !invalid_functor(i);
+            });
+        Kokkos::fence();
+        holeCount_m += destroyNum;
+
+        validMask_m.template copyToOtherSpaces<memory_space>([&]<typename MemorySpace>() {
+            return attributes_m.template get<MemorySpace>().size() > 0;
+        });
+
+        if (holeCount_m > maxHoleFraction_m * localNum_m) {
+            compact();
+        }
+    }
+
+    template <class PLayout, typename... IP>
+    template <typename memory_space, typename execution_space, typename F>
+    void ParticleBase<PLayout, IP...>::removeParticles(const F& invalid_functor,
+                                                       const size_type invalidNum) {
+        PAssert(invalidNum + holeCount_m <= localNum_m);
+
+        // Tombstones are removed together with the invalid particles
+        const size_type holes      = holeCount_m;
+        const size_type destroyNum = invalidNum + holes;
+        const auto valid           = getValidMask<memory_space>();
+        const auto isInvalid       = KOKKOS_LAMBDA(const size_t i)->bool {
+            return invalid_functor(i) || (holes > 0 && !valid(i));
+        };
+        holeCount_m = 0;
 
         // If there aren't any particles to delete, do nothing
         if (destroyNum == 0) {
@@ -217,10 +353,10 @@ namespace ippl {
         Kokkos::parallel_scan(
             "Scan in ParticleBase::destroy()", policy_type(0, localNum_m - destroyNum),
             KOKKOS_LAMBDA(const size_t i, int& idx, const bool final) {
-                if (final && invalid_functor(i)) {
+                if (final && isInvalid(i)) {
                     locDeleteIndex(idx) = i;
                 }
-                if (invalid_functor(i)) {
+                if (isInvalid(i)) {
                     idx += 1;
                 }
             });
@@ -242,10 +378,10 @@ namespace ippl {
             "Second scan in ParticleBase::destroy()",
             Kokkos::RangePolicy<size_type, execution_space>(localNum_m - destroyNum, localNum_m),
             KOKKOS_LAMBDA(const size_t i, int& idx, const bool final) {
-                if (final && !invalid_functor(i)) {
+                if (final && !isInvalid(i)) {
                     locKeepIndex(idx) = i;
                 }
-                if (!invalid_functor(i)) {
+                if (!isInvalid(i)) {
                     idx += 1;
                 }
             });
@@ -275,6 +411,113 @@ namespace ippl {
         });
     }
 
+    template <class PLayout, typename... IP>
+    double ParticleBase<PLayout, IP...>::meanStencilDistance(const vector_type& cellWidth) const {
+        using value_type       = typename vector_type::value_type;
+        constexpr unsigned Dim = vector_type::dim;
+        using policy_type =
+            Kokkos::RangePolicy<typename particle_position_type::execution_space>;
+
+        if (localNum_m < 2) {
+            return 0;
+        }
+
+        vector_type invdx;
+        for (unsigned d = 0; d < Dim; ++d) {
+            invdx[d] = value_type(1) / cellWidth[d];
+        }
+
+        auto positions = R.getView();
+        double sum     = 0;
+        Kokkos::parallel_reduce(
+            "ParticleBase::meanStencilDistance()", policy_type(0, localNum_m - 1),
+            KOKKOS_LAMBDA(const size_t i, double& dist) {
+                value_type maxDist = 0;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    const value_type delta = Kokkos::floor(positions(i + 1)[d] * invdx[d])
+                                             - Kokkos::floor(positions(i)[d] * invdx[d]);
+                    maxDist = Kokkos::max(maxDist, Kokkos::abs(delta));
+                }
+                dist += maxDist;
+            },
+            sum);
+        return sum / (localNum_m - 1);
+    }
+
+    template <class PLayout, typename... IP>
+    bool ParticleBase<PLayout, IP...>::sortSpatially(const spatial_sort_policy_type& policy) {
+        using value_type               = typename vector_type::value_type;
+        constexpr unsigned Dim         = vector_type::dim;
+        using position_execution_space = typename particle_position_type::execution_space;
+        using position_memory_space    = typename particle_position_type::memory_space;
+        using policy_type              = Kokkos::RangePolicy<position_execution_space>;
+
+        if (localNum_m < 2) {
+            return false;
+        }
+        if (policy.maxMeanDistance > 0
+            && meanStencilDistance(policy.cellWidth) <= policy.maxMeanDistance) {
+            return false;
+        }
+
+        static IpplTimings::TimerRef sortTimer = IpplTimings::getTimer("sortSpatially");
+        IpplTimings::startTimer(sortTimer);
+
+        const size_type n = localNum_m;
+        auto positions    = R.getView();
+
+        // Lay the curve over the bounding box of the local particles
+        vector_type origin, invdx;
+        Vector<size_t, Dim> ngrid;
+        for (unsigned d = 0; d < Dim; ++d) {
+            Kokkos::MinMaxScalar<value_type> extent;
+            Kokkos::parallel_reduce(
+                "ParticleBase::sortSpatially()::boundingBox", policy_type(0, n),
+                KOKKOS_LAMBDA(const size_t i, Kokkos::MinMaxScalar<value_type>& mm) {
+                    mm.min_val = Kokkos::min(mm.min_val, positions(i)[d]);
+                    mm.max_val = Kokkos::max(mm.max_val, positions(i)[d]);
+                },
+                Kokkos::MinMax<value_type>(extent));
+
+            origin[d] = extent.min_val;
+            invdx[d]  = value_type(1) / policy.cellWidth[d];
+            ngrid[d] =
+                static_cast<size_t>(Kokkos::floor((extent.max_val - extent.min_val) * invdx[d]))
+                + 1;
+        }
+
+        // permute(j) is the particle that moves to slot j; the keys and the
+        // permutation live in the shared BinSortBuffers
+        auto permute = detail::sortParticles<Dim, position_execution_space, value_type>(
+            positions, origin, invdx, ngrid, n, policy.curve);
+
+        // Attributes take the scatter form newIndex(i) = destination of particle i
+        auto& newIndex = sortIndex_m.template get<position_memory_space>();
+        if (newIndex.size() < n) {
+            int overalloc = Comm->getDefaultOverallocation();
+            Kokkos::realloc(newIndex, n * overalloc);
+        }
+        Kokkos::parallel_for(
+            "ParticleBase::sortSpatially()::invert", policy_type(0, n),
+            KOKKOS_LAMBDA(const size_t j) { newIndex(permute(j)) = j; });
+        Kokkos::fence();
+
+        sortIndex_m.template copyToOtherSpaces<position_memory_space>(
+            [&]<typename MemorySpace>() {
+                return attributes_m.template get<MemorySpace>().size() > 0;
+            });
+
+        forAllAttributes([&]<typename Attribute>(Attribute*& attribute) {
+            using att_memory_space = typename Attribute::memory_space;
+            attribute->applyPermutation(sortIndex_m.template get<att_memory_space>());
+        });
+        permuteValidMask(Kokkos::subview(newIndex, std::make_pair(size_type(0), n)));
+        Kokkos::fence();
+
+        IpplTimings::stopTimer(sortTimer);
+        return true;
+    }
+
     template <class PLayout, typename... IP>
     template <typename HashType>
     MPI_Request ParticleBase<PLayout, IP...>::sendToRank(int rank, int tag, const HashType& hash) {
@@ -295,7 +538,7 @@ namespace ippl {
                 att->serialize(*buf, hashes.template get<MemorySpace>(), nSends);
             });
 
-            Comm->isend(rank, tag++, *buf, request);
+            Comm->isend(rank, tag++, *buf, request, compression_m);
             buf->resetWritePos();
         });
         return request;
@@ -312,8 +555,59 @@ namespace ippl {
         requests.push_back(sendToRank(rank, tag, hash));
     }
 
+    template <class PLayout, typename... IP>
+    template <typename HashType>
+    void ParticleBase<PLayout, IP...>::sendToRanks(const std::vector<int>& ranks,
+                                                   const std::vector<size_type>& counts, int tag,
+                                                   const HashType& hash,
+                                                   std::vector<MPI_Request>& requests) {
+        PAssert_EQ(ranks.size(), counts.size());
+        const size_type nMessages = ranks.size();
+        if (nMessages == 0) {
+            return;
+        }
+
+        // Message m holds the particles [starts(m), starts(m + 1)) of the hash
+        Kokkos::View<size_type*, Kokkos::HostSpace> starts_h("starts", nMessages + 1);
+        starts_h(0) = 0;
+        for (size_type m = 0; m < nMessages; ++m) {
+            starts_h(m + 1) = starts_h(m) + counts[m];
+        }
+        const size_type nSends = starts_h(nMessages);
+        PAssert(nSends <= hash.size());
+
+        auto hashes = hash_container_type(hash, [&]<typename MemorySpace>() {
+            return attributes_m.template get<MemorySpace>().size() > 0;
+        });
+        detail::runForAllSpaces([&]<typename MemorySpace>() {
+            const size_type bytesPerParticle = packedSize<MemorySpace>(1);
+            if (bytesPerParticle == 0) {
+                return;
+            }
+            auto buf = Comm->getBuffer<MemorySpace>(bytesPerParticle * nSends);
+
+            detail::MessageLayout<MemorySpace> layout{
+                Kokkos::create_mirror_view_and_copy(MemorySpace(), starts_h), bytesPerParticle};
+            forAllAttributes<MemorySpace>([&]<typename Attribute>(Attribute& att) {
+                att->serializeMessages(*buf, hashes.template get<MemorySpace>(), layout, nSends);
+            });
+            Kokkos::fence();
+
+            for (size_type m = 0; m < nMessages; ++m) {
+                MPI_Request request = MPI_REQUEST_NULL;
+                Comm->isend(ranks[m], tag, *buf, bytesPerParticle * starts_h(m),
+                            bytesPerParticle * counts[m], request, compression_m);
+                requests.push_back(request);
+            }
+            buf->resetWritePos();
+            tag++;
+        });
+    }
+
     template <class PLayout, typename... IP>
     void ParticleBase<PLayout, IP...>::recvFromRank(int rank, int tag, size_type nRecvs) {
+        const size_type offset = localNum_m;
+        const bool intoHoles   = takeReceiveSlots(nRecvs);
         detail::runForAllSpaces([&]<typename MemorySpace>() {
             size_type bufSize = packedSize<MemorySpace>(nRecvs);
             if (bufSize == 0) {
@@ -322,48 +616,138 @@ namespace ippl {
 
             auto buf = Comm->getBuffer<MemorySpace>(bufSize);
 
-            Comm->recv(rank, tag++, *buf, bufSize);
+            Comm->recv(rank, tag++, *buf, bufSize, compression_m);
+            const auto& slots = recvSlots_m.template get<MemorySpace>();
             forAllAttributes<MemorySpace>([&]<typename Attribute>(Attribute& att) {
-                att->deserialize(*buf, localNum_m, nRecvs);
+                if (intoHoles) {
+                    att->deserialize(*buf, slots, nRecvs);
+                } else {
+                    att->deserialize(*buf, offset, nRecvs);
+                }
             });
 
             buf->resetReadPos();
         });
-        localNum_m += nRecvs;
     }
 
     template <class PLayout, typename... IP>
-    std::pair<MPI_Request, std::function<void(size_t)>>
+    std::pair<MPI_Request, std::function<void()>>
     ParticleBase<PLayout, IP...>::postRecvFromRank(int rank, int tag, size_type nRecvs) {
         MPI_Request request = MPI_REQUEST_NULL;
 
         // Collect (buf, nRecvs) per memory space for deferred deserialization
-        auto deferred = std::make_shared<std::vector<std::function<void(size_type)>>>();
+        auto deferred = std::make_shared<std::vector<std::function<void(size_type, bool)>>>();
 
         detail::runForAllSpaces([&]<typename MemorySpace>() {
             size_type bufSize = packedSize<MemorySpace>(nRecvs);
             if (bufSize == 0)
                 return;
 
-            auto buf = Comm->getBuffer<MemorySpace>(bufSize);
-            Comm->irecv(rank, tag++, *buf, request, bufSize);
+            auto buf     = Comm->getBuffer<MemorySpace>(bufSize);
+            auto message = Comm->irecv(rank, tag++, *buf, request, bufSize, compression_m);
 
-            deferred->push_back([this, buf, nRecvs](size_type offset) {
+            deferred->push_back([this, buf, message, nRecvs](size_type offset, bool intoHoles) {
+                Comm->decompress(message, *buf);
+                const auto& slots = recvSlots_m.template get<MemorySpace>();
                 forAllAttributes<MemorySpace>([&]<typename Attribute>(Attribute& att) {
-                    att->deserialize(*buf, offset, nRecvs);
+                    if (intoHoles) {
+                        att->deserialize(*buf, slots, nRecvs);
+                    } else {
+                        att->deserialize(*buf, offset, nRecvs);
+                    }
                 });
                 buf->resetReadPos();
             });
         });
 
-        // Finalize takes the offset (localNum_m after destruction) and advances it
-        return {request, [this, deferred, nRecvs](size_type offset) {
+        // The slots are taken when the message is stored, in arrival order
+        return {request, [this, deferred, nRecvs]() {
+                    const size_type offset = localNum_m;
+                    const bool intoHoles   = takeReceiveSlots(nRecvs);
                     for (auto& fn : *deferred)
-                        fn(offset);
-                    localNum_m += nRecvs;
+                        fn(offset, intoHoles);
                 }};
     }
 
+    template <class PLayout, typename... IP>
+    bool ParticleBase<PLayout, IP...>::takeReceiveSlots(size_type nRecvs) {
+        const size_type numLoc = localNum_m;
+        const size_type nFill  = std::min(holeCount_m, nRecvs);
+        if (nFill == 0) {
+            markLive(numLoc, numLoc + nRecvs);
+            localNum_m += nRecvs;
+            return false;
+        }
+
+        using memory_space    = typename particle_position_type::memory_space;
+        using execution_space = typename particle_position_type::execution_space;
+        using policy_type     = Kokkos::RangePolicy<execution_space>;
+
+        auto& slots = recvSlots_m.template get<memory_space>();
+        if (slots.size() < nRecvs) {
+            int overalloc = Comm->getDefaultOverallocation();
+            Kokkos::realloc(slots, nRecvs * overalloc);
+        }
+
+        // The first nFill tombstones, followed by the appended slots
+        auto& mask = validMask_m.template get<memory_space>();
+        Kokkos::parallel_scan(
+            "ParticleBase::takeReceiveSlots()::holes", policy_type(0, numLoc),
+            KOKKOS_LAMBDA(const size_t i, size_type& idx, const bool final) {
+                if (!mask(i)) {
+                    if (final && idx < nFill) {
+                        slots(idx) = i;
+                    }
+                    ++idx;
+                }
+            });
+        Kokkos::parallel_for(
+            "ParticleBase::takeReceiveSlots()::fill", policy_type(0, nRecvs),
+            KOKKOS_LAMBDA(const size_t k) {
+                if (k < nFill) {
+                    mask(slots(k)) = true;
+                } else {
+                    slots(k) = numLoc + (k - nFill);
+                }
+            });
+        Kokkos::fence();
+        holeCount_m -= nFill;
+
+        auto filter = [&]<typename MemorySpace>() {
+            return attributes_m.template get<MemorySpace>().size() > 0;
+        };
+        validMask_m.template copyToOtherSpaces<memory_space>(filter);
+        recvSlots_m.template copyToOtherSpaces<memory_space>(filter);
+
+        markLive(numLoc, numLoc + nRecvs - nFill);
+        localNum_m += nRecvs - nFill;
+        forAllAttributes([&]<typename Attribute>(Attribute*& attribute) {
+            attribute->reserve(localNum_m);
+        });
+        return true;
+    }
+
+    template <class PLayout, typename... IP>
+    void ParticleBase<PLayout, IP...>::sendBlockToRank(int rank, int tag, size_type begin,
+                                                       size_type count,
+                                                       std::vector<MPI_Request>& requests) {
+        // MPI reads the attribute memory directly, pending kernels must have written it
+        Kokkos::fence();
+        forAllAttributes([&]<typename Attribute>(Attribute& att) {
+            att->sendBlock(rank, tag, begin, count, requests);
+        });
+    }
+
+    template <class PLayout, typename... IP>
+    void ParticleBase<PLayout, IP...>::postRecvBlockFromRank(int rank, int tag, size_type offset,
+                                                             size_type count,
+                                                             std::vector<MPI_Request>& requests) {
+        forAllAttributes([&]<typename Attribute>(Attribute& att) {
+            att->recvBlock(rank, tag, offset, count, requests);
+        });
+        markLive(offset, offset + count);
+    }
+
     template <class PLayout, typename... IP>
     template <typename Archive>
     void ParticleBase<PLayout, IP...>::serialize(Archive& ar, size_type nsends) {
@@ -410,6 +794,7 @@ namespace ippl {
                 att[j]->unpack(nrecvs);
             }
         });
+        markLive(localNum_m, localNum_m + nrecvs);
         localNum_m += nrecvs;
     }
 }  // namespace ippl
@@ -85,10 +85,12 @@ namespace ippl {
 
             /*!
              * Apply the given boundary conditions to the current particle positions.
+             * @tparam PositionAttrib particle_position_type or ParticleAttribSoA
              * @param R is the particle position attribute
              * @param nr is the particle domain
              */
-            void applyBC(const particle_position_type& R, const NDRegion<T, Dim>& nr);
+            template <class PositionAttrib>
+            void applyBC(const PositionAttrib& R, const NDRegion<T, Dim>& nr);
 
         private:
             //! the list of boundary conditions for this set of particles
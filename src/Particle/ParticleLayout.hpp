@@ -31,7 +31,8 @@
 namespace ippl {
     namespace detail {
         template <typename T, unsigned Dim, typename... Properties>
-        void ParticleLayout<T, Dim, Properties...>::applyBC(const particle_position_type& R,
+        template <class PositionAttrib>
+        void ParticleLayout<T, Dim, Properties...>::applyBC(const PositionAttrib& R,
                                                             const NDRegion<T, Dim>& nr) {
             /* loop over all faces
              * 0: lower x-face
@@ -40,8 +41,9 @@ namespace ippl {
              * 3: upper y-face
              * etc...
              */
-            Kokkos::RangePolicy<typename particle_position_type::execution_space> policy{
+            Kokkos::RangePolicy<typename PositionAttrib::execution_space> policy{
                 0, (unsigned)R.getParticleCount()};
+            R.markModified();
             for (unsigned face = 0; face < 2 * Dim; ++face) {
                 // unsigned face = i % Dim;
                 unsigned d   = face / 2;
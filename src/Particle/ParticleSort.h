@@ -9,6 +9,8 @@
 #include <stdexcept>
 #include <vector>
 
+#include "Types/Vector.h"
+
 #include "Particle/SortBuffer.h"
 
 #ifdef KOKKOS_ENABLE_CUDA
@@ -20,6 +22,32 @@
 #endif
 
 namespace ippl {
+    /*!
+     * Space-filling curves available for spatial particle sorting.
+     */
+    enum class SpaceFillingCurve {
+        Morton,  //!< Z-order, cheapest key
+        Hilbert  //!< better locality, consecutive cells are always neighbours
+    };
+
+    /*!
+     * Parameters of ParticleBase::sortSpatially.
+     * @tparam T position component type
+     * @tparam Dim spatial dimension
+     */
+    template <typename T, unsigned Dim>
+    struct SpatialSortPolicy {
+        //! Width of the cells that are ordered along the curve, usually the mesh spacing
+        Vector<T, Dim> cellWidth;
+
+        SpaceFillingCurve curve = SpaceFillingCurve::Hilbert;
+
+        //! Sort only when the mean stencil distance between consecutive particles
+        //! (ParticleBase::meanStencilDistance) exceeds this many cells; a value
+        //! <= 0 sorts unconditionally
+        double maxMeanDistance = 1.0;
+    };
+
     namespace detail {
 
         /**
@@ -63,6 +91,34 @@ namespace ippl {
             }
         }
 
+        /**
+         * @brief Number of bits per dimension used by the space-filling-curve keys
+         *
+         * 21 bits in 1D-3D; higher dimensions use fewer bits so that the
+         * interleaved key still fits into 63 bits.
+         */
+        template <unsigned Dim>
+        constexpr int curveBitsPerDim() {
+            return Dim <= 3 ? 21 : 63 / static_cast<int>(Dim);
+        }
+
+        /**
+         * @brief Quantize a position to grid indices, wrapping into [0, ngrid)
+         */
+        template <unsigned Dim, typename T, typename IndexType>
+        KOKKOS_INLINE_FUNCTION void computeCurveIndices(const Vector<T, Dim>& position,
+                                                        const Vector<T, Dim>& origin,
+                                                        const Vector<T, Dim>& invdx,
+                                                        const Vector<IndexType, Dim>& ngrid,
+                                                        uint32_t (&gridIndices)[Dim]) {
+            constexpr uint32_t mask = (uint32_t(1) << curveBitsPerDim<Dim>()) - 1;
+            for (unsigned d = 0; d < Dim; ++d) {
+                T sx = (position[d] - origin[d]) * invdx[d];
+                sx -= ngrid[d] * Kokkos::floor(sx / ngrid[d]);  // wrap to [0, ngrid)
+                gridIndices[d] = static_cast<uint32_t>(sx) & mask;
+            }
+        }
+
         /**
          * @brief Compute Morton code (Z-order curve) for spatial sorting
          */
@@ -72,14 +128,10 @@ namespace ippl {
                                                           const Vector<T, Dim>& invdx,
                                                           const Vector<IndexType, Dim>& ngrid) {
             uint64_t morton            = 0;
-            constexpr int bits_per_dim = 21;  // 21*3 = 63 bits, safe for 3D
+            constexpr int bits_per_dim = curveBitsPerDim<Dim>();
 
             uint32_t gridIndices[Dim];
-            for (unsigned d = 0; d < Dim; ++d) {
-                T sx = (position[d] - origin[d]) * invdx[d];
-                sx -= ngrid[d] * Kokkos::floor(sx / ngrid[d]);  // wrap to [0, ngrid)
-                gridIndices[d] = static_cast<uint32_t>(sx);
-            }
+            computeCurveIndices<Dim, T, IndexType>(position, origin, invdx, ngrid, gridIndices);
 
             for (int bit = 0; bit < bits_per_dim; ++bit) {
                 for (unsigned d = 0; d < Dim; ++d) {
@@ -91,6 +143,78 @@ namespace ippl {
             return morton;
         }
 
+        /**
+         * @brief Compute Hilbert code for spatial sorting
+         *
+         * Uses Skilling's transform ("Programming the Hilbert curve", AIP Conf.
+         * Proc. 707, 2004) to turn the grid indices into the transposed Hilbert
+         * index, which is then bit-interleaved like a Morton code. Unlike the
+         * Z-order curve, consecutive Hilbert keys are always face neighbours,
+         * so runs of sorted particles never jump across the domain.
+         */
+        template <unsigned Dim, typename T, typename IndexType = size_t>
+        KOKKOS_INLINE_FUNCTION uint64_t computeHilbertCode(const Vector<T, Dim>& position,
+                                                           const Vector<T, Dim>& origin,
+                                                           const Vector<T, Dim>& invdx,
+                                                           const Vector<IndexType, Dim>& ngrid) {
+            constexpr int bits_per_dim = curveBitsPerDim<Dim>();
+
+            uint32_t x[Dim];
+            computeCurveIndices<Dim, T, IndexType>(position, origin, invdx, ngrid, x);
+
+            // Inverse undo
+            for (uint32_t q = uint32_t(1) << (bits_per_dim - 1); q > 1; q >>= 1) {
+                const uint32_t p = q - 1;
+                for (unsigned d = 0; d < Dim; ++d) {
+                    if (x[d] & q) {
+                        x[0] ^= p;
+                    } else {
+                        const uint32_t t = (x[0] ^ x[d]) & p;
+                        x[0] ^= t;
+                        x[d] ^= t;
+                    }
+                }
+            }
+
+            // Gray encode
+            for (unsigned d = 1; d < Dim; ++d) {
+                x[d] ^= x[d - 1];
+            }
+            uint32_t t = 0;
+            for (uint32_t q = uint32_t(1) << (bits_per_dim - 1); q > 1; q >>= 1) {
+                if (x[Dim - 1] & q) {
+                    t ^= q - 1;
+                }
+            }
+            for (unsigned d = 0; d < Dim; ++d) {
+                x[d] ^= t;
+            }
+
+            // Interleave, most significant bit of x[0] first
+            uint64_t hilbert = 0;
+            for (int bit = bits_per_dim - 1; bit >= 0; --bit) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    hilbert = (hilbert << 1) | ((x[d] >> bit) & 1u);
+                }
+            }
+            return hilbert;
+        }
+
+        /**
+         * @brief Compute the key of the given space-filling curve
+         */
+        template <unsigned Dim, typename T, typename IndexType = size_t>
+        KOKKOS_INLINE_FUNCTION uint64_t computeCurveCode(SpaceFillingCurve curve,
+                                                         const Vector<T, Dim>& position,
+                                                         const Vector<T, Dim>& origin,
+                                                         const Vector<T, Dim>& invdx,
+                                                         const Vector<IndexType, Dim>& ngrid) {
+            if (curve == SpaceFillingCurve::Hilbert) {
+                return computeHilbertCode<Dim, T, IndexType>(position, origin, invdx, ngrid);
+            }
+            return computeMortonCode<Dim, T, IndexType>(position, origin, invdx, ngrid);
+        }
+
         /**
          * @brief Functor to compute Morton codes for all particles
          */
@@ -103,9 +227,11 @@ namespace ippl {
             Vector<T, Dim> origin;
             Vector<T, Dim> invdx;
             Vector<size_type, Dim> ngrid;
+            SpaceFillingCurve curve = SpaceFillingCurve::Morton;
 
             KOKKOS_INLINE_FUNCTION void operator()(size_type i) const {
-                keys(i) = computeMortonCode<Dim, T, size_type>(positions(i), origin, invdx, ngrid);
+                keys(i) = computeCurveCode<Dim, T, size_type>(curve, positions(i), origin, invdx,
+                                                              ngrid);
             }
         };
 
@@ -114,7 +240,7 @@ namespace ippl {
         // -------------------------------------------------------------------
 
         /**
-         * @brief Sort particles on host using std::sort on (morton, index) pairs
+         * @brief Sort particles on host using std::sort on (curve key, index) pairs
          *
          * @return Subview of the buffered permute array, valid until next ensureCapacity
          */
@@ -122,7 +248,8 @@ namespace ippl {
         Kokkos::View<size_t*, Kokkos::HostSpace> sortParticlesHost(
             Kokkos::View<Vector<T, Dim>*, Kokkos::HostSpace> positions,
             const Vector<T, Dim>& origin, const Vector<T, Dim>& invdx,
-            const Vector<size_t, Dim>& ngrid, size_t n) {
+            const Vector<size_t, Dim>& ngrid, size_t n,
+            SpaceFillingCurve curve = SpaceFillingCurve::Morton) {
             auto& bufs = ippl::detail::getDefaultBinSortBuffers<Kokkos::HostSpace>();
             bufs.ensureCapacity(n, /*n_bins_p1=*/1);
 
@@ -131,8 +258,8 @@ namespace ippl {
             // Build (key, index) pairs, sort, then extract permutation
             std::vector<std::pair<uint64_t, size_t>> pairs(n);
             for (size_t i = 0; i < n; ++i) {
-                pairs[i] = {computeMortonCode<Dim, T, size_t>(positions(i), origin, invdx, ngrid),
-                            i};
+                pairs[i] = {
+                    computeCurveCode<Dim, T, size_t>(curve, positions(i), origin, invdx, ngrid), i};
             }
             std::sort(pairs.begin(), pairs.end());  // pair has lexicographic < by .first
 
@@ -153,7 +280,8 @@ namespace ippl {
         Kokkos::View<size_t*, Kokkos::CudaSpace> sortParticlesCuda(
             Kokkos::View<Vector<T, Dim>*, Kokkos::CudaSpace> positions,
             const Vector<T, Dim>& origin, const Vector<T, Dim>& invdx,
-            const Vector<size_t, Dim>& ngrid, size_t n) {
+            const Vector<size_t, Dim>& ngrid, size_t n,
+            SpaceFillingCurve curve = SpaceFillingCurve::Morton) {
             using size_type = size_t;
             auto& bufs      = ippl::detail::getDefaultBinSortBuffers<Kokkos::CudaSpace>();
             bufs.ensureCapacity(n, /*n_bins_p1=*/1);
@@ -165,7 +293,7 @@ namespace ippl {
             Kokkos::parallel_for(
                 "MortonSort::ComputeKeys", Kokkos::RangePolicy<Kokkos::Cuda>(0, n),
                 ComputeMortonCodesFunctor<Dim, decltype(positions), T, decltype(keys)>{
-                    positions, keys, origin, invdx, ngrid});
+                    positions, keys, origin, invdx, ngrid, curve});
 
             Kokkos::parallel_for(
                 "MortonSort::InitPermute", Kokkos::RangePolicy<Kokkos::Cuda>(0, n),
@@ -200,7 +328,8 @@ namespace ippl {
         template <unsigned Dim, typename T>
         Kokkos::View<size_t*, Kokkos::HIPSpace> sortParticlesHip(
             Kokkos::View<Vector<T, Dim>*, Kokkos::HIPSpace> positions, const Vector<T, Dim>& origin,
-            const Vector<T, Dim>& invdx, const Vector<size_t, Dim>& ngrid, size_t n) {
+            const Vector<T, Dim>& invdx, const Vector<size_t, Dim>& ngrid, size_t n,
+            SpaceFillingCurve curve = SpaceFillingCurve::Morton) {
             using size_type = size_t;
             auto& bufs      = ippl::detail::getDefaultBinSortBuffers<Kokkos::HIPSpace>();
             bufs.ensureCapacity(n, /*n_bins_p1=*/1);
@@ -211,7 +340,7 @@ namespace ippl {
             Kokkos::parallel_for(
                 "MortonSort::ComputeKeys", Kokkos::RangePolicy<Kokkos::HIP>(0, n),
                 ComputeMortonCodesFunctor<Dim, decltype(positions), T, decltype(keys)>{
-                    positions, keys, origin, invdx, ngrid});
+                    positions, keys, origin, invdx, ngrid, curve});
 
             Kokkos::parallel_for(
                 "MortonSort::InitPermute", Kokkos::RangePolicy<Kokkos::HIP>(0, n),
@@ -244,21 +373,22 @@ namespace ippl {
         Kokkos::View<size_t*, typename ExecSpace::memory_space> sortParticles(
             Kokkos::View<Vector<T, Dim>*, typename ExecSpace::memory_space> positions,
             const Vector<T, Dim>& origin, const Vector<T, Dim>& invdx,
-            const Vector<size_t, Dim>& ngrid, size_t n) {
+            const Vector<size_t, Dim>& ngrid, size_t n,
+            SpaceFillingCurve curve = SpaceFillingCurve::Morton) {
             using memory_space = typename ExecSpace::memory_space;
 
 #ifdef KOKKOS_ENABLE_CUDA
             if constexpr (std::is_same_v<ExecSpace, Kokkos::Cuda>) {
-                return sortParticlesCuda<Dim, T>(positions, origin, invdx, ngrid, n);
+                return sortParticlesCuda<Dim, T>(positions, origin, invdx, ngrid, n, curve);
             }
 #endif
 #ifdef KOKKOS_ENABLE_HIP
             if constexpr (std::is_same_v<ExecSpace, Kokkos::HIP>) {
-                return sortParticlesHip<Dim, T>(positions, origin, invdx, ngrid, n);
+                return sortParticlesHip<Dim, T>(positions, origin, invdx, ngrid, n, curve);
             }
 #endif
             if constexpr (std::is_same_v<memory_space, Kokkos::HostSpace>) {
-                return sortParticlesHost<Dim, T>(positions, origin, invdx, ngrid, n);
+                return sortParticlesHost<Dim, T>(positions, origin, invdx, ngrid, n, curve);
             } else {
                 // Generic fallback: sort on host, copy result to device buffer
                 auto positions_host =
@@ -269,7 +399,7 @@ namespace ippl {
                     ngrid_host[d] = ngrid[d];
 
                 auto permute_host =
-                    sortParticlesHost<Dim, T>(positions_host, origin, invdx, ngrid_host, n);
+                    sortParticlesHost<Dim, T>(positions_host, origin, invdx, ngrid_host, n, curve);
 
                 auto& bufs = ippl::detail::getDefaultBinSortBuffers<memory_space>();
                 bufs.ensureCapacity(n, /*n_bins_p1=*/1);
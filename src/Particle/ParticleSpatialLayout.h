@@ -23,6 +23,7 @@
 #ifndef IPPL_PARTICLE_SPATIAL_LAYOUT_H
 #define IPPL_PARTICLE_SPATIAL_LAYOUT_H
 
+#include <memory>
 #include <vector>
 
 #include "Types/IpplTypes.h"
@@ -45,7 +46,12 @@ namespace ippl {
         // Two-sided point-to-point: per-rank Isend/Irecv over device pointers.
         P2P,
         // Collective Alltoall over device pointers.
-        Alltoall
+        Alltoall,
+        // MPI_Neighbor_alltoall on a distributed-graph communicator of the
+        // spatial neighbors. Used whenever no particle left the neighborhood
+        // of its rank in this update (checked with one global reduction);
+        // falls back to Alltoall otherwise.
+        Neighbor
     };
 
     /*!
@@ -80,11 +86,32 @@ namespace ippl {
 
         ~ParticleSpatialLayout() = default;
 
+        //! Number of updates in which the neighbor-only count exchange was used
+        size_type getNeighborExchangeCount() const { return neighborExchanges_m; }
+
+        //! Number of updates in which the Neighbor mode fell back to Alltoall
+        size_type getGlobalFallbackCount() const { return globalFallbacks_m; }
+
         void updateLayout(FieldLayout<Dim>&, Mesh&);
 
         template <class ParticleContainer>
         void update(ParticleContainer& pc);
 
+        /*!
+         * Move the particles and redistribute them in one go. Equivalent to
+         * updating the positions with `push`, then calling update(), but the
+         * push, the boundary conditions and the destination-rank lookup run
+         * in a single kernel, which saves two passes over the positions.
+         * This is a collective call.
+         * @tparam PushFunctor callable as `push(i, r)` on the device, with
+         * `size_t i` the particle index and `vector_type& r` its position,
+         * which the functor updates in place (e.g. `r += dt * P(i)`)
+         * @param pc the particle container
+         * @param push the position update
+         */
+        template <class ParticleContainer, class PushFunctor>
+        void pushAndLocate(ParticleContainer& pc, const PushFunctor& push);
+
         const RegionLayout_t& getRegionLayout() const { return *rlayout_m; }
 
     protected:
@@ -107,6 +134,27 @@ namespace ippl {
         // MPI RMA window for one-sided communication
         mpi::rma::Window<mpi::rma::Active> window_m;
 
+        //
+        // Neighbor Path
+        //
+
+        // Distinct spatial neighbor ranks (without this rank), in the order of
+        // the distributed-graph communicator
+        std::vector<int> graphNeighbors_m;
+
+        // isGraphNeighbor_m[r] is true if rank r is in graphNeighbors_m
+        std::vector<bool> isGraphNeighbor_m;
+
+        // Distributed-graph communicator of the spatial neighbors
+        std::shared_ptr<MPI_Comm> neighborComm_m;
+
+        // Send / receive counts per graph neighbor
+        std::vector<int> neighborSendCounts_m;
+        std::vector<int> neighborRecvCounts_m;
+
+        size_type neighborExchanges_m = 0;
+        size_type globalFallbacks_m   = 0;
+
         //
         // P2P GPU Path
         //
@@ -139,25 +187,46 @@ namespace ippl {
         /*!
          * For each local particle, determine its destination rank, write the
          * indices of leaving particles into `sendIds_d_`, populate the
-         * per-rank send-count and offset buffers, build a compacted list of
-         * destination ranks, and mark each particle's "is leaving" status in
-         * `leaving_d_` so the destroy pass doesn't have to recompute it.
+         * per-rank send-count and offset buffers, and store each particle's
+         * destination in `destRank_d_` so that neither the fill pass nor the
+         * destroy pass has to search the regions again.
          * @return number of leaving particles on this rank
          */
         template <typename ParticleContainer>
         size_t locateParticlesPacked(const ParticleContainer& pc);
 
     private:
-        // Fixed-size scratch
-        locate_type rankSendCount_d_;  // [nRanks]
-        locate_type sendOffsets_d_;    // [nRanks+1]
+        /*!
+         * Implementation of locateParticlesPacked. If UpdatePositions is set,
+         * the counting pass first applies `push` and the boundary
+         * conditions `bc` to every position and writes it back.
+         */
+        template <bool UpdatePositions, typename ParticleContainer, typename PushFunctor>
+        size_t locateParticlesImpl(const ParticleContainer& pc, const PushFunctor& push,
+                                   const detail::PositionBC<T, Dim>& bc);
+
+        /*!
+         * Steps 2-4 of update(): exchange the counts, send the particles found
+         * by locateParticlesPacked, destroy them locally and receive.
+         *
+         * The host waits for the device once before the count exchange, since
+         * the counts and the message sizes passed to MPI are host values, and
+         * once after packing. Each attribute is packed for all destinations by
+         * a single kernel (see ParticleBase::sendToRanks); the attributes are
+         * type-erased, so they cannot share one kernel.
+         * @param nInvalid number of leaving particles on this rank
+         */
+        template <class ParticleContainer>
+        void exchangeParticles(ParticleContainer& pc, size_type nInvalid);
+
+        // Fixed-size scratch. The send counts and offsets are views into one
+        // contiguous buffer so that a single copy brings them to the host.
+        locate_type sendMeta_d_;       // [2 * nRanks + 1] counts | offsets
+        locate_type rankSendCount_d_;  // [nRanks] view into sendMeta_d_
+        locate_type sendOffsets_d_;    // [nRanks+1] view into sendMeta_d_
         hash_type sendIds_d_;          // [capacity >= max nInvalid seen]
         locate_type cursor_d_;         // [nRanks] per-rank insertion cursor
-        locate_type destRanks_d_;      // [nRanks] (compacted list)
-        bool_type leaving_d_;          // [capacity >= max nLocal seen] mask
-
-        // Single scalar on device to count destinations
-        Kokkos::View<size_type, position_memory_space> nDest_d_;
+        locate_type destRank_d_;       // [capacity >= max nLocal seen] rank per particle
 
         // Neigbour cache
         locate_type neighbors_d_;          // [neighborSize] cached device neighbors list
@@ -170,26 +239,36 @@ namespace ippl {
         using host_mem_space   = Kokkos::HostSpace;
         using locate_host_type = typename detail::ViewType<int, 1, host_mem_space>::view_type;
 
-        locate_host_type rankSendCount_h_;  // [nRanks] (mirror)
-        locate_host_type sendOffsets_h_;    // [nRanks+1] (mirror)
-        locate_host_type destRanks_h_;      // [nRanks] (mirror)
+        locate_host_type sendMeta_h_;       // [2 * nRanks + 1] (mirror)
+        locate_host_type rankSendCount_h_;  // [nRanks] view into sendMeta_h_
+        locate_host_type sendOffsets_h_;    // [nRanks+1] view into sendMeta_h_
 
         // Host-side destination list
         std::vector<int> destinationRanks_host_;
 
         // capacities
-        size_t sendIds_capacity_ = 0;
-        size_t leaving_capacity_ = 0;
-        int nRanks_              = 0;
+        size_t sendIds_capacity_  = 0;
+        size_t destRank_capacity_ = 0;
+        int nRanks_               = 0;
 
         void initScratch(int nRanks);
         void ensureSendCapacity(size_t nInvalid);
-        void ensureLeavingCapacity(size_t nLocal);
+        void ensureDestRankCapacity(size_t nLocal);
         void ensureNeighborsCached();
 
         void countExchangeRMA();
         void countExchangeP2P();
         void countExchangeAlltoall();
+
+        /*!
+         * Exchange the send counts with the graph neighbors only. All ranks
+         * first agree whether every leaving particle goes to a neighbor.
+         * @return false if some rank has a non-neighbor destination; nothing
+         * has been exchanged in that case
+         */
+        bool countExchangeNeighbor();
+
+        void buildNeighborGraph();
     };
 }  // namespace ippl
 
@@ -112,6 +112,74 @@ namespace ippl {
                      Comm->getCommunicator());
     }
 
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::buildNeighborGraph() {
+        const int myRank = Comm->rank();
+
+        graphNeighbors_m.clear();
+        for (int r : neighbors_host_) {
+            if (r != myRank) {
+                graphNeighbors_m.push_back(r);
+            }
+        }
+        // Periodic layouts may list the same rank for several faces or corners
+        std::sort(graphNeighbors_m.begin(), graphNeighbors_m.end());
+        graphNeighbors_m.erase(std::unique(graphNeighbors_m.begin(), graphNeighbors_m.end()),
+                               graphNeighbors_m.end());
+
+        isGraphNeighbor_m.assign(nRanks_, false);
+        for (int r : graphNeighbors_m) {
+            isGraphNeighbor_m[r] = true;
+        }
+
+        neighborSendCounts_m.assign(graphNeighbors_m.size(), 0);
+        neighborRecvCounts_m.assign(graphNeighbors_m.size(), 0);
+
+        // The neighbor relation of the field layout is symmetric, hence the
+        // sources and destinations of the graph are the same ranks
+        const int degree = static_cast<int>(graphNeighbors_m.size());
+        MPI_Comm graph;
+        MPI_Dist_graph_create_adjacent(Comm->getCommunicator(), degree, graphNeighbors_m.data(),
+                                       MPI_UNWEIGHTED, degree, graphNeighbors_m.data(),
+                                       MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &graph);
+
+        neighborComm_m = std::shared_ptr<MPI_Comm>(new MPI_Comm(graph), [](MPI_Comm* comm) {
+            int finalized = 0;
+            MPI_Finalized(&finalized);
+            if (!finalized) {
+                MPI_Comm_free(comm);
+            }
+            delete comm;
+        });
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    bool ParticleSpatialLayout<T, Dim, Mesh, Properties...>::countExchangeNeighbor() {
+        const int myRank = Comm->rank();
+
+        int local = 1;
+        for (int rank : destinationRanks_host_) {
+            if (rank != myRank && !isGraphNeighbor_m[rank]) {
+                local = 0;
+                break;
+            }
+        }
+
+        int global = 0;
+        MPI_Allreduce(&local, &global, 1, MPI_INT, MPI_MIN, Comm->getCommunicator());
+        if (global == 0) {
+            return false;
+        }
+
+        for (size_t k = 0; k < graphNeighbors_m.size(); ++k) {
+            neighborSendCounts_m[k] = rankSendCount_h_(graphNeighbors_m[k]);
+        }
+
+        MPI_Neighbor_alltoall(neighborSendCounts_m.data(), 1, MPI_INT,
+                              neighborRecvCounts_m.data(), 1, MPI_INT, *neighborComm_m);
+        return true;
+    }
+
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
     template <class ParticleContainer>
     void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::update(ParticleContainer& pc) {
@@ -146,26 +214,81 @@ namespace ippl {
 
         const size_type nInvalid = locateParticlesPacked(pc);
 
-        // Copy metadata to host
-        size_type nDest = 0;
-        Kokkos::deep_copy(position_execution_space{}, nDest, nDest_d_);
+        IpplTimings::stopTimer(locateTimer);
+
+        exchangeParticles(pc, nInvalid);
 
-        // destRanks prefix
-        if (nDest > 0) {
-            Kokkos::deep_copy(
-                position_execution_space{},
-                Kokkos::subview(destRanks_h_, std::make_pair(size_t(0), size_t(nDest))),
-                Kokkos::subview(destRanks_d_, std::make_pair(size_t(0), size_t(nDest))));
+        IpplTimings::stopTimer(ParticleUpdateTimer);
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer, class PushFunctor>
+    void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::pushAndLocate(
+        ParticleContainer& pc, const PushFunctor& push) {
+        static IpplTimings::TimerRef pushLocateTimer = IpplTimings::getTimer("pushAndLocate");
+        IpplTimings::startTimer(pushLocateTimer);
+
+        const detail::PositionBC<T, Dim> bc(this->getParticleBC(), rlayout_m->getDomain());
+        pc.R.markModified();
+
+        if (nRanks_ < 2) {
+            // Tombstones are left untouched, as in locateParticlesImpl
+            auto positions    = pc.R.getView();
+            const auto valid  = pc.template getValidMask<position_memory_space>();
+            const bool masked = valid.extent(0) > 0;
+            Kokkos::parallel_for(
+                "PSL::pushAndLocate",
+                Kokkos::RangePolicy<size_t, position_execution_space>(0, pc.getLocalNum()),
+                KOKKOS_LAMBDA(const size_t i) {
+                    if (masked && !valid(i)) {
+                        return;
+                    }
+                    vector_type r = positions(i);
+                    push(i, r);
+                    bc(r);
+                    positions(i) = r;
+                });
+            Kokkos::fence();
+            IpplTimings::stopTimer(pushLocateTimer);
+            return;
         }
 
-        // counts + offsets
-        Kokkos::deep_copy(position_execution_space{}, rankSendCount_h_, rankSendCount_d_);
-        Kokkos::deep_copy(position_execution_space{}, sendOffsets_h_, sendOffsets_d_);
+        ensureNeighborsCached();
 
-        // Build host destination list without allocation
+        const size_type nInvalid = locateParticlesImpl<true>(pc, push, bc);
+
+        IpplTimings::stopTimer(pushLocateTimer);
+
+        static IpplTimings::TimerRef ParticleUpdateTimer = IpplTimings::getTimer("updateParticle");
+        IpplTimings::startTimer(ParticleUpdateTimer);
+
+        exchangeParticles(pc, nInvalid);
+
+        IpplTimings::stopTimer(ParticleUpdateTimer);
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::exchangeParticles(
+        ParticleContainer& pc, size_type nInvalid) {
+        static IpplTimings::TimerRef locateTimer = IpplTimings::getTimer("locateParticles");
+        IpplTimings::startTimer(locateTimer);
+
+        // Copy counts and offsets to host in one transfer. This is the only
+        // fence before the sends; it cannot be avoided because the count
+        // exchange and the MPI message sizes need the counts on the host.
+        // The destination list is derived from the counts, which costs
+        // O(nRanks) on the host but saves a device compaction kernel and a
+        // second copy.
+        Kokkos::deep_copy(position_execution_space{}, sendMeta_h_, sendMeta_d_);
+        position_execution_space{}.fence();
+
+        const int myRank = Comm->rank();
         destinationRanks_host_.clear();
-        for (size_t i = 0; i < (size_t)nDest; ++i)
-            destinationRanks_host_.push_back(destRanks_h_(i));
+        for (int rank = 0; rank < nRanks_; ++rank) {
+            if (rank != myRank && rankSendCount_h_(rank) > 0)
+                destinationRanks_host_.push_back(rank);
+        }
 
         IpplTimings::stopTimer(locateTimer);
 
@@ -176,41 +299,29 @@ namespace ippl {
         static IpplTimings::TimerRef preprocTimer = IpplTimings::getTimer("sendPreprocess");
         IpplTimings::startTimer(preprocTimer);
 
+        bool neighborOnly = false;
         if (countExchangeMode_ == CountExchange::RMA) {
             countExchangeRMA();
         } else if (countExchangeMode_ == CountExchange::P2P) {
             countExchangeP2P();
+        } else if (countExchangeMode_ == CountExchange::Neighbor) {
+            neighborOnly = countExchangeNeighbor();
+            if (neighborOnly) {
+                ++neighborExchanges_m;
+            } else {
+                ++globalFallbacks_m;
+                countExchangeAlltoall();
+            }
         } else {
             countExchangeAlltoall();
         }
 
         IpplTimings::stopTimer(preprocTimer);
 
-        // 2.2 Particle Sends
-
-        static IpplTimings::TimerRef sendTimer = IpplTimings::getTimer("particleSend");
-        IpplTimings::startTimer(sendTimer);
-
-        std::vector<MPI_Request> requests;
-        requests.reserve(destinationRanks_host_.size());
-
         int tag = Comm->next_tag(mpi::tag::P_SPATIAL_LAYOUT, mpi::tag::P_LAYOUT_CYCLE);
 
-        for (int rank : destinationRanks_host_) {
-            if (rank == Comm->rank())
-                continue;
-            const size_type count = static_cast<size_type>(rankSendCount_h_(rank));
-            if (count == 0)
-                continue;
-            const size_type begin = static_cast<size_type>(sendOffsets_h_(rank));
-            auto ids_sub =
-                Kokkos::subview(sendIds_d_, std::make_pair((size_t)begin, (size_t)(begin + count)));
-            requests.push_back(pc.sendToRank(rank, tag, ids_sub));
-        }
-
-        IpplTimings::stopTimer(sendTimer);
-
-        // 2.3 Post receives
+        // 2.2 Post receives before packing, so that messages from fast
+        // senders land directly in their buffers while we are still packing
 
         static IpplTimings::TimerRef recvTimer = IpplTimings::getTimer("particleRecv");
         IpplTimings::startTimer(recvTimer);
@@ -218,7 +329,14 @@ namespace ippl {
         std::vector<std::pair<int, size_type>> recvList;
         size_type totalRecvs = 0;
 
-        if (countExchangeMode_ == CountExchange::RMA) {
+        if (neighborOnly) {
+            for (size_t k = 0; k < graphNeighbors_m.size(); ++k) {
+                if (neighborRecvCounts_m[k] > 0) {
+                    recvList.push_back({graphNeighbors_m[k], neighborRecvCounts_m[k]});
+                    totalRecvs += static_cast<size_type>(neighborRecvCounts_m[k]);
+                }
+            }
+        } else if (countExchangeMode_ == CountExchange::RMA) {
             for (int rank = 0; rank < nRanks_; ++rank) {
                 if (nRecvs_m[rank] > 0) {
                     recvList.push_back({rank, nRecvs_m[rank]});
@@ -237,7 +355,7 @@ namespace ippl {
         }
 
         std::vector<MPI_Request> recvRequests(recvList.size(), MPI_REQUEST_NULL);
-        std::vector<std::function<void(size_type)>> finalizers(recvList.size());
+        std::vector<std::function<void()>> finalizers(recvList.size());
 
         for (size_t i = 0; i < recvList.size(); ++i) {
             auto [rank, count] = recvList[i];
@@ -248,40 +366,44 @@ namespace ippl {
 
         IpplTimings::stopTimer(recvTimer);
 
+        // 2.3 Particle Sends. The particles in sendIds_d_ are already grouped
+        // by destination in rank order, so every attribute is packed for all
+        // destinations by one kernel and all sends are posted after one fence.
+
+        static IpplTimings::TimerRef sendTimer = IpplTimings::getTimer("particleSend");
+        IpplTimings::startTimer(sendTimer);
+
+        std::vector<MPI_Request> requests;
+        requests.reserve(destinationRanks_host_.size());
+
+        std::vector<size_type> sendCounts;
+        sendCounts.reserve(destinationRanks_host_.size());
+        for (int rank : destinationRanks_host_) {
+            sendCounts.push_back(static_cast<size_type>(rankSendCount_h_(rank)));
+        }
+        auto ids = Kokkos::subview(sendIds_d_, std::make_pair((size_t)0, (size_t)nInvalid));
+        pc.sendToRanks(destinationRanks_host_, sendCounts, tag, ids, requests);
+
+        IpplTimings::stopTimer(sendTimer);
+
         // 3. Internal destruction of invalid particles ======================================= //
 
         static IpplTimings::TimerRef destroyTimer = IpplTimings::getTimer("particleDestroy");
         IpplTimings::startTimer(destroyTimer);
 
-        // locateParticlesPacked already wrote the per-particle "is leaving"
-        // mask into leaving_d_. Reuse it instead of re-running the full
-        // region search inside the destroy predicate.
-        auto leaving = leaving_d_;
+        // locateParticlesPacked already wrote the per-particle destination
+        // into destRank_d_. Reuse it instead of re-running the full region
+        // search inside the destroy predicate.
+        auto destRank = destRank_d_;
         pc.template internalDestroy<position_memory_space, position_execution_space>(
-            KOKKOS_LAMBDA(size_t i) { return leaving(i); }, nInvalid);
+            KOKKOS_LAMBDA(size_t i) { return destRank(i) != myRank; }, nInvalid);
         Kokkos::fence();
         const size_type localAfterDestroy = pc.getLocalNum();
 
         IpplTimings::stopTimer(destroyTimer);
 
-        static IpplTimings::TimerRef waitTimer = IpplTimings::getTimer("particleWait");
-        IpplTimings::startTimer(waitTimer);
-
-        requests.insert(requests.end(), recvRequests.begin(), recvRequests.end());
-        if (!requests.empty()) {
-            MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
-        }
-
-        IpplTimings::stopTimer(waitTimer);
-
-        static IpplTimings::TimerRef freeBufferTimer = IpplTimings::getTimer("particleFreeBuffers");
-        IpplTimings::startTimer(freeBufferTimer);
+        // 4. Receive and deserialize ========================================================= //
 
-        Comm->freeAllBuffers();
-
-        IpplTimings::stopTimer(freeBufferTimer);
-
-        // 5. Deserialize
         static IpplTimings::TimerRef deserializeTimer =
             IpplTimings::getTimer("particleDeserialize");
         IpplTimings::startTimer(deserializeTimer);
@@ -299,18 +421,41 @@ namespace ippl {
 
         IpplTimings::stopTimer(deserializeResizeTimer);
 
+        // Unpack every message as soon as it has arrived instead of waiting
+        // for the slowest sender. The order of the received particles hence
+        // depends on the arrival order.
         static IpplTimings::TimerRef deserializeCopyTimer =
             IpplTimings::getTimer("particleDeserCopy");
         IpplTimings::startTimer(deserializeCopyTimer);
 
-        for (auto& finalize : finalizers) {
-            finalize(pc.getLocalNum());
+        for (size_t n = 0; n < recvRequests.size(); ++n) {
+            int index = MPI_UNDEFINED;
+            MPI_Waitany(static_cast<int>(recvRequests.size()), recvRequests.data(), &index,
+                        MPI_STATUS_IGNORE);
+            if (index == MPI_UNDEFINED) {
+                break;
+            }
+            finalizers[index]();
         }
 
         IpplTimings::stopTimer(deserializeCopyTimer);
         IpplTimings::stopTimer(deserializeTimer);
 
-        IpplTimings::stopTimer(ParticleUpdateTimer);
+        static IpplTimings::TimerRef waitTimer = IpplTimings::getTimer("particleWait");
+        IpplTimings::startTimer(waitTimer);
+
+        if (!requests.empty()) {
+            MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        IpplTimings::stopTimer(waitTimer);
+
+        static IpplTimings::TimerRef freeBufferTimer = IpplTimings::getTimer("particleFreeBuffers");
+        IpplTimings::startTimer(freeBufferTimer);
+
+        Comm->freeAllBuffers();
+
+        IpplTimings::stopTimer(freeBufferTimer);
     }
 
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
@@ -344,10 +489,27 @@ namespace ippl {
         return totalSize;
     }
 
+    namespace detail {
+        //! Position update of the plain locate pass, which leaves R untouched
+        struct NoPositionUpdate {
+            template <typename VectorType>
+            KOKKOS_INLINE_FUNCTION void operator()(size_t, VectorType&) const {}
+        };
+    }  // namespace detail
+
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
     template <typename ParticleContainer>
     size_t ParticleSpatialLayout<T, Dim, Mesh, Properties...>::locateParticlesPacked(
         const ParticleContainer& pc) {
+        return locateParticlesImpl<false>(pc, detail::NoPositionUpdate{},
+                                          detail::PositionBC<T, Dim>{});
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <bool UpdatePositions, typename ParticleContainer, typename PushFunctor>
+    size_t ParticleSpatialLayout<T, Dim, Mesh, Properties...>::locateParticlesImpl(
+        const ParticleContainer& pc, const PushFunctor& push,
+        const detail::PositionBC<T, Dim>& bc) {
         const int nRanks       = Comm->size();
         const size_type myRank = Comm->rank();
 
@@ -363,51 +525,65 @@ namespace ippl {
         // Reset small device buffers
         Kokkos::deep_copy(rankSendCount_d_, size_type(0));
         Kokkos::deep_copy(cursor_d_, size_type(0));
-        Kokkos::deep_copy(nDest_d_, size_type(0));
 
         const size_type neighbors_used = neighbors_used_;
         auto& neighbours_d             = neighbors_d_;
 
         // Destination rank computation (no per-particle storage)
-        auto destRankOf = KOKKOS_LAMBDA(const size_t i)->size_type {
-            if (positionInRegion(is, positions(i), Regions(myRank)))
+        auto destRankOf = KOKKOS_LAMBDA(const vector_type& pos)->size_type {
+            if (positionInRegion(is, pos, Regions(myRank)))
                 return myRank;
 
             for (int j = 0; j < static_cast<int>(neighbors_used); ++j) {
                 const int r = neighbours_d(j);
-                if (positionInRegion(is, positions(i), Regions(r)))
+                if (positionInRegion(is, pos, Regions(r)))
                     return r;
             }
 
             // slow-path: global scan
             for (int r = 0; r < static_cast<int>(Regions.extent(0)); ++r) {
-                if (positionInRegion(is, positions(i), Regions(r)))
+                if (positionInRegion(is, pos, Regions(r)))
                     return r;
             }
 
             // Inclusive fallback: catches particles sitting exactly on a region
             // lower boundary that the strict > check above missed (e.g. (0,0,0))
             for (int r = 0; r < static_cast<int>(Regions.extent(0)); ++r) {
-                if (positionInRegionInclusive(is, positions(i), Regions(r)))
+                if (positionInRegionInclusive(is, pos, Regions(r)))
                     return r;
             }
             return myRank;  // truly outside all regions - applyBC should have prevented this
         };
 
-        // Make sure the leaving-mask buffer is large enough; it's reused across
+        // Make sure the destination buffer is large enough; it's reused across
         // updates to avoid reallocation.
-        ensureLeavingCapacity(pc.getLocalNum());
-        auto& leaving_d = leaving_d_;
+        ensureDestRankCapacity(pc.getLocalNum());
+        auto& destRank_d = destRank_d_;
 
-        // Pass 1: compute send counts + nInvalid + per-particle "is leaving"
+        // Pass 1: compute send counts + nInvalid + per-particle destination.
+        // In the fused push the new position is computed, wrapped and stored
+        // here, so the region lookup works on registers.
+        // Tombstones stay on this rank and are not sent.
         size_type nInvalid    = 0;
         auto& rankSendCount_d = rankSendCount_d_;
+        const auto valid      = pc.template getValidMask<position_memory_space>();
+        const bool masked     = valid.extent(0) > 0;
         Kokkos::parallel_reduce(
             "PSL::packed_count", policy_type(0, pc.getLocalNum()),
             KOKKOS_LAMBDA(const size_t i, size_type& inval) {
-                const size_type dest = destRankOf(i);
+                if (masked && !valid(i)) {
+                    destRank_d(i) = static_cast<int>(myRank);
+                    return;
+                }
+                vector_type pos = positions(i);
+                if constexpr (UpdatePositions) {
+                    push(i, pos);
+                    bc(pos);
+                    positions(i) = pos;
+                }
+                const size_type dest = destRankOf(pos);
                 const bool leaves    = (dest != myRank);
-                leaving_d(i)         = leaves;
+                destRank_d(i)        = static_cast<int>(dest);
                 inval += leaves;
                 if (leaves)
                     Kokkos::atomic_fetch_add(&rankSendCount_d(dest), size_type(1));
@@ -428,14 +604,13 @@ namespace ippl {
                 if (r < (size_t)nRanks)
                     upd += rankSendCount_d(r);
             });
-        Kokkos::fence();
 
         // Pass 2: fill packed send IDs into sendIds_d_ (prefix [0, nInvalid))
         auto& cursor_d  = cursor_d_;
         auto& sendIds_d = sendIds_d_;
         Kokkos::parallel_for(
             "PSL::packed_fill", policy_type(0, pc.getLocalNum()), KOKKOS_LAMBDA(const size_t i) {
-                const size_type dest = destRankOf(i);
+                const size_type dest = destRank_d(i);
                 if (dest == myRank)
                     return;
 
@@ -444,40 +619,27 @@ namespace ippl {
 
                 sendIds_d(base + pos) = static_cast<typename hash_type::non_const_value_type>(i);
             });
-        Kokkos::fence();
-
-        // Build destination rank list on device (compact), store length in nDest_d_
-        auto& destRanks_d = destRanks_d_;
-        auto& nDest_d     = nDest_d_;
-        Kokkos::parallel_for(
-            "PSL::packed_destRanks", policy_type(0, (size_t)nRanks), KOKKOS_LAMBDA(const size_t r) {
-                if ((size_type)r == myRank)
-                    return;
-                if (rankSendCount_d(r) > 0) {
-                    const size_type idx = Kokkos::atomic_fetch_add(&nDest_d(), size_type(1));
-                    destRanks_d(idx)    = static_cast<int>(r);
-                }
-            });
-        Kokkos::fence();
 
+        // No fence: the kernels above are ordered on the execution space, and
+        // update() fences once after copying the counts and offsets to host
         return nInvalid;
     }
 
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
     void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::initScratch(int nRanks) {
-        Kokkos::realloc(rankSendCount_d_, nRanks);
-        Kokkos::realloc(sendOffsets_d_, nRanks + 1);
+        const auto counts  = std::make_pair(size_t(0), size_t(nRanks));
+        const auto offsets = std::make_pair(size_t(nRanks), size_t(2 * nRanks + 1));
+
+        Kokkos::realloc(sendMeta_d_, 2 * nRanks + 1);
+        rankSendCount_d_ = Kokkos::subview(sendMeta_d_, counts);
+        sendOffsets_d_   = Kokkos::subview(sendMeta_d_, offsets);
         Kokkos::realloc(cursor_d_, nRanks);
-        Kokkos::realloc(destRanks_d_, nRanks);
         Kokkos::realloc(recvCounts_d_, nRanks);
 
-        // scalar counter
-        nDest_d_ = Kokkos::View<size_type, position_memory_space>("nDest_d");
-
         // Host mirrors
-        Kokkos::realloc(rankSendCount_h_, nRanks);
-        Kokkos::realloc(sendOffsets_h_, nRanks + 1);
-        Kokkos::realloc(destRanks_h_, nRanks);
+        Kokkos::realloc(sendMeta_h_, 2 * nRanks + 1);
+        rankSendCount_h_ = Kokkos::subview(sendMeta_h_, counts);
+        sendOffsets_h_   = Kokkos::subview(sendMeta_h_, offsets);
 
         destinationRanks_host_.clear();
         destinationRanks_host_.reserve(nRanks);
@@ -498,16 +660,16 @@ namespace ippl {
     }
 
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
-    void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::ensureLeavingCapacity(size_t nLocal) {
-        if (nLocal <= leaving_capacity_)
+    void ParticleSpatialLayout<T, Dim, Mesh, Properties...>::ensureDestRankCapacity(size_t nLocal) {
+        if (nLocal <= destRank_capacity_)
             return;
 
-        size_t newCap = leaving_capacity_ ? leaving_capacity_ : size_t(1024);
+        size_t newCap = destRank_capacity_ ? destRank_capacity_ : size_t(1024);
         while (newCap < nLocal)
             newCap *= 2;
 
-        leaving_capacity_ = newCap;
-        Kokkos::realloc(leaving_d_, newCap);
+        destRank_capacity_ = newCap;
+        Kokkos::realloc(destRank_d_, newCap);
     }
 
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
@@ -541,6 +703,10 @@ namespace ippl {
             Kokkos::subview(neighbors_d_, std::make_pair(size_t(0), size_t(neighborSize))),
             Kokkos::subview(neighbors_h, std::make_pair(size_t(0), size_t(neighborSize))));
 
+        if (countExchangeMode_ == CountExchange::Neighbor && nRanks_ > 1) {
+            buildNeighborGraph();
+        }
+
         neighbors_dirty_ = false;
     }
 
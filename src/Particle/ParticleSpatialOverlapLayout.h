@@ -14,6 +14,12 @@
 //   frequency of load balancing (N), or may supply a function to
 //   determine if load balancing should be done or not.
 //
+//   With a Verlet skin (setVerletSkin), update() reuses the cells and the ghosts as long as no
+//   particle has moved by more than half the skin. Particles are neither migrated nor wrapped
+//   by the boundary conditions in between, so update() also rebuilds as soon as a particle
+//   leaves the region of its rank. Owned positions hence always lie in the local region, and
+//   field operations such as scatter see the same positions as without a skin.
+//
 #ifndef IPPL_PARTICLE_SPATIAL_OVERLAP_LAYOUT_H
 #define IPPL_PARTICLE_SPATIAL_OVERLAP_LAYOUT_H
 
@@ -127,6 +133,25 @@ namespace ippl {
         template <class ParticleContainer>
         void update(ParticleContainer& pc);
 
+        /*!
+         * @brief enables the reuse of the cell structure across updates (Verlet skin). The cells
+         *        and the ghost particles are built for the range rcutoff + skin, and update()
+         *        only rebuilds them once some particle has moved by more than skin / 2 since the
+         *        last rebuild or some particle has left the region of its rank. In between,
+         *        update() refreshes the ghost copies from their owners and neither migrates
+         *        particles nor applies the boundary conditions.
+         * @param skin additional range, 0 rebuilds the cells in every update
+         */
+        void setVerletSkin(T skin);
+
+        T getVerletSkin() const { return skin_m; }
+
+        //! Number of updates which rebuilt the cells with a nonzero skin
+        size_type getCellRebuildCount() const { return cellRebuilds_m; }
+
+        //! Number of updates which reused the cells
+        size_type getCellReuseCount() const { return cellReuses_m; }
+
         /*!
          * @brief call functor for each combination i, j. make sure to call update first
          * @tparam ExecutionSpace Space in which to generate all indices
@@ -137,6 +162,53 @@ namespace ippl {
         template <typename ExecutionSpace, typename Functor>
         void forEachPair(Functor&& f) const;
 
+        /*!
+         * @brief call functor once for each unordered pair i, j of particles in neighboring
+         *        cells, where i is a local particle (Newton's third law). Pairs of local
+         *        particles are visited from one side only, using the same cell with i < j and
+         *        the forward half of the neighbor cells. Pairs with a ghost particle are visited
+         *        from the local side; the rank owning the ghost visits the pair itself.
+         *
+         *        Ghosts never receive j-side contributions: if j is a ghost, aj is discarded.
+         *        There is no reverse ghost communication; the owner of the ghost obtains its side
+         *        from its own visit of the pair, in which it is particle i. The contribution to ai
+         *        must therefore be the one aj would receive with i and j swapped.
+         * @tparam ExecutionSpace Space in which to generate all indices
+         * @tparam Attribute particle attribute to accumulate into
+         * @tparam Functor type of loop body
+         * @param attrib attribute to which the contributions are added
+         * @param f loop body f(i, j, ai, aj) adding the contributions of the pair to ai and aj.
+         * It returns whether it contributed anything, such that the update of j can be skipped.
+         */
+        template <typename ExecutionSpace, typename Attribute, typename Functor>
+        void forEachUniquePair(Attribute& attrib, Functor&& f) const;
+
+        /*!
+         * @brief enables the cluster-pair mode. buildCells then groups the particles of every
+         *        cell into clusters of clusterSize consecutive particles and lists the pairs of
+         *        clusters whose bounding boxes are closer than the overlap.
+         * @param clusterSize 4 or 8, 0 disables the cluster pair list
+         */
+        void setClusterSize(unsigned clusterSize);
+
+        unsigned getClusterSize() const { return clusterSize_m; }
+
+        /*!
+         * @brief call functor for each combination i, j of the cluster pair list, where i are the
+         *        local particles. The inner loop over a pair of clusters has a fixed trip count
+         *        and no branches: padding slots and i == j are masked out after calling f, so f
+         *        must be safe to call for these indices (its result is discarded). Each i is
+         *        updated by one thread, hence no atomics are needed. Requires setClusterSize
+         *        and update.
+         * @tparam ExecutionSpace Space in which to generate all indices
+         * @tparam Attribute particle attribute to accumulate into
+         * @tparam Functor type of loop body
+         * @param attrib attribute to which the contributions are added
+         * @param f loop body f(i, j) returning the contribution of j to particle i
+         */
+        template <typename ExecutionSpace, typename Attribute, typename Functor>
+        void forEachClusterPair(Attribute& attrib, Functor&& f) const;
+
         /*!
          * @return the proxy of the particle neighbor list data needed to get particle neighbors
          */
@@ -261,6 +333,50 @@ namespace ippl {
         using CellIndex_t     = Vector<size_type, Dim>;
         using FlatCellIndex_t = typename CellIndex_t::value_type;
 
+        using position_view_type = Kokkos::View<vector_type*, position_memory_space>;
+
+        ///! Verlet skin added to rcutoff_m for the cells and the ghost regions
+        T skin_m = 0;
+        ///! whether the ghost plan matches the current particle storage
+        bool ghostPlanValid_m = false;
+        ///! permutation of the last buildCells, old index -> new index
+        hash_type cellSortIndex_m;
+        ///! positions of the local particles at the last rebuild
+        position_view_type referencePositions_m;
+        ///! number of tombstones among the local particles at the last rebuild
+        size_type numHoles_m = 0;
+        ///! source particle and periodic shift of every ghost copy to create, self copies first
+        hash_type ghostSource_m;
+        position_view_type ghostShift_m;
+        ///! number of ghost copies which stay on this rank (periodic images)
+        size_type numSelfGhosts_m = 0;
+        ///! (rank, count) of the remote copies, in ghostSource_m order
+        std::vector<std::pair<int, size_type>> ghostSends_m;
+        ///! (rank, count) of the received ghosts, in arrival order
+        std::vector<std::pair<int, size_type>> ghostRecvs_m;
+        ///! cell-sorted slot and scratch index of every ghost in arrival order
+        hash_type ghostSlot_m;
+        hash_type ghostScratch_m;
+        size_type cellRebuilds_m = 0;
+        size_type cellReuses_m   = 0;
+
+        ///! the range covered by the cells and the ghost regions
+        T overlap() const { return rcutoff_m + skin_m; }
+
+        ///! number of particles per cluster, 0 if the cluster-pair mode is disabled
+        unsigned clusterSize_m = 0;
+        ///! the number of clusters in local cells, they come first
+        size_type numLocalClusters_m = 0;
+        ///! first particle and number of particles of every cluster
+        hash_type clusterFirst_m;
+        hash_type clusterCount_m;
+        ///! bounding box of every cluster
+        position_view_type clusterLo_m;
+        position_view_type clusterHi_m;
+        ///! local cluster k interacts with clusterPairs_m(clusterPairOffset_m(k)), ...
+        hash_type clusterPairOffset_m;
+        hash_type clusterPairs_m;
+
     public:
         /*!
          * @brief initializes all data necessary for the cells
@@ -277,7 +393,8 @@ namespace ippl {
 
         /*!
          * @brief builds the cell structure, sorts the particles according to the cells and makes
-         *         sure only local particles are counted towards pc.getLocalNum()
+         *         sure only local particles are counted towards pc.getLocalNum(). Tombstones
+         *         are in no cell; they are sorted behind the particles of the local cells.
          * @param pc particle container of which to sort the particles
          */
         template <class ParticleContainer>
@@ -292,6 +409,70 @@ namespace ippl {
         void createPeriodicGhostParticles(ParticleContainer& pc);
 
     protected:
+        /*!
+         * @brief migrates the particles to their owners, then creates the ghosts from the ghost
+         *        plan and builds the cells. Records the plan for refreshGhosts.
+         * @param pc particle container to update
+         */
+        template <class ParticleContainer>
+        void rebuildWithSkin(ParticleContainer& pc);
+
+        /*!
+         * @brief groups the cell-sorted particles into clusters and builds the cluster pair list
+         * @param pc particle container, sorted by buildCells
+         * @param numParticles number of particles including the ghosts
+         */
+        template <class ParticleContainer>
+        void buildClusters(const ParticleContainer& pc, size_type numParticles);
+
+        template <typename ExecutionSpace, unsigned ClusterSize, typename Attribute,
+                  typename Functor>
+        void forEachClusterPairImpl(Attribute& attrib, const Functor& f) const;
+
+        /*!
+         * @brief determines for every local particle the ranks and periodic images it is a ghost
+         *        of and exchanges the resulting counts
+         * @param pc particle container with owned particles only
+         */
+        template <class ParticleContainer>
+        void buildGhostPlan(ParticleContainer& pc);
+
+        /*!
+         * @brief appends the ghosts of the plan at index base: the self copies, followed by the
+         *        copies received from the other ranks
+         * @param pc particle container
+         * @param base index of the first ghost
+         */
+        template <class ParticleContainer>
+        void exchangeGhosts(ParticleContainer& pc, size_type base);
+
+        /*!
+         * @brief overwrites the ghosts with the current data of their owners
+         * @param pc particle container
+         */
+        template <class ParticleContainer>
+        void refreshGhosts(ParticleContainer& pc);
+
+        /*!
+         * @brief collective check whether the cells need to be rebuilt
+         * @param pc particle container
+         * @return true if there is no valid plan, some particle moved by more than skin / 2 or
+         * some particle left the region of this rank
+         */
+        template <class ParticleContainer>
+        bool needsRebuild(const ParticleContainer& pc) const;
+
+        /*!
+         * @brief periodic image shift with index n in [0, 3^Dim). Digit d of n in base 3 selects
+         *        the shift -1, 0, +1 times the domain length in dimension d.
+         * @param shift output shift
+         * @return false if the image shifts a non-periodic dimension
+         */
+        KOKKOS_INLINE_FUNCTION static bool imageShift(size_type n,
+                                                      const Kokkos::Array<bool, Dim>& periodic,
+                                                      const vector_type& length,
+                                                      vector_type& shift);
+
         /*!
          * @brief determines whether a position is within overlap to the boundary of a region
          * @param pos position to query
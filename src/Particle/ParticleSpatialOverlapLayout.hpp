@@ -20,7 +20,6 @@
 
 #include "Utility/IpplTimings.h"
 
-#include "../../alpine/ParticleContainer.hpp"
 #include "Communicate/Window.h"
 
 namespace ippl {
@@ -38,6 +37,25 @@ namespace ippl {
         FieldLayout<Dim>& fl, Mesh& mesh) {
         Base::updateLayout(fl, mesh);
         initializeCells();
+        ghostPlanValid_m = false;
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::setClusterSize(
+        unsigned clusterSize) {
+        if (clusterSize != 0 && clusterSize != 4 && clusterSize != 8) {
+            throw IpplException("ParticleSpatialOverlapLayout::setClusterSize",
+                                "The cluster size must be 0, 4 or 8.");
+        }
+        clusterSize_m = clusterSize;
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::setVerletSkin(T skin) {
+        PAssert(skin >= 0);
+        skin_m = skin;
+        initializeCells();
+        ghostPlanValid_m = false;
     }
 
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
@@ -45,20 +63,20 @@ namespace ippl {
         const auto rank          = Comm->rank();
         const auto hLocalRegions = this->rlayout_m->gethLocalRegions();
         for (unsigned d = 0; d < Dim; ++d) {
-            PAssert(rcutoff_m <= hLocalRegions(rank)[d].length() / 2 &&
+            PAssert(overlap() <= hLocalRegions(rank)[d].length() / 2 &&
                 "Cutoff is too big with respect to region. "
                 "Particle could be on 3 or more ranks ins one dimension");
         }
 
         /* precompute information of cell structure. dividing the region into cells of at least
-         * rcutoff_m length, the length of the overlap. Use std::floor to make sure the boundary
+         * overlap() length, the length of the overlap. Use std::floor to make sure the boundary
          * cells are big enough as well.
          */
         totalCells_m    = 1;
         numLocalCells_m = 1;
         for (unsigned d = 0; d < Dim; ++d) {
             const T length              = hLocalRegions(rank)[d].length();
-            const size_type nLocalCells = std::floor(length / rcutoff_m);
+            const size_type nLocalCells = std::floor(length / overlap());
             // two ghost cells, one in each direction
             numCells_m[d]  = nLocalCells + 2 * numGhostCellsPerDim_m;
             cellWidth_m[d] = length / nLocalCells;
@@ -168,6 +186,42 @@ namespace ippl {
              */
             pc.setLocalNum(numLoc + numBoundaryParticles);
         }
+
+        template <typename ParticleContainer, typename index_type>
+        inline void copyParticles(ParticleContainer& pc, const index_type& dst,
+                                  const index_type& src) {
+            detail::runForAllSpaces([&]<typename MemorySpace>() {
+                size_t num_attributes_in_space = 0;
+                pc.template forAllAttributes<MemorySpace>([&]<typename Attribute>(Attribute&) {
+                    ++num_attributes_in_space;
+                });
+                if (num_attributes_in_space == 0) {
+                    return;
+                }
+
+                // destroy() copies src(i) to dst(i) for all i
+                pc.template forAllAttributes<MemorySpace>(
+                    [dstMirror = Kokkos::create_mirror_view_and_copy(MemorySpace(), dst),
+                     srcMirror = Kokkos::create_mirror_view_and_copy(
+                         MemorySpace(), src)]<typename Attribute>(Attribute& att) {
+                        att->destroy(dstMirror, srcMirror, dstMirror.extent(0));
+                    });
+            });
+            Kokkos::fence();
+        }
+
+        //! squared distance between two axis-aligned boxes, 0 if they overlap
+        template <typename T, unsigned Dim>
+        KOKKOS_INLINE_FUNCTION T boxDistance2(const Vector<T, Dim>& loA, const Vector<T, Dim>& hiA,
+                                              const Vector<T, Dim>& loB,
+                                              const Vector<T, Dim>& hiB) {
+            T dist2 = 0;
+            for (unsigned d = 0; d < Dim; ++d) {
+                const T gap = Kokkos::max(T(0), Kokkos::max(loB[d] - hiA[d], loA[d] - hiB[d]));
+                dist2 += gap * gap;
+            }
+            return dist2;
+        }
     }  // namespace detail
 
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
@@ -192,9 +246,11 @@ namespace ippl {
             return;
 
         const auto& globalRegion = this->rlayout_m->getDomain();
-        const auto overlap       = rcutoff_m;
+        const auto overlap       = this->overlap();
         const auto numLoc        = pc.getLocalNum();
         const auto positions     = pc.R.getView();
+        const auto valid         = pc.template getValidMask<position_memory_space>();
+        const bool masked        = valid.extent(0) > 0;
 
         constexpr auto is = std::make_index_sequence<Dim>();
         /* Step 1. Determine all particles which are close to the global domain boundary */
@@ -202,7 +258,8 @@ namespace ippl {
         Kokkos::parallel_reduce(
             "count boundary particles", numLoc,
             KOKKOS_LAMBDA(const size_t& i, size_type& sum) {
-                if (isCloseToBoundary(is, positions(i), globalRegion, periodic, overlap)) {
+                if ((!masked || valid(i))
+                    && isCloseToBoundary(is, positions(i), globalRegion, periodic, overlap)) {
                     ++sum;
                 }
             },
@@ -216,7 +273,8 @@ namespace ippl {
         Kokkos::parallel_scan(
             "count boundary particles", numLoc,
             KOKKOS_LAMBDA(const size_t& i, size_type& sum, bool final) {
-                if (isCloseToBoundary(is, positions(i), globalRegion, periodic, overlap)) {
+                if ((!masked || valid(i))
+                    && isCloseToBoundary(is, positions(i), globalRegion, periodic, overlap)) {
                     if (final) {
                         boundaryIndices(sum) = i;
                     }
@@ -411,10 +469,359 @@ namespace ippl {
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
     template <class ParticleContainer>
     void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::update(ParticleContainer& pc) {
+        if (skin_m > 0) {
+            if (!needsRebuild(pc)) {
+                refreshGhosts(pc);
+                ++cellReuses_m;
+                return;
+            }
+            rebuildWithSkin(pc);
+            ++cellRebuilds_m;
+            return;
+        }
+
         particleExchange(pc);
         buildCells(pc);
     }
 
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    bool ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::needsRebuild(
+        const ParticleContainer& pc) const {
+        /* Particles created or destroyed since the last rebuild invalidate the plan as well, and
+         * so does a particle that has left the region of its rank: it is neither migrated nor
+         * wrapped by the boundary conditions before the next rebuild, so scattering it to a field
+         * could write outside the owned and ghost cells. The decision has to be the same on all
+         * ranks, hence it is reduced like the displacement.
+         */
+        const size_type numLoc = pc.getLocalNum();
+        const bool changed     = !ghostPlanValid_m || pc.getHoleCount() != numHoles_m
+                             || numLoc != numLocalParticles_m
+                             || referencePositions_m.extent(0) != numLoc;
+
+        const T halfSkin = skin_m / 2;
+        const T rebuild  = 4 * halfSkin * halfSkin;
+
+        T maxDisp2 = 0;
+        if (!changed) {
+            const auto positions = pc.R.getView();
+            const auto reference = referencePositions_m;
+            const auto valid     = pc.template getValidMask<position_memory_space>();
+            const bool masked    = valid.extent(0) > 0;
+            const auto myRegion  = this->rlayout_m->gethLocalRegions()(Comm->rank());
+            const auto is        = std::make_index_sequence<Dim>{};
+            using policy_type    = Kokkos::RangePolicy<position_execution_space>;
+            Kokkos::parallel_reduce(
+                "ParticleSpatialOverlapLayout::needsRebuild()", policy_type(0, numLoc),
+                KOKKOS_LAMBDA(const size_t i, T& maxVal) {
+                    if (masked && !valid(i)) {
+                        return;
+                    }
+                    if (!Base::positionInRegionInclusive(is, positions(i), myRegion)) {
+                        maxVal = Kokkos::max(maxVal, rebuild);
+                        return;
+                    }
+                    const vector_type dist = positions(i) - reference(i);
+                    const T dist2          = dist.dot(dist);
+                    if (dist2 > maxVal) {
+                        maxVal = dist2;
+                    }
+                },
+                Kokkos::Max<T>(maxDisp2));
+        }
+
+        T localVal  = changed ? rebuild : maxDisp2;
+        T globalVal      = 0;
+        Comm->allreduce(localVal, globalVal, 1, std::greater<T>());
+        return globalVal > halfSkin * halfSkin;
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::rebuildWithSkin(
+        ParticleContainer& pc) {
+        static IpplTimings::TimerRef rebuildTimer = IpplTimings::getTimer("cellRebuild");
+        IpplTimings::startTimer(rebuildTimer);
+
+        /* Step 1. move the owned particles to the rank of their region. Ghosts of the previous
+         * rebuild are beyond pc.getLocalNum() and thus dropped.
+         */
+        Base::update(pc);
+
+        /* Step 2. create the ghosts and sort all particles into the cells */
+        const size_type numOwned = pc.getLocalNum();
+        buildGhostPlan(pc);
+        exchangeGhosts(pc, numOwned);
+        const size_type numTotal = pc.getLocalNum();
+        buildCells(pc);
+
+        /* Step 3. express the plan in the sorted order. Owned particles end up in local cells,
+         * so the ghosts keep the index range [numOwned, numTotal).
+         */
+        ghostPlanValid_m = numLocalParticles_m == numOwned;
+        if (ghostPlanValid_m) {
+            using policy_type         = Kokkos::RangePolicy<position_execution_space>;
+            const auto newIndex       = cellSortIndex_m;
+            const size_type numGhosts = numTotal - numOwned;
+
+            auto source = ghostSource_m;
+            Kokkos::parallel_for(
+                "remap ghost sources", policy_type(0, source.extent(0)),
+                KOKKOS_LAMBDA(const size_t k) { source(k) = newIndex(source(k)); });
+
+            ghostSlot_m    = hash_type("ghostSlot", numGhosts);
+            ghostScratch_m = hash_type("ghostScratch", numGhosts);
+            auto slot      = ghostSlot_m;
+            auto scratch   = ghostScratch_m;
+            Kokkos::parallel_for(
+                "remap ghost slots", policy_type(0, numGhosts), KOKKOS_LAMBDA(const size_t k) {
+                    slot(k)    = newIndex(numOwned + k);
+                    scratch(k) = numTotal + k;
+                });
+
+            Kokkos::realloc(referencePositions_m, numOwned);
+            // the position view may be overallocated and holds the ghosts after numOwned
+            const auto ownedRange = Kokkos::make_pair<size_type, size_type>(0, numOwned);
+            Kokkos::deep_copy(referencePositions_m, Kokkos::subview(pc.R.getView(), ownedRange));
+            Kokkos::fence();
+            numHoles_m = pc.getHoleCount();
+        }
+
+        IpplTimings::stopTimer(rebuildTimer);
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    KOKKOS_INLINE_FUNCTION bool
+    ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::imageShift(
+        size_type n, const Kokkos::Array<bool, Dim>& periodic, const vector_type& length,
+        vector_type& shift) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            const int offset = static_cast<int>(n % 3) - 1;
+            n /= 3;
+            if (offset != 0 && !periodic[d]) {
+                return false;
+            }
+            shift[d] = offset * length[d];
+        }
+        return true;
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::buildGhostPlan(
+        ParticleContainer& pc) {
+        const int nRanks       = Comm->size();
+        const int myRank       = Comm->rank();
+        const size_type numLoc = pc.getLocalNum();
+        const auto positions   = pc.R.getView();
+        const auto valid       = pc.template getValidMask<position_memory_space>();
+        const bool masked      = valid.extent(0) > 0;
+        const auto regions     = this->rlayout_m->getdLocalRegions();
+        const auto myRegion    = this->rlayout_m->gethLocalRegions()(myRank);
+        const auto& domain     = this->rlayout_m->getDomain();
+        const T overlap        = this->overlap();
+        constexpr auto is      = std::make_index_sequence<Dim>();
+        using policy_type      = Kokkos::RangePolicy<position_execution_space>;
+
+        Kokkos::Array<bool, Dim> periodic, anyFace;
+        vector_type length;
+        for (unsigned d = 0; d < Dim; ++d) {
+            periodic[d] = this->getParticleBC()[2 * d] == BC::PERIODIC;
+            anyFace[d]  = true;
+            length[d]   = domain[d].length();
+        }
+
+        /* the identity image has all base 3 digits equal to 1 */
+        constexpr size_type numImages = detail::countHypercubes(Dim);
+        constexpr size_type identity  = numImages / 2;
+
+        /* Step 1. count the copies per destination rank; entry nRanks counts the periodic images
+         * staying on this rank. Only particles within the overlap of the region boundary can be
+         * ghosts anywhere. Tombstones are no ghosts.
+         */
+        locate_type ghostCount("ghostCount", nRanks + 1);
+        Kokkos::parallel_for(
+            "count ghosts", policy_type(0, numLoc), KOKKOS_LAMBDA(const size_t i) {
+                const vector_type pos = positions(i);
+                if ((masked && !valid(i))
+                    || !isCloseToBoundary(is, pos, myRegion, anyFace, overlap)) {
+                    return;
+                }
+                vector_type shift;
+                for (int r = 0; r < nRanks; ++r) {
+                    for (size_type n = 0; n < numImages; ++n) {
+                        if ((r == myRank && n == identity)
+                            || !imageShift(n, periodic, length, shift)) {
+                            continue;
+                        }
+                        if (positionInRegion(is, vector_type(pos + shift), regions(r), overlap)) {
+                            Kokkos::atomic_inc(&ghostCount(r == myRank ? nRanks : r));
+                        }
+                    }
+                }
+            });
+
+        /* Step 2. group the copies: self copies first, then by destination rank */
+        auto ghostCount_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ghostCount);
+        locate_type ghostOffset("ghostOffset", nRanks + 1);
+        auto ghostOffset_h = Kokkos::create_mirror_view(ghostOffset);
+
+        numSelfGhosts_m = ghostCount_h(nRanks);
+        ghostSends_m.clear();
+        ghostOffset_h(nRanks) = 0;
+        size_type numStaged   = numSelfGhosts_m;
+        for (int r = 0; r < nRanks; ++r) {
+            ghostOffset_h(r) = numStaged;
+            if (r != myRank && ghostCount_h(r) > 0) {
+                ghostSends_m.push_back({r, static_cast<size_type>(ghostCount_h(r))});
+                numStaged += ghostCount_h(r);
+            }
+        }
+        Kokkos::deep_copy(ghostOffset, ghostOffset_h);
+
+        ghostSource_m = hash_type("ghostSource", numStaged);
+        ghostShift_m  = position_view_type("ghostShift", numStaged);
+        auto source   = ghostSource_m;
+        auto shifts   = ghostShift_m;
+        locate_type cursor("ghostCursor", nRanks + 1);
+        Kokkos::parallel_for(
+            "fill ghosts", policy_type(0, numLoc), KOKKOS_LAMBDA(const size_t i) {
+                const vector_type pos = positions(i);
+                if ((masked && !valid(i))
+                    || !isCloseToBoundary(is, pos, myRegion, anyFace, overlap)) {
+                    return;
+                }
+                vector_type shift;
+                for (int r = 0; r < nRanks; ++r) {
+                    for (size_type n = 0; n < numImages; ++n) {
+                        if ((r == myRank && n == identity)
+                            || !imageShift(n, periodic, length, shift)) {
+                            continue;
+                        }
+                        if (positionInRegion(is, vector_type(pos + shift), regions(r), overlap)) {
+                            const int g      = r == myRank ? nRanks : r;
+                            const size_t idx =
+                                ghostOffset(g) + Kokkos::atomic_fetch_inc(&cursor(g));
+                            source(idx)      = i;
+                            shifts(idx)      = shift;
+                        }
+                    }
+                }
+            });
+        Kokkos::fence();
+
+        /* Step 3. exchange the counts, see particleExchange */
+        ghostRecvs_m.clear();
+        if (nRanks < 2) {
+            return;
+        }
+        std::fill(this->nRecvs_m.begin(), this->nRecvs_m.end(), 0);
+        this->window_m.fence(0);
+        for (const auto& [rank, count] : ghostSends_m) {
+            const int* src_ptr = &ghostCount_h(rank);
+            this->window_m.template put<int>(src_ptr, rank, myRank);
+        }
+        this->window_m.fence(0);
+        for (int rank = 0; rank < nRanks; ++rank) {
+            if (this->nRecvs_m[rank] > 0) {
+                ghostRecvs_m.push_back({rank, this->nRecvs_m[rank]});
+            }
+        }
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::exchangeGhosts(
+        ParticleContainer& pc, size_type base) {
+        static IpplTimings::TimerRef ghostTimer = IpplTimings::getTimer("ghostExchange");
+        IpplTimings::startTimer(ghostTimer);
+
+        using policy_type         = Kokkos::RangePolicy<position_execution_space>;
+        const size_type numStaged = ghostSource_m.extent(0);
+        const size_type numSelf   = numSelfGhosts_m;
+
+        size_type numRecvs = 0;
+        for (const auto& [rank, count] : ghostRecvs_m) {
+            numRecvs += count;
+        }
+
+        /* The ghosts are sent and received as contiguous blocks straight from and into the
+         * attribute storage:
+         *
+         *    [base, recvBase)                 self copies
+         *    [recvBase, stageBase)            ghosts received from the other ranks
+         *    [stageBase, stageBase + remote)  copies for the other ranks, dropped at the end
+         *
+         * The capacity for all of them is reserved up front so that no attribute is
+         * reallocated while a transfer is pending.
+         */
+        const size_type recvBase  = base + numSelf;
+        const size_type stageBase = recvBase + numRecvs;
+        pc.forAllAttributes([&]<typename Attribute>(Attribute& att) {
+            att->reserve(stageBase + numStaged - numSelf);
+        });
+
+        int tag = Comm->next_tag(mpi::tag::P_SPATIAL_LAYOUT, mpi::tag::P_LAYOUT_CYCLE);
+
+        /* Step 1. post the receives */
+        std::vector<MPI_Request> requests;
+        size_type offset = recvBase;
+        for (const auto& [rank, count] : ghostRecvs_m) {
+            pc.postRecvBlockFromRank(rank, tag, offset, count, requests);
+            offset += count;
+        }
+
+        /* Step 2. stage the copies and move them to their periodic image. The self copies are
+         * final, the remote ones are sent.
+         */
+        pc.setLocalNum(base);
+        if (numStaged > 0) {
+            const hash_type selfSource(ghostSource_m, std::make_pair(size_type(0), numSelf));
+            const hash_type remoteSource(ghostSource_m, std::make_pair(numSelf, numStaged));
+            detail::copyAttributes(pc, selfSource);
+            pc.setLocalNum(stageBase);
+            detail::copyAttributes(pc, remoteSource);
+
+            auto positions = pc.R.getView();
+            auto shifts    = ghostShift_m;
+            Kokkos::parallel_for(
+                "shift ghosts", policy_type(0, numStaged), KOKKOS_LAMBDA(const size_t k) {
+                    const size_t idx = k < numSelf ? base + k : stageBase + (k - numSelf);
+                    for (unsigned d = 0; d < Dim; ++d) {
+                        positions(idx)[d] += shifts(k)[d];
+                    }
+                });
+            Kokkos::fence();
+        }
+
+        offset = stageBase;
+        for (const auto& [rank, count] : ghostSends_m) {
+            pc.sendBlockToRank(rank, tag, offset, count, requests);
+            offset += count;
+        }
+
+        /* Step 3. wait for the transfers and drop the remote copies */
+        if (requests.size() > 0) {
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        }
+        pc.setLocalNum(stageBase);
+
+        IpplTimings::stopTimer(ghostTimer);
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::refreshGhosts(
+        ParticleContainer& pc) {
+        /* The fresh ghosts are created behind the current ones and then copied into the slots of
+         * the cell structure.
+         */
+        const size_type numLoc = numLocalParticles_m;
+        exchangeGhosts(pc, numLoc + ghostSlot_m.extent(0));
+        detail::copyParticles(pc, ghostSlot_m, ghostScratch_m);
+        pc.setLocalNum(numLoc);
+    }
+
     template <typename T, unsigned Dim, class Mesh, typename... Properties>
     detail::size_type ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::numberOfSends(
         int rank, const locate_type& ranks) {
@@ -575,10 +982,12 @@ namespace ippl {
         const ParticleContainer& pc, locate_type& ranks, locate_type& rankOffsets,
         bool_type& invalid, locate_type& nSends_dview, locate_type& sends_dview) const {
         const auto positions = pc.R.getView();
+        const auto valid     = pc.template getValidMask<position_memory_space>();
+        const bool masked    = valid.extent(0) > 0;
         const auto regions   = this->rlayout_m->getdLocalRegions();
         const auto myRank    = Comm->rank();
         const auto localNum  = pc.getLocalNum();
-        const T overlap      = rcutoff_m;
+        const T overlap      = this->overlap();
         constexpr auto is    = std::make_index_sequence<Dim>();
         using policy_type    = Kokkos::RangePolicy<position_execution_space>;
 
@@ -612,10 +1021,17 @@ namespace ippl {
         static IpplTimings::TimerRef neighborSearch = IpplTimings::getTimer("neighborSearch");
         IpplTimings::startTimer(neighborSearch);
 
-        /* First Pass: count the numbers of neighbor ranks (including self) a particle belongs to */
+        /* First Pass: count the numbers of neighbor ranks (including self) a particle belongs to.
+         * Tombstones stay in place and are not sent.
+         */
         Kokkos::parallel_for(
             "ParticleSpatialLayout::locateParticles()", policy_type(0, localNum),
             KOKKOS_LAMBDA(const size_t& i) {
+                if (masked && !valid(i)) {
+                    invalid(i) = false;
+                    counts(i)  = 0;
+                    return;
+                }
                 const bool inCurr = positionInRegion(is, positions(i), regions(myRank), overlap);
 
                 size_type count = inCurr;
@@ -713,6 +1129,9 @@ namespace ippl {
         Kokkos::parallel_for(
             "ParticleSpatialLayout::locateParticles()", policy_type(0, localNum),
             KOKKOS_LAMBDA(const size_t& i) {
+                if (masked && !valid(i)) {
+                    return;
+                }
                 const size_t offset   = rankOffsets(i);
                 size_type local_count = 0;
                 if (positionInRegion(is, positions(i), regions(myRank), overlap)) {
@@ -885,27 +1304,37 @@ namespace ippl {
         using range_policy = Kokkos::RangePolicy<position_execution_space>;
 
         /* Step 1. calculate cell index for each particle and keep track of how many particles are
-         * in each cell
+         * in each cell. Tombstones are not counted towards any cell.
          */
+        const auto valid   = pc.template getValidMask<position_memory_space>();
+        const bool masked  = valid.extent(0) > 0;
+        size_type numHoles = 0;
         Kokkos::deep_copy(cellParticleCount, 0);
-        Kokkos::parallel_for(
-            "CalcCellIndices", range_policy(0, numLoc), KOKKOS_LAMBDA(const size_t& i) {
+        Kokkos::parallel_reduce(
+            "CalcCellIndices", range_policy(0, numLoc),
+            KOKKOS_LAMBDA(const size_t& i, size_type& holes) {
                 const auto locCellIndex = getCellIndex(positions(i), localRegion, cellWidth);
                 const auto locCellIndexFlat =
                     toFlatCellIndex(locCellIndex, cellStrides, cellPermutationForward);
-                Kokkos::atomic_inc(&cellParticleCount(locCellIndexFlat));
                 cellIndex(i) = locCellIndexFlat;
-            });
-        Kokkos::fence();
+                if (masked && !valid(i)) {
+                    ++holes;
+                    return;
+                }
+                Kokkos::atomic_inc(&cellParticleCount(locCellIndexFlat));
+            },
+            Kokkos::Sum<size_type>(numHoles));
 
-        /* Step 2. compute starting indices for each cell from the counts */
+        /* Step 2. compute starting indices for each cell from the counts. The tombstones follow
+         * the last local cell.
+         */
         Kokkos::parallel_scan(
             "CalcStartingIndices", range_policy(0, totalCells),
             KOKKOS_LAMBDA(const size_t i, int_type& localSum, bool isFinal) {
                 if (isFinal) {
                     cellStartingIdx(i) = localSum;
                 }
-                localSum += cellParticleCount(i);
+                localSum += cellParticleCount(i) + (i + 1 == numLocalCells ? numHoles : 0);
             });
         /* set last position of cell staring index to numLoc*/
         Kokkos::deep_copy(
@@ -922,12 +1351,19 @@ namespace ippl {
         /* Step 3. compute new indices for the particles such that they are sorted according to
          * cellStaringIdx and sort cell indices of the particles in tandem
          */
+        hash_type holeCursor("holeCursor", 1);
         Kokkos::parallel_for(
             "Calculate new Indices", range_policy(0, numLoc), KOKKOS_LAMBDA(const size_type& i) {
                 const auto locCellIndex = cellIndex(i);
-                const size_type newIdx  = Kokkos::atomic_fetch_inc(&cellCurrentIdx(locCellIndex));
-                newIndex(i)             = newIdx;
-                newCellIndex(newIdx)    = locCellIndex;
+                size_type newIdx;
+                if (masked && !valid(i)) {
+                    newIdx = cellStartingIdx(numLocalCells) - numHoles
+                             + Kokkos::atomic_fetch_inc(&holeCursor(0));
+                } else {
+                    newIdx = Kokkos::atomic_fetch_inc(&cellCurrentIdx(locCellIndex));
+                }
+                newIndex(i)          = newIdx;
+                newCellIndex(newIdx) = locCellIndex;
             });
         Kokkos::fence();
 
@@ -936,9 +1372,14 @@ namespace ippl {
          * captures do not work with nvcc and template default argument ot the layout somehow.
          */
         detail::sortParticles(pc, newIndex);
+        pc.permuteValidMask(newIndex);
+
+        if (clusterSize_m > 0) {
+            buildClusters(pc, numLoc);
+        }
 
-        /* Step 5. set local number of particles (excluding ghost particles) is the value of
-         * cellStartingIdx at index numLocalCells*/
+        /* Step 5. set local number of particles (excluding ghost particles, including the
+         * tombstones) is the value of cellStartingIdx at index numLocalCells*/
         auto numLocalParticles =
             Kokkos::create_mirror_view(Kokkos::subview(cellStartingIdx, numLocalCells));
         Kokkos::deep_copy(numLocalParticles, Kokkos::subview(cellStartingIdx, numLocalCells));
@@ -947,7 +1388,8 @@ namespace ippl {
         pc.setLocalNum(numLocalParticles_m);
 
         /* store the new cell indices */
-        cellIndex_m = newCellIndex;
+        cellIndex_m     = newCellIndex;
+        cellSortIndex_m = newIndex;
 
         IpplTimings::stopTimer(cellBuildTimer);
     }
@@ -1158,4 +1600,303 @@ namespace ippl {
         IpplTimings::stopTimer(interactionTimer);
     }
 
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <typename ExecutionSpace, typename Attribute, typename Functor>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::forEachUniquePair(
+        Attribute& attrib, Functor&& f) const {
+        static IpplTimings::TimerRef interactionTimer = IpplTimings::getTimer("PPInteractionTimer");
+        IpplTimings::startTimer(interactionTimer);
+
+        using value_type = typename Attribute::value_type;
+
+        /* get local variables necessary for Kokkos parallel regions */
+        const auto cellStartingIdx         = cellStartingIdx_m;
+        const auto cellParticleCount       = cellParticleCount_m;
+        const auto cellPermutationForward  = cellPermutationForward_m;
+        const auto cellPermutationBackward = cellPermutationBackward_m;
+        const auto& cellStrides            = cellStrides_m;
+        const auto& numCells               = numCells_m;
+        const size_type numLocalCells      = numLocalCells_m;
+        auto view                          = attrib.getView();
+
+        /* the neighbors are ordered by their base 3 offset, hence neighbor numCellNeighbors - 1 - n
+         * is the mirror image of neighbor n and the cell itself is in the middle
+         */
+        constexpr auto numCellNeighbors = detail::countHypercubes(Dim);
+        constexpr size_type self        = numCellNeighbors / 2;
+
+        /* One team per local cell and one thread per particle i of the cell. The contributions
+         * to i are summed in a register and added once; only the ones to j need an atomic.
+         */
+        using team_policy_t = Kokkos::TeamPolicy<ExecutionSpace>;
+        using team_t        = typename team_policy_t::member_type;
+        Kokkos::parallel_for(
+            "ParticleSpatialOverlapLayout::forEachUniquePair()",
+            team_policy_t(numLocalCells, Kokkos::AUTO()), KOKKOS_LAMBDA(const team_t& team) {
+                const size_type cellIdxFlat = team.league_rank();
+                if (cellParticleCount(cellIdxFlat) == 0) {
+                    return;
+                }
+
+                const auto cellParticleOffset = cellStartingIdx(cellIdxFlat);
+                const auto numCellParticles   = cellParticleCount(cellIdxFlat);
+
+                /* get nd-cell-index and its neighbors */
+                const auto cellIdx = toCellIndex(cellPermutationBackward(cellIdxFlat), numCells);
+                const auto cellNeighbors =
+                    getCellNeighbors(cellIdx, cellStrides, cellPermutationForward);
+
+                Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange(team, numCellParticles), [&](const size_t& k) {
+                        const size_t i = cellParticleOffset + k;
+                        value_type ai(0);
+
+                        /* pairs within the cell */
+                        for (size_t j = i + 1; j < cellParticleOffset + numCellParticles; ++j) {
+                            value_type aj(0);
+                            if (f(i, j, ai, aj)) {
+                                Kokkos::atomic_add(&view(j), aj);
+                            }
+                        }
+
+                        /* forward local neighbor cells and all ghost neighbor cells. The
+                         * contribution to a ghost j is dropped, its owner adds it as its own i.
+                         */
+                        for (size_type n = 0; n < numCellNeighbors; ++n) {
+                            const auto neighborCellIdx = cellNeighbors[n];
+                            const bool isLocal         = neighborCellIdx < numLocalCells;
+                            if (n == self || (isLocal && n < self)) {
+                                continue;
+                            }
+
+                            const size_t begin = cellStartingIdx(neighborCellIdx);
+                            const size_t end   = begin + cellParticleCount(neighborCellIdx);
+                            for (size_t j = begin; j < end; ++j) {
+                                value_type aj(0);
+                                if (f(i, j, ai, aj) && isLocal) {
+                                    Kokkos::atomic_add(&view(j), aj);
+                                }
+                            }
+                        }
+
+                        Kokkos::atomic_add(&view(i), ai);
+                    });
+            });
+        Kokkos::fence();
+
+        IpplTimings::stopTimer(interactionTimer);
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <class ParticleContainer>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::buildClusters(
+        const ParticleContainer& pc, size_type numParticles) {
+        static IpplTimings::TimerRef clusterBuildTimer = IpplTimings::getTimer("clusterBuildTimer");
+        IpplTimings::startTimer(clusterBuildTimer);
+
+        const size_type clusterSize        = clusterSize_m;
+        const auto positions               = pc.R.getView();
+        const auto cellStartingIdx         = cellStartingIdx_m;
+        const auto cellParticleCount       = cellParticleCount_m;
+        const auto cellPermutationForward  = cellPermutationForward_m;
+        const auto cellPermutationBackward = cellPermutationBackward_m;
+        const auto cellStrides             = cellStrides_m;
+        const auto numCells                = numCells_m;
+        const auto totalCells              = totalCells_m;
+        const auto numLocalCells           = numLocalCells_m;
+        const T overlap2                   = overlap() * overlap();
+        PAssert(numParticles <= positions.extent(0));
+
+        using range_policy = Kokkos::RangePolicy<position_execution_space>;
+
+        /* Step 1. clusters never span two cells, cell c owns clusters clusterOffset(c), ... */
+        hash_type clusterOffset("clusterOffset", totalCells + 1);
+        size_type numClusters = 0;
+        Kokkos::parallel_scan(
+            "CalcClusterOffsets", range_policy(0, totalCells),
+            KOKKOS_LAMBDA(const size_t c, size_type& sum, const bool final) {
+                if (final) {
+                    clusterOffset(c) = sum;
+                }
+                sum += (cellParticleCount(c) + clusterSize - 1) / clusterSize;
+            },
+            numClusters);
+        Kokkos::deep_copy(Kokkos::subview(clusterOffset, totalCells), numClusters);
+
+        auto numLocalClusters =
+            Kokkos::create_mirror_view(Kokkos::subview(clusterOffset, numLocalCells));
+        Kokkos::deep_copy(numLocalClusters, Kokkos::subview(clusterOffset, numLocalCells));
+        numLocalClusters_m = numLocalClusters();
+
+        /* Step 2. first particle, size and bounding box of every cluster */
+        clusterFirst_m = hash_type("clusterFirst", numClusters);
+        clusterCount_m = hash_type("clusterCount", numClusters);
+        clusterLo_m    = position_view_type("clusterLo", numClusters);
+        clusterHi_m    = position_view_type("clusterHi", numClusters);
+        auto first     = clusterFirst_m;
+        auto count     = clusterCount_m;
+        auto lo        = clusterLo_m;
+        auto hi        = clusterHi_m;
+        Kokkos::parallel_for(
+            "CalcClusters", range_policy(0, totalCells), KOKKOS_LAMBDA(const size_t c) {
+                const size_type cellFirst = cellStartingIdx(c);
+                const size_type cellCount = cellParticleCount(c);
+                size_type k               = clusterOffset(c);
+                for (size_type begin = 0; begin < cellCount; begin += clusterSize, ++k) {
+                    const size_type n =
+                        cellCount - begin < clusterSize ? cellCount - begin : clusterSize;
+                    vector_type boxLo = positions(cellFirst + begin);
+                    vector_type boxHi = boxLo;
+                    for (size_type t = 1; t < n; ++t) {
+                        const vector_type pos = positions(cellFirst + begin + t);
+                        for (unsigned d = 0; d < Dim; ++d) {
+                            boxLo[d] = Kokkos::min(boxLo[d], pos[d]);
+                            boxHi[d] = Kokkos::max(boxHi[d], pos[d]);
+                        }
+                    }
+                    first(k) = cellFirst + begin;
+                    count(k) = n;
+                    lo(k)    = boxLo;
+                    hi(k)    = boxHi;
+                }
+            });
+
+        /* Step 3. list the clusters of the neighbor cells within the overlap of every local
+         * cluster; count first, then fill
+         */
+        constexpr auto numCellNeighbors = detail::countHypercubes(Dim);
+
+        hash_type pairCount("clusterPairCount", numLocalClusters_m);
+        Kokkos::parallel_for(
+            "CountClusterPairs", range_policy(0, numLocalCells), KOKKOS_LAMBDA(const size_t c) {
+                const auto cellIdx   = toCellIndex(cellPermutationBackward(c), numCells);
+                const auto neighbors =
+                    getCellNeighbors(cellIdx, cellStrides, cellPermutationForward);
+                for (size_type k = clusterOffset(c); k < size_type(clusterOffset(c + 1)); ++k) {
+                    size_type pairs = 0;
+                    for (size_type n = 0; n < numCellNeighbors; ++n) {
+                        const auto nc = neighbors[n];
+                        for (size_type m = clusterOffset(nc); m < size_type(clusterOffset(nc + 1));
+                             ++m) {
+                            pairs += detail::boxDistance2(lo(k), hi(k), lo(m), hi(m)) < overlap2;
+                        }
+                    }
+                    pairCount(k) = pairs;
+                }
+            });
+
+        clusterPairOffset_m = hash_type("clusterPairOffset", numLocalClusters_m + 1);
+        auto pairOffset     = clusterPairOffset_m;
+        size_type numPairs  = 0;
+        Kokkos::parallel_scan(
+            "CalcClusterPairOffsets", range_policy(0, numLocalClusters_m),
+            KOKKOS_LAMBDA(const size_t k, size_type& sum, const bool final) {
+                if (final) {
+                    pairOffset(k) = sum;
+                }
+                sum += pairCount(k);
+            },
+            numPairs);
+        Kokkos::deep_copy(Kokkos::subview(pairOffset, numLocalClusters_m), numPairs);
+
+        clusterPairs_m = hash_type("clusterPairs", numPairs);
+        auto pairs     = clusterPairs_m;
+        Kokkos::parallel_for(
+            "FillClusterPairs", range_policy(0, numLocalCells), KOKKOS_LAMBDA(const size_t c) {
+                const auto cellIdx   = toCellIndex(cellPermutationBackward(c), numCells);
+                const auto neighbors =
+                    getCellNeighbors(cellIdx, cellStrides, cellPermutationForward);
+                for (size_type k = clusterOffset(c); k < size_type(clusterOffset(c + 1)); ++k) {
+                    size_type p = pairOffset(k);
+                    for (size_type n = 0; n < numCellNeighbors; ++n) {
+                        const auto nc = neighbors[n];
+                        for (size_type m = clusterOffset(nc); m < size_type(clusterOffset(nc + 1));
+                             ++m) {
+                            if (detail::boxDistance2(lo(k), hi(k), lo(m), hi(m)) < overlap2) {
+                                pairs(p++) = m;
+                            }
+                        }
+                    }
+                }
+            });
+        Kokkos::fence();
+
+        IpplTimings::stopTimer(clusterBuildTimer);
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <typename ExecutionSpace, typename Attribute, typename Functor>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::forEachClusterPair(
+        Attribute& attrib, Functor&& f) const {
+        switch (clusterSize_m) {
+            case 4:
+                forEachClusterPairImpl<ExecutionSpace, 4>(attrib, f);
+                break;
+            case 8:
+                forEachClusterPairImpl<ExecutionSpace, 8>(attrib, f);
+                break;
+            default:
+                throw IpplException("ParticleSpatialOverlapLayout::forEachClusterPair",
+                                    "The cluster-pair mode is not enabled.");
+        }
+    }
+
+    template <typename T, unsigned Dim, class Mesh, typename... Properties>
+    template <typename ExecutionSpace, unsigned ClusterSize, typename Attribute, typename Functor>
+    void ParticleSpatialOverlapLayout<T, Dim, Mesh, Properties...>::forEachClusterPairImpl(
+        Attribute& attrib, const Functor& f) const {
+        static IpplTimings::TimerRef interactionTimer = IpplTimings::getTimer("PPInteractionTimer");
+        IpplTimings::startTimer(interactionTimer);
+
+        using value_type = typename Attribute::value_type;
+
+        auto view               = attrib.getView();
+        const auto clusterFirst = clusterFirst_m;
+        const auto clusterCount = clusterCount_m;
+        const auto pairOffset   = clusterPairOffset_m;
+        const auto pairs        = clusterPairs_m;
+
+        /* One thread per local cluster i. The loops over the ClusterSize x ClusterSize pairs of
+         * two clusters have a fixed trip count; invalid slots are redirected to the first
+         * particle of the cluster and their result is masked out, such that the compiler can
+         * vectorize the loop body.
+         */
+        Kokkos::parallel_for(
+            "ParticleSpatialOverlapLayout::forEachClusterPair()",
+            Kokkos::RangePolicy<ExecutionSpace>(0, numLocalClusters_m),
+            KOKKOS_LAMBDA(const size_t k) {
+                const size_t iFirst = clusterFirst(k);
+                const size_t ni     = clusterCount(k);
+
+                value_type acc[ClusterSize];
+                for (unsigned ii = 0; ii < ClusterSize; ++ii) {
+                    acc[ii] = value_type(0);
+                }
+
+                for (size_t p = pairOffset(k); p < size_t(pairOffset(k + 1)); ++p) {
+                    const size_t m      = pairs(p);
+                    const size_t jFirst = clusterFirst(m);
+                    const size_t nj     = clusterCount(m);
+                    for (unsigned ii = 0; ii < ClusterSize; ++ii) {
+                        const bool iValid = ii < ni;
+                        const size_t i    = iFirst + (iValid ? ii : 0);
+                        for (unsigned jj = 0; jj < ClusterSize; ++jj) {
+                            const bool jValid = jj < nj;
+                            const size_t j    = jFirst + (jValid ? jj : 0);
+
+                            const value_type contribution = f(i, j);
+                            acc[ii] += (iValid && jValid && i != j) ? contribution : value_type(0);
+                        }
+                    }
+                }
+
+                for (unsigned ii = 0; ii < ni; ++ii) {
+                    view(iFirst + ii) += acc[ii];
+                }
+            });
+        Kokkos::fence();
+
+        IpplTimings::stopTimer(interactionTimer);
+    }
+
 }  // namespace ippl
@@ -90,6 +90,8 @@ namespace ippl {
                     "mg_omega", pcg_preconditioner_defaults::mg_omega);
                 int mg_min_cells = static_cast<int>(this->params_m.template get<int>(
                     "min_cells_per_rank_per_dim",pcg_preconditioner_defaults::mg_min_cells));
+                int mg_halo_depth = this->params_m.template get<int>(
+                    "mg_halo_depth", pcg_preconditioner_defaults::mg_halo_depth);
                 bool mg_communication = communication;
 
                 Inform warn("PoissonCG");
@@ -98,7 +100,8 @@ namespace ippl {
                 // parameter is used.
                 preconditioner_validation::sanitizeParams(
                     preconditioner_type, warn, level, degree, richardson_iterations, inner, outer,
-                    omega, &communication, mg_pre, mg_post, mg_omega, mg_min_cells);
+                    omega, &communication, mg_pre, mg_post, mg_omega, mg_min_cells,
+                    &mg_halo_depth);
                 // Analytical eigenvalues for the d dimensional laplace operator
                 // Going brute force through all possible eigenvalues seems to be the only way to
                 // find max and min
@@ -132,7 +135,8 @@ namespace ippl {
                         IPPL_SOLVER_OPERATOR_WRAPPER(negative_inverse_diagonal_laplace, lhs_type),
                         IPPL_SOLVER_OPERATOR_WRAPPER(diagonal_laplace, lhs_type), alpha, beta,
                         preconditioner_type, level, degree, richardson_iterations, inner, outer,
-                        omega, mg_pre, mg_post, mg_omega, mg_min_cells, mg_communication);
+                        omega, mg_pre, mg_post, mg_omega, mg_min_cells, mg_communication,
+                        mg_halo_depth);
                 } else {
                     algo_m->setPreconditioner(
                         IPPL_SOLVER_OPERATOR_WRAPPER(-laplace, lhs_type),
@@ -142,7 +146,8 @@ namespace ippl {
                         IPPL_SOLVER_OPERATOR_WRAPPER(negative_inverse_diagonal_laplace, lhs_type),
                         IPPL_SOLVER_OPERATOR_WRAPPER(diagonal_laplace, lhs_type), alpha, beta,
                         preconditioner_type, level, degree, richardson_iterations, inner, outer,
-                        omega, mg_pre, mg_post, mg_omega, mg_min_cells, mg_communication);
+                        omega, mg_pre, mg_post, mg_omega, mg_min_cells, mg_communication,
+                        mg_halo_depth);
                 }
             } else {
                 algo_m = std::move(
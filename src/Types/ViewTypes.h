@@ -47,6 +47,9 @@ namespace ippl {
 
         template <typename MemorySpace>
         using hash_type = typename detail::ViewType<int, 1, MemorySpace>::view_type;
+
+        template <typename MemorySpace>
+        using mask_type = typename detail::ViewType<bool, 1, MemorySpace>::view_type;
     }  // namespace detail
 }  // namespace ippl
 
@@ -314,6 +314,98 @@ namespace ippl {
             std::forward<ReducerArgument>(reducer)...);
     }
 
+    /*!
+     * Run a kernel over the interior of a view, i.e. over all elements that are at least
+     * `width` elements away from the region excluded by `shift` (usually the ghost layers).
+     * A stencil of radius `width` evaluated on these elements does not read any halo data,
+     * so the kernel can run while a split-phase halo exchange (BareField::fillHaloBegin) is
+     * still in flight. Together with parallel_for_boundary, every element of
+     * getRangePolicy(view, shift) is visited exactly once.
+     * @tparam PolicyArgs... additional template parameters for the range policy
+     *
+     * @param name kernel name
+     * @param view the view spanning the iteration space
+     * @param shift number of ghost cells excluded at the extremes
+     * @param width stencil radius
+     * @param functor the kernel, called with an index array
+     */
+    template <class... PolicyArgs, typename View, class FunctorType>
+    void parallel_for_interior(const std::string& name, const View& view, int shift, int width,
+                               const FunctorType& functor) {
+        constexpr unsigned Dim = View::rank;
+        using exec_space       = typename View::execution_space;
+        using index_type       = typename RangePolicy<Dim, exec_space, PolicyArgs...>::index_type;
+
+        Kokkos::Array<index_type, Dim> begin, end;
+        for (unsigned d = 0; d < Dim; d++) {
+            begin[d] = shift + width;
+            end[d]   = static_cast<index_type>(view.extent(d)) - shift - width;
+            if (begin[d] >= end[d]) {
+                // everything is part of the boundary shell
+                return;
+            }
+        }
+        parallel_for(name, createRangePolicy<Dim, exec_space, PolicyArgs...>(begin, end), functor);
+    }
+
+    /*!
+     * Run a kernel over the boundary shell of a view, i.e. the elements of
+     * getRangePolicy(view, shift) that are not visited by parallel_for_interior with
+     * the same arguments. The shell is decomposed into 2 * Dim slabs which are launched
+     * as separate kernels.
+     * @tparam PolicyArgs... additional template parameters for the range policy
+     *
+     * @param name kernel name
+     * @param view the view spanning the iteration space
+     * @param shift number of ghost cells excluded at the extremes
+     * @param width stencil radius
+     * @param functor the kernel, called with an index array
+     */
+    template <class... PolicyArgs, typename View, class FunctorType>
+    void parallel_for_boundary(const std::string& name, const View& view, int shift, int width,
+                               const FunctorType& functor) {
+        constexpr unsigned Dim = View::rank;
+        using exec_space       = typename View::execution_space;
+        using index_type       = typename RangePolicy<Dim, exec_space, PolicyArgs...>::index_type;
+
+        if (width <= 0) {
+            return;
+        }
+
+        Kokkos::Array<index_type, Dim> lo, hi;
+        bool emptyInterior = false;
+        for (unsigned d = 0; d < Dim; d++) {
+            lo[d] = shift;
+            hi[d] = static_cast<index_type>(view.extent(d)) - shift;
+            emptyInterior |= (lo[d] + width >= hi[d] - width);
+        }
+
+        if (emptyInterior) {
+            parallel_for(name, createRangePolicy<Dim, exec_space, PolicyArgs...>(lo, hi), functor);
+            return;
+        }
+
+        // Peel off the slabs axis by axis: along axis d the slabs cover the first and last
+        // `width` elements, the axes before d are restricted to the interior and the axes
+        // after d span the full range.
+        for (unsigned d = 0; d < Dim; d++) {
+            Kokkos::Array<index_type, Dim> begin = lo, end = hi;
+            for (unsigned d2 = 0; d2 < d; d2++) {
+                begin[d2] += width;
+                end[d2] -= width;
+            }
+
+            end[d] = lo[d] + width;
+            parallel_for(name, createRangePolicy<Dim, exec_space, PolicyArgs...>(begin, end),
+                         functor);
+
+            begin[d] = hi[d] - width;
+            end[d]   = hi[d];
+            parallel_for(name, createRangePolicy<Dim, exec_space, PolicyArgs...>(begin, end),
+                         functor);
+        }
+    }
+
     template <std::size_t I, typename T, typename... Rest>
     KOKKOS_FORCEINLINE_FUNCTION auto get_arg(T first, Rest... rest) {
         if constexpr (I == 0) {
@@ -1,10 +1,14 @@
 //   Usage:
-//     srun ./benchmarkParticleUpdate 128 128 128 10000 10 --info 10
+//     srun ./benchmarkParticleUpdate 128 128 128 10000 10 [lossless] --info 10
 //
+//   With the optional argument lossless, the particle exchanges are compressed
+//   (see ippl::mpi::Compression); compare the ParticleUpdate timer with a run
+//   without it.
 //
 #include "Ippl.h"
 
 #include <chrono>
+#include <cstring>
 #include <iostream>
 #include <random>
 #include <set>
@@ -128,9 +132,11 @@ int main(int argc, char* argv[]) {
         auto start                = std::chrono::high_resolution_clock::now();
         const unsigned int totalP = std::atoi(argv[4]);
         const unsigned int nt     = std::atoi(argv[5]);
+        const bool compress       = argc > 6 && std::strcmp(argv[6], "lossless") == 0;
 
         msg << "benchmarkUpdate" << endl
-            << "nt " << nt << " Np= " << totalP << " grid = " << nr << endl;
+            << "nt " << nt << " Np= " << totalP << " grid = " << nr
+            << " compression = " << (compress ? "lossless" : "none") << endl;
 
         using bunch_type = ChargedParticles<PLayout_t>;
 
@@ -166,6 +172,9 @@ int main(int argc, char* argv[]) {
 
         double Q = 1e6;
         P        = std::make_unique<bunch_type>(PL, hr, rmin, rmax, isParallel, Q);
+        if (compress) {
+            P->setCompression(ippl::mpi::Compression::losslessFor(sizeof(double)));
+        }
 
         unsigned long int nloc = totalP / ippl::Comm->size();
 
@@ -0,0 +1,146 @@
+// Consistency test for the deep-halo Jacobi smoother of the multigrid preconditioner.
+//
+// Purpose:
+//   With mg_halo_depth > 1 the coarse level fields carry several ghost layers and the
+//   smoother exchanges their halos once every few sweeps instead of once per sweep. The
+//   result must not depend on this, so the preconditioned CG solve is run with
+//   mg_halo_depth = 1 and mg_halo_depth = 2 and both solutions and iteration counts are
+//   compared.
+//
+// Usage:
+//     ./TestMultigrid_deep_halo --info 5
+//     ./TestMultigrid_deep_halo 5 --info 5
+//
+// Optional first positional argument:
+//     pow, the grid has 2^pow points per dimension (default 5).
+
+#include "Ippl.h"
+
+#include <Kokkos_MathematicalConstants.hpp>
+#include <Kokkos_MathematicalFunctions.hpp>
+#include <array>
+#include <cstdlib>
+#include <iomanip>
+
+#include "Utility/Inform.h"
+
+#include "PoissonSolvers/PoissonCG.h"
+
+int main(int argc, char* argv[]) {
+    ippl::initialize(argc, argv);
+    int status = 0;
+    {
+        constexpr unsigned int dim = 3;
+
+        using Mesh_t      = ippl::UniformCartesian<double, dim>;
+        using Centering_t = Mesh_t::DefaultCentering;
+        using Field_t     = ippl::Field<double, dim, Mesh_t, Centering_t>;
+        using BConds_t    = ippl::BConds<Field_t, dim>;
+
+        int pow = 5;
+        if (argc > 1 && argv[1][0] != '-') {
+            pow = std::atoi(argv[1]);
+        }
+
+        const unsigned pt = 1u << pow;
+
+        ippl::Vector<unsigned, dim> I(pt);
+        ippl::NDIndex<dim> domain(I);
+
+        std::array<bool, dim> isParallel;
+        isParallel.fill(true);
+
+        ippl::FieldLayout<dim> layout(MPI_COMM_WORLD, domain, isParallel);
+
+        const double dx = 1.0 / static_cast<double>(pt + 1);
+
+        ippl::Vector<double, dim> hx     = dx;
+        ippl::Vector<double, dim> origin = 0.0;
+
+        Mesh_t mesh(domain, hx, origin);
+
+        Field_t rhs(mesh, layout);
+        Field_t lhs(mesh, layout);
+        Field_t reference(mesh, layout);
+
+        BConds_t bcField;
+        for (unsigned int i = 0; i < 2 * dim; ++i) {
+            bcField[i] = std::make_shared<ippl::ConstantFace<Field_t>>(i, 0.0);
+        }
+
+        lhs.setFieldBC(bcField);
+        rhs.setFieldBC(bcField);
+        reference.setFieldBC(bcField);
+
+        auto viewRHS = rhs.getView();
+
+        const auto lDom = layout.getLocalNDIndex();
+        const double pi = Kokkos::numbers::pi_v<double>;
+        const int shift = rhs.getNghost();
+
+        Kokkos::parallel_for(
+            "Assign rhs", rhs.getFieldRangePolicy(),
+            KOKKOS_LAMBDA(const int i, const int j, const int k) {
+                const double x = (static_cast<double>(i + lDom[0].first() - shift) + 1.0) * hx[0];
+                const double y = (static_cast<double>(j + lDom[1].first() - shift) + 1.0) * hx[1];
+                const double z = (static_cast<double>(k + lDom[2].first() - shift) + 1.0) * hx[2];
+
+                viewRHS(i, j, k) = 3.0 * pi * pi * Kokkos::sin(pi * x) * Kokkos::sin(pi * y)
+                                   * Kokkos::sin(pi * z);
+            });
+
+        rhs.fillHalo();
+
+        Inform m("");
+        m << "haloDepth,itCount,residue,maxDifference" << endl;
+
+        int referenceIterations = 0;
+        for (int depth = 1; depth <= 2; ++depth) {
+            lhs = 0.0;
+
+            ippl::PoissonCG<Field_t> solver;
+            ippl::ParameterList params;
+
+            params.add("max_iterations", 200);
+            params.add("tolerance", 1e-10);
+            params.add("solver", "preconditioned");
+            params.add("preconditioner_type", "multigrid");
+            params.add("communication", 1);
+            params.add("mg_pre_smooth_iters", 4);
+            params.add("mg_post_smooth_iters", 4);
+            params.add("mg_omega", 0.8);
+            params.add("min_cells_per_rank_per_dim", 2);
+            params.add("mg_halo_depth", depth);
+
+            solver.mergeParameters(params);
+            solver.setRhs(rhs);
+            solver.setLhs(lhs);
+            solver.solve();
+
+            const int itCount = solver.getIterationCount();
+            double difference = 0.0;
+            if (depth == 1) {
+                reference           = lhs;
+                referenceIterations = itCount;
+            } else {
+                Field_t error(mesh, layout);
+                error      = lhs - reference;
+                difference = norm(error, 0) / norm(reference, 0);
+
+                if (itCount != referenceIterations || difference > 1e-12) {
+                    status = 1;
+                }
+            }
+
+            m << depth << "," << itCount << "," << std::setprecision(16) << solver.getResidue()
+              << "," << difference << endl;
+        }
+
+        if (status != 0) {
+            m << "Deep-halo smoothing does not match per-sweep halo exchange" << endl;
+        }
+    }
+    ippl::finalize();
+
+    return status;
+}
@@ -208,6 +208,109 @@ TYPED_TEST(TypedBufferHandlerTest, GetAllocatedAndFreeSize_ResizeBufferLargerTha
     EXPECT_EQ(this->handler->getFreeSize(), 0);
 }
 
+template <typename MemorySpace>
+class TypedPooledBufferHandlerTest : public ::testing::Test {
+protected:
+    using memory_space = MemorySpace;
+    using handler_type = ippl::PooledBufferHandler<memory_space>;
+
+    void SetUp() override { handler = std::make_unique<handler_type>(); }
+
+    void TearDown() override { handler.reset(); }
+
+    std::unique_ptr<handler_type> handler;
+};
+
+TYPED_TEST_SUITE(TypedPooledBufferHandlerTest, MemorySpaces);
+
+// Test: Requests are rounded up to a power of two of at least one page
+TYPED_TEST(TypedPooledBufferHandlerTest, SizeClasses) {
+    using handler_type = typename TestFixture::handler_type;
+
+    EXPECT_EQ(handler_type::sizeClass(0), 12u);
+    EXPECT_EQ(handler_type::sizeClass(4096), 12u);
+    EXPECT_EQ(handler_type::sizeClass(4097), 13u);
+    EXPECT_EQ(handler_type::sizeClass(1 << 20), 20u);
+
+    auto buffer = this->handler->getBuffer(5000, 1.0);
+    EXPECT_GE(buffer->getBufferSize(), 8192u);
+}
+
+// Test: Mixed message sizes stop allocating after the first cycle
+TYPED_TEST(TypedPooledBufferHandlerTest, NoAllocationsAfterWarmUp) {
+    const std::vector<size_t> sizes = {100, 70000, 3000, 1 << 20, 65000, 900000};
+
+    auto cycle = [&](size_t shift) {
+        std::vector<typename TestFixture::handler_type::buffer_type> buffers;
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            // Vary the sizes slightly within their size class between cycles
+            buffers.push_back(this->handler->getBuffer(sizes[i] - shift, 1.0));
+        }
+        this->handler->freeAllBuffers();
+    };
+
+    cycle(0);
+    const auto warm = this->handler->getStatistics();
+    EXPECT_EQ(warm.allocations, sizes.size());
+
+    for (size_t shift = 1; shift < 10; ++shift) {
+        cycle(shift);
+    }
+
+    const auto stats = this->handler->getStatistics();
+    EXPECT_EQ(stats.allocations, warm.allocations);
+    EXPECT_EQ(stats.reuses, 9 * sizes.size());
+    EXPECT_EQ(this->handler->getUsedSize(), 0u);
+}
+
+// Test: A free buffer of the next larger class is reused instead of allocating
+TYPED_TEST(TypedPooledBufferHandlerTest, ReuseNextClass) {
+    auto buffer = this->handler->getBuffer(8192, 1.0);
+    this->handler->freeBuffer(buffer);
+
+    auto smaller = this->handler->getBuffer(4096, 1.0);
+    EXPECT_EQ(smaller, buffer);
+    EXPECT_EQ(this->handler->getStatistics().allocations, 1u);
+}
+
+// Test: Free memory beyond the high-water mark is released
+TYPED_TEST(TypedPooledBufferHandlerTest, TrimToHighWaterMark) {
+    // Two separate phases that never overlap: the pool holds more than was ever in use at once
+    auto large = this->handler->getBuffer(1 << 20, 1.0);
+    this->handler->freeBuffer(large);
+    for (int i = 0; i < 4; ++i) {
+        auto small = this->handler->getBuffer(4096 << i, 1.0);
+        this->handler->freeBuffer(small);
+    }
+    const size_t pooled = this->handler->getFreeSize();
+    EXPECT_EQ(this->handler->getStatistics().releases, 0u);
+
+    // Nothing in use any more, an explicit trim keeps at most the high-water mark
+    this->handler->trim();
+    EXPECT_LE(this->handler->getFreeSize(), this->handler->getStatistics().highWaterMark);
+    EXPECT_LT(this->handler->getFreeSize(), pooled);
+    EXPECT_GT(this->handler->getStatistics().releases, 0u);
+
+    // The mark restarts from zero, the next free trims everything that exceeds twice the use
+    this->handler->setTrimFactor(2.0);
+    auto buffer = this->handler->getBuffer(4096, 1.0);
+    this->handler->freeBuffer(buffer);
+    EXPECT_LE(this->handler->getFreeSize(), 2 * buffer->getBufferSize());
+}
+
+// Test: Deleting all buffers releases them and resets the sizes
+TYPED_TEST(TypedPooledBufferHandlerTest, DeleteAllBuffers) {
+    this->handler->getBuffer(50, 1.0);
+    auto buffer = this->handler->getBuffer(100000, 1.0);
+    this->handler->freeBuffer(buffer);
+
+    this->handler->deleteAllBuffers();
+
+    EXPECT_EQ(this->handler->getUsedSize(), 0u);
+    EXPECT_EQ(this->handler->getFreeSize(), 0u);
+    EXPECT_EQ(this->handler->getStatistics().releases, 2u);
+}
+
 int main(int argc, char* argv[]) {
     int success = 1;
     ippl::initialize(argc, argv);
@@ -0,0 +1,146 @@
+#include "Ippl.h"
+
+#include "Communicate/Compression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "TestUtils.h"
+#include "gtest/gtest.h"
+
+using ippl::mpi::Compression;
+namespace compression = ippl::mpi::compression;
+
+std::vector<char> encode(const std::vector<char>& raw, const Compression& c) {
+    std::vector<char> message(compression::maxMessageSize(raw.size()));
+    message.resize(compression::encode(raw.data(), raw.size(), message.data(), c));
+    return message;
+}
+
+std::vector<char> decode(const std::vector<char>& message, size_t capacity) {
+    std::vector<char> raw(capacity);
+    raw.resize(compression::decode(message.data(), message.size(), raw.data(), raw.size()));
+    return raw;
+}
+
+template <typename T>
+std::vector<char> toBytes(const std::vector<T>& values) {
+    std::vector<char> bytes(values.size() * sizeof(T));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+}
+
+// Test: the byte shuffle is inverted by unshuffle, including trailing bytes
+TEST(CompressionTest, Shuffle) {
+    std::vector<char> raw(8 * 5 + 3);
+    std::iota(raw.begin(), raw.end(), 0);
+
+    std::vector<char> shuffled(raw.size()), restored(raw.size());
+    compression::shuffle(raw.data(), raw.size(), 8, shuffled.data());
+    EXPECT_EQ(shuffled[1], raw[8]);
+    compression::unshuffle(shuffled.data(), raw.size(), 8, restored.data());
+    EXPECT_EQ(restored, raw);
+}
+
+// Test: lossless compression restores the data and shrinks sorted particle IDs
+TEST(CompressionTest, LosslessRoundTrip) {
+    std::vector<std::int64_t> ids(10000);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ids[i] = 1000000 + 3 * i;
+    }
+    const auto raw     = toBytes(ids);
+    const auto message = encode(raw, Compression::losslessFor(sizeof(std::int64_t)));
+    EXPECT_LT(message.size(), raw.size() / 10);
+    EXPECT_EQ(decode(message, raw.size()), raw);
+}
+
+// Test: data that does not compress is sent with only the header added
+TEST(CompressionTest, IncompressibleData) {
+    std::mt19937_64 eng(42);
+    std::vector<char> raw(4096);
+    for (auto& c : raw) {
+        c = static_cast<char>(eng());
+    }
+    const auto message = encode(raw, Compression::losslessFor());
+    EXPECT_EQ(message.size(), compression::maxMessageSize(raw.size()));
+    EXPECT_EQ(decode(message, raw.size()), raw);
+}
+
+// Test: truncation rounds doubles to single precision and halves the message
+TEST(CompressionTest, Truncation) {
+    std::vector<double> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 1. / (i + 1);
+    }
+    const auto raw = toBytes(values);
+    for (bool lossless : {false, true}) {
+        const auto message = encode(raw, Compression::truncated(lossless));
+        EXPECT_LE(message.size(), sizeof(compression::Header) + raw.size() / 2);
+
+        const auto restored = decode(message, raw.size());
+        ASSERT_EQ(restored.size(), raw.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            double value;
+            std::memcpy(&value, restored.data() + i * sizeof(double), sizeof(double));
+            EXPECT_EQ(value, static_cast<double>(static_cast<float>(values[i])));
+        }
+    }
+}
+
+// Test: malformed messages are rejected instead of overrunning the output
+TEST(CompressionTest, MalformedMessage) {
+    std::vector<char> raw(1000, 'a');
+    auto message = encode(raw, Compression::losslessFor(1));
+
+    EXPECT_THROW(decode(message, raw.size() - 1), IpplException);
+    message.resize(message.size() - 1);
+    EXPECT_THROW(decode(message, raw.size()), IpplException);
+}
+
+// Test: a compressed archive message sent to the own rank is received intact
+TEST(CompressionTest, SendRecv) {
+    using memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+
+    const size_t n = 1000;
+    Kokkos::View<double*, memory_space> data("data", n), received("received", n);
+    Kokkos::parallel_for(
+        "fill", n, KOKKOS_LAMBDA(const size_t i) { data(i) = 0.5 * i; });
+    Kokkos::fence();
+
+    const auto compression = Compression::losslessFor(sizeof(double));
+    const int rank         = ippl::Comm->rank();
+    const size_t nbytes    = n * sizeof(double);
+
+    auto sendBuf = ippl::Comm->getBuffer<memory_space>(nbytes);
+    auto recvBuf = ippl::Comm->getBuffer<memory_space>(nbytes);
+
+    MPI_Request requests[2];
+    auto message = ippl::Comm->irecv(rank, 0, *recvBuf, requests[0], nbytes, compression);
+    sendBuf->serialize(data, n);
+    ippl::Comm->isend(rank, 0, *sendBuf, requests[1], compression);
+    MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+
+    ippl::Comm->decompress(message, *recvBuf);
+    recvBuf->deserialize(received, n);
+    ippl::Comm->freeAllBuffers();
+
+    auto expected = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+    auto actual   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), received);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(actual(i), expected(i));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int success = 1;
+    ippl::initialize(argc, argv);
+    {
+        ::testing::InitGoogleTest(&argc, argv);
+        success = RUN_ALL_TESTS();
+    }
+    ippl::finalize();
+    return success;
+}
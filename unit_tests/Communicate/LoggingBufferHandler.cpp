@@ -109,6 +109,25 @@ TYPED_TEST(TypedLoggingBufferHandlerTest, DeleteAllBuffersLogsCorrectly) {
     EXPECT_EQ(entry.rank, this->rank);
 }
 
+// Test: getBuffer records the allocation counters of the wrapped handler
+TYPED_TEST(TypedLoggingBufferHandlerTest, GetBufferLogsStatistics) {
+    auto buffer = this->loggingHandler->getBuffer(100, 1.0);
+    this->loggingHandler->freeBuffer(buffer);
+    this->loggingHandler->getBuffer(100, 1.0);
+
+    const auto& logs = this->loggingHandler->getLogs();
+    ASSERT_EQ(logs.size(), 3);
+
+    const auto& entry = logs[2];
+    EXPECT_EQ(entry.methodName, "getBuffer");
+    compareNumericParameter(entry.parameters.at("allocations"), 1);
+    compareNumericParameter(entry.parameters.at("reuses"), 1);
+
+    const auto stats = this->loggingHandler->getStatistics();
+    EXPECT_EQ(stats.allocations, this->bufferHandler->getStatistics().allocations);
+    EXPECT_EQ(stats.reuses, 1u);
+}
+
 int main(int argc, char* argv[]) {
     int success = 1;
     ippl::initialize(argc, argv);
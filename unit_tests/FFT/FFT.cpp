@@ -313,6 +313,124 @@ TYPED_TEST(FFTTest, CC) {
     ASSERT_NEAR(max_error.imag(), 0, tol);
 }
 
+template <typename T, typename PLayout>
+class NUFFTBunch : public ippl::ParticleBase<PLayout> {
+public:
+    ippl::ParticleAttrib<Kokkos::complex<T>> Q;
+
+    explicit NUFFTBunch(PLayout& playout)
+        : ippl::ParticleBase<PLayout>(playout) {
+        this->addAttribute(Q);
+    }
+};
+
+TYPED_TEST(FFTTest, NUFFT) {
+    using T              = typename TestFixture::value_type;
+    using exec_space     = typename TestFixture::exec_space;
+    using mesh_type      = typename TestFixture::mesh_type;
+    using field_type     = typename TestFixture::field_type_complex;
+    using layout_type    = typename TestFixture::layout_type;
+    using complex_type   = Kokkos::complex<T>;
+    using playout_type   = ippl::ParticleSpatialLayout<T, TestFixture::dim, mesh_type, exec_space>;
+    using bunch_type     = NUFFTBunch<T, playout_type>;
+    constexpr unsigned Dim = TestFixture::dim;
+
+    const T pi     = Kokkos::numbers::pi_v<T>;
+    const T nufftTol = std::is_same_v<T, float> ? 1e-4 : 1e-8;
+
+    // the modes are not distributed
+    std::array<ippl::Index, Dim> domains;
+    ippl::Vector<T, Dim> hx, origin;
+    for (unsigned d = 0; d < Dim; d++) {
+        domains[d] = ippl::Index(8 + 2 * d);
+        hx[d]      = 1;
+        origin[d]  = 0;
+    }
+    auto owned = std::make_from_tuple<ippl::NDIndex<Dim>>(domains);
+    std::array<bool, Dim> isParallel;
+    isParallel.fill(false);
+    layout_type layout(MPI_COMM_WORLD, owned, isParallel);
+    mesh_type mesh(owned, hx, origin);
+    field_type modes(mesh, layout);
+
+    ippl::ParameterList fftParams;
+    fftParams.add("use_heffte_defaults", true);
+    fftParams.add("tolerance", double(nufftTol));
+
+    ippl::FFT<ippl::NUFFTransform, field_type> type1(layout, 1, fftParams);
+    ippl::FFT<ippl::NUFFTransform, field_type> type2(layout, 2, fftParams);
+
+    // every rank holds the same particles
+    playout_type playout(layout, mesh);
+    bunch_type bunch(playout);
+    const size_t np = 50;
+    bunch.create(np);
+
+    auto R_host = bunch.R.getHostMirror();
+    auto Q_host = bunch.Q.getHostMirror();
+    std::mt19937_64 eng(7);
+    std::uniform_real_distribution<T> unif(-1, 1);
+    for (size_t j = 0; j < np; ++j) {
+        for (unsigned d = 0; d < Dim; d++) {
+            R_host(j)[d] = pi * unif(eng);
+        }
+        Q_host(j) = complex_type(unif(eng), unif(eng));
+    }
+    Kokkos::deep_copy(bunch.R.getView(), R_host);
+    Kokkos::deep_copy(bunch.Q.getView(), Q_host);
+
+    const int nghost = modes.getNghost();
+    const int nranks = ippl::Comm->size();
+
+    auto phase = [&](size_t j, const auto&... args) {
+        const int idx[] = {static_cast<int>(args)...};
+        T kx            = 0;
+        for (unsigned d = 0; d < Dim; d++) {
+            const int n = owned[d].length();
+            kx += (idx[d] - nghost - n / 2) * R_host(j)[d];
+        }
+        return complex_type(Kokkos::cos(kx), Kokkos::sin(kx));
+    };
+
+    // type 1: f(k) = sum_j Q_j exp(-i k.x_j)
+    type1.transform(bunch.R, bunch.Q, modes);
+    auto modes_host = modes.getHostMirror();
+    Kokkos::deep_copy(modes_host, modes.getView());
+
+    T maxError = 0, maxValue = 0;
+    nestedViewLoop(modes_host, nghost, [&]<typename... Idx>(const Idx... args) {
+        complex_type exact(0, 0);
+        for (size_t j = 0; j < np; ++j) {
+            exact += Q_host(j) * Kokkos::conj(phase(j, args...));
+        }
+        exact *= T(nranks);
+        maxError = std::max(maxError, Kokkos::abs(modes_host(args...) - exact));
+        maxValue = std::max(maxValue, Kokkos::abs(exact));
+    });
+    EXPECT_LT(maxError / maxValue, 10 * nufftTol);
+
+    // type 2: Q_j = sum_k f(k) exp(+i k.x_j)
+    nestedViewLoop(modes_host, nghost, [&]<typename... Idx>(const Idx... args) {
+        modes_host(args...) = complex_type(unif(eng), unif(eng));
+    });
+    Kokkos::deep_copy(modes.getView(), modes_host);
+
+    type2.transform(bunch.R, bunch.Q, modes);
+    Kokkos::deep_copy(Q_host, bunch.Q.getView());
+
+    maxError = 0;
+    maxValue = 0;
+    for (size_t j = 0; j < np; ++j) {
+        complex_type exact(0, 0);
+        nestedViewLoop(modes_host, nghost, [&]<typename... Idx>(const Idx... args) {
+            exact += modes_host(args...) * phase(j, args...);
+        });
+        maxError = std::max(maxError, Kokkos::abs(Q_host(j) - exact));
+        maxValue = std::max(maxValue, Kokkos::abs(exact));
+    }
+    EXPECT_LT(maxError / maxValue, 10 * nufftTol);
+}
+
 int main(int argc, char* argv[]) {
     int success = 1;
     ippl::initialize(argc, argv);
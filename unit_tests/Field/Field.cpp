@@ -169,6 +169,30 @@ TYPED_TEST(FieldTest, DeepCopy) {
     });
 }
 
+TYPED_TEST(FieldTest, FusedAssignment) {
+    using T = typename TestFixture::value_type;
+
+    auto& field = this->field;
+    auto other  = field->deepCopy();
+
+    *field = 1;
+    other  = 2;
+
+    // the second assignment sees the value written by the first one
+    ippl::fuse(ippl::assign(*field, *field + other), ippl::assign(other, T(2) * *field));
+
+    auto mirrorA = field->getHostMirror();
+    auto mirrorB = other.getHostMirror();
+
+    Kokkos::deep_copy(mirrorA, field->getView());
+    Kokkos::deep_copy(mirrorB, other.getView());
+
+    nestedViewLoop(mirrorA, field->getNghost(), [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(mirrorA(args...), 3);
+        assertEqual<T>(mirrorB(args...), 6);
+    });
+}
+
 TYPED_TEST(FieldTest, Sum) {
     using T = typename TestFixture::value_type;
 
@@ -462,6 +486,61 @@ TYPED_TEST(FieldTest, Laplace) {
         assertEqual<T>(mirror(args...), 0.);
     });
 }
+TYPED_TEST(FieldTest, OverlapMatchesBlocking) {
+    auto& mesh   = this->mesh;
+    auto& layout = this->layout;
+    auto& field  = this->field;
+
+    using field_type     = typename TestFixture::field_type;
+    using vfield_type    = typename TestFixture::vfield_type;
+    using T              = typename TestFixture::value_type;
+    constexpr size_t Dim = TestFixture::dim;
+
+    // Periodic boundaries, so that the halo exchange fills the ghost cells of every rank
+    using bc_type = ippl::BConds<field_type, Dim>;
+    bc_type bcField;
+    for (size_t i = 0; i < 2 * Dim; ++i) {
+        bcField[i] = std::make_shared<ippl::PeriodicFace<field_type>>(i);
+    }
+    field->setFieldBC(bcField);
+
+    const ippl::NDIndex<Dim> lDom = layout->getLocalNDIndex();
+    const int nghost              = field->getNghost();
+    const ippl::Vector<T, Dim> dx = mesh->getMeshSpacing();
+
+    FieldVal<TypeParam> fv(field->getView(), lDom, dx, nghost);
+    Kokkos::parallel_for(
+        "Set field", field->template getFieldRangePolicy<typename FieldVal<TypeParam>::Integral>(),
+        fv);
+
+    // The interior cells are computed before, the boundary cells after the halo exchange
+    vfield_type gradient(*mesh, *layout), gradientOverlap(*mesh, *layout);
+    gradient = ippl::grad(*field);
+    ippl::grad_overlap(gradientOverlap, *field);
+
+    auto expected = gradient.getHostMirror();
+    auto actual   = gradientOverlap.getHostMirror();
+    Kokkos::deep_copy(expected, gradient.getView());
+    Kokkos::deep_copy(actual, gradientOverlap.getView());
+    nestedViewLoop(actual, nghost, [&]<typename... Idx>(const Idx... args) {
+        for (size_t d = 0; d < Dim; d++) {
+            assertEqual<T>(actual(args...)[d], expected(args...)[d]);
+        }
+    });
+
+    field_type laplacian(*mesh, *layout), laplacianOverlap(*mesh, *layout);
+    laplacian = ippl::laplace(*field);
+    ippl::laplace_overlap(laplacianOverlap, *field);
+
+    auto expectedLaplace = laplacian.getHostMirror();
+    auto actualLaplace   = laplacianOverlap.getHostMirror();
+    Kokkos::deep_copy(expectedLaplace, laplacian.getView());
+    Kokkos::deep_copy(actualLaplace, laplacianOverlap.getView());
+    nestedViewLoop(actualLaplace, nghost, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(actualLaplace(args...), expectedLaplace(args...));
+    });
+}
+
 TYPED_TEST(FieldTest, LowerLaplace) {
     auto& mesh   = this->mesh;
     auto& layout = this->layout;
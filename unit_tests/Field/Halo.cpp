@@ -59,6 +59,51 @@ public:
 using Tests = TestParams::tests<1, 2, 3, 4, 5, 6>;
 TYPED_TEST_SUITE(HaloTest, Tests);
 
+// Set every owned cell to its global index along the first dimension
+template <typename Field>
+void fillGlobalIndex(Field& field) {
+    using T                = typename Field::value_type;
+    using index_array_type =
+        typename ippl::RangePolicy<Field::dim, typename Field::execution_space>::index_array_type;
+
+    auto view        = field.getView();
+    const auto ldom  = field.getLayout().getLocalNDIndex();
+    const int nghost = field.getNghost();
+    ippl::parallel_for(
+        "fillGlobalIndex", field.getFieldRangePolicy(), KOKKOS_LAMBDA(const index_array_type& args) {
+            ippl::apply(view, args) = T(ldom.first()[0] + static_cast<int>(args[0]) - nghost);
+        });
+    Kokkos::fence();
+}
+
+// One sweep of a smoothing stencil over the given range
+template <typename Field, typename Policy>
+void smoothSweep(Field& field, Field& tmp, const Policy& policy) {
+    constexpr unsigned Dim = Field::dim;
+    using T                = typename Field::value_type;
+    using index_array_type =
+        typename ippl::RangePolicy<Dim, typename Field::execution_space>::index_array_type;
+
+    auto view  = field.getView();
+    auto tview = tmp.getView();
+    ippl::parallel_for(
+        "smoothSweep", policy, KOKKOS_LAMBDA(const index_array_type& args) {
+            T sum = ippl::apply(view, args);
+            for (unsigned d = 0; d < Dim; ++d) {
+                index_array_type lo = args, hi = args;
+                lo[d] -= 1;
+                hi[d] += 1;
+                sum += ippl::apply(view, lo) + ippl::apply(view, hi);
+            }
+            ippl::apply(tview, args) = sum / (2 * Dim + 1);
+        });
+    ippl::parallel_for(
+        "smoothSweepCopy", policy, KOKKOS_LAMBDA(const index_array_type& args) {
+            ippl::apply(view, args) = ippl::apply(tview, args);
+        });
+    Kokkos::fence();
+}
+
 TYPED_TEST(HaloTest, CheckNeighbors) {
     int myRank = ippl::Comm->rank();
     int nRanks = ippl::Comm->size();
@@ -148,6 +193,192 @@ TYPED_TEST(HaloTest, FillHalo) {
     });
 }
 
+TYPED_TEST(HaloTest, FillHaloSplitPhase) {
+    auto& field = this->field;
+
+    *field = 1;
+    field->fillHaloBegin();
+    field->fillHaloEnd();
+
+    auto view = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field->getView());
+    nestedViewLoop(view, 0, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<typename TestFixture::value_type>(view(args...), 1);
+    });
+}
+
+TYPED_TEST(HaloTest, SharedPlanReentry) {
+    if (ippl::Comm->size() < 2) {
+        GTEST_SKIP();
+    }
+    auto& field = this->field;
+
+    // the copy shares the cached plan and with it the persistent requests
+    field->fillHalo();
+    typename TestFixture::field_type copy(*field);
+
+    field->fillHaloBegin();
+    EXPECT_THROW(copy.fillHaloBegin(), IpplException);
+    field->fillHaloEnd();
+
+    EXPECT_NO_THROW(copy.fillHalo());
+}
+
+TYPED_TEST(HaloTest, RepeatedFillHalo) {
+    auto& field = this->field;
+
+    // the second exchange reuses the cached halo plan of the first one
+    for (int value = 1; value <= 2; ++value) {
+        *field = value;
+        field->fillHalo();
+
+        auto view = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field->getView());
+        nestedViewLoop(view, 0, [&]<typename... Idx>(const Idx... args) {
+            assertEqual<typename TestFixture::value_type>(view(args...), value);
+        });
+    }
+}
+
+TYPED_TEST(HaloTest, InteriorBoundarySplit) {
+    using T                = typename TestFixture::value_type;
+    constexpr unsigned Dim = TestFixture::dim;
+    using index_array_type =
+        typename ippl::RangePolicy<Dim, typename TestFixture::exec_space>::index_array_type;
+
+    auto& field       = this->field;
+    const int nghost  = field->getNghost();
+    auto view         = field->getView();
+    auto incrementOne = KOKKOS_LAMBDA(const index_array_type& args) {
+        ippl::apply(view, args) += 1;
+    };
+
+    *field = 0;
+    field->fillHaloBegin();
+    ippl::parallel_for_interior("InteriorBoundarySplit", view, nghost, 1, incrementOne);
+    Kokkos::fence();
+    field->fillHaloEnd();
+    ippl::parallel_for_boundary("InteriorBoundarySplit", view, nghost, 1, incrementOne);
+    Kokkos::fence();
+
+    // every owned cell must have been visited exactly once
+    auto mirror = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+    nestedViewLoop(mirror, nghost, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(mirror(args...), 1);
+    });
+}
+
+TYPED_TEST(HaloTest, HaloGroupFill) {
+    using T                = typename TestFixture::value_type;
+    constexpr unsigned Dim = TestFixture::dim;
+    using vfield_type      = ippl::Field<ippl::Vector<T, Dim>, Dim, typename TestFixture::mesh_type,
+                                         typename TestFixture::centering_type,
+                                         typename TestFixture::exec_space>;
+    using memory_space     = typename TestFixture::field_type::memory_space;
+
+    auto& field = this->field;
+    vfield_type vfield(this->mesh, this->layout);
+
+    *field = 1;
+    vfield = ippl::Vector<T, Dim>(2);
+
+    ippl::HaloGroup<Dim, memory_space> group;
+    group.add(*field);
+    group.add(vfield);
+    group.fillHalo();
+
+    auto view = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field->getView());
+    nestedViewLoop(view, 0, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(view(args...), 1);
+    });
+
+    auto vview = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), vfield.getView());
+    nestedViewLoop(vview, 0, [&]<typename... Idx>(const Idx... args) {
+        for (unsigned d = 0; d < Dim; d++) {
+            assertEqual<T>(vview(args...)[d], 2);
+        }
+    });
+}
+
+TYPED_TEST(HaloTest, HaloGroupAccumulate) {
+    using T                = typename TestFixture::value_type;
+    constexpr unsigned Dim = TestFixture::dim;
+    using field_type       = typename TestFixture::field_type;
+    using vfield_type      = ippl::Field<ippl::Vector<T, Dim>, Dim, typename TestFixture::mesh_type,
+                                         typename TestFixture::centering_type,
+                                         typename TestFixture::exec_space>;
+    using memory_space     = typename field_type::memory_space;
+
+    field_type field(this->mesh, this->layout), refField(this->mesh, this->layout);
+    vfield_type vfield(this->mesh, this->layout), refVfield(this->mesh, this->layout);
+
+    // the values include the halo cells, so every rank contributes to its neighbors
+    field     = 1;
+    refField  = 1;
+    vfield    = ippl::Vector<T, Dim>(2);
+    refVfield = ippl::Vector<T, Dim>(2);
+
+    ippl::HaloGroup<Dim, memory_space> group;
+    group.add(field);
+    group.add(vfield);
+    group.accumulateHalo();
+
+    refField.accumulateHalo();
+    refVfield.accumulateHalo();
+
+    auto view    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field.getView());
+    auto refView = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), refField.getView());
+    nestedViewLoop(view, 0, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(view(args...), refView(args...));
+    });
+
+    auto vview = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), vfield.getView());
+    auto refVview =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), refVfield.getView());
+    nestedViewLoop(vview, 0, [&]<typename... Idx>(const Idx... args) {
+        for (unsigned d = 0; d < Dim; d++) {
+            assertEqual<T>(vview(args...)[d], refVview(args...)[d]);
+        }
+    });
+}
+
+TYPED_TEST(HaloTest, DeepHaloSweeps) {
+    using T                = typename TestFixture::value_type;
+    constexpr unsigned Dim = TestFixture::dim;
+    using field_type       = typename TestFixture::field_type;
+    using layout_type      = typename TestFixture::layout_type;
+
+    std::array<bool, Dim> isParallel;
+    isParallel.fill(true);
+    const auto& owned = this->layout.getDomain();
+
+    layout_type refLayout(MPI_COMM_WORLD, owned, isParallel, true);
+    field_type ref(this->mesh, refLayout), refTmp(this->mesh, refLayout);
+
+    constexpr int nghost = 2;
+    layout_type deepLayout(MPI_COMM_WORLD, owned, isParallel, true, nghost);
+    field_type deep(this->mesh, deepLayout, nghost), deepTmp(this->mesh, deepLayout, nghost);
+
+    fillGlobalIndex(ref);
+    fillGlobalIndex(deep);
+
+    // reference: one exchange per sweep
+    constexpr unsigned nsweeps = 3;
+    for (unsigned s = 0; s < nsweeps; ++s) {
+        ref.fillHalo();
+        smoothSweep(ref, refTmp, ref.getFieldRangePolicy());
+    }
+
+    // deep halo: two exchanges for three sweeps
+    ippl::deepHaloSweeps(deep, nsweeps, 1, [&](const auto& policy) {
+        smoothSweep(deep, deepTmp, policy);
+    });
+
+    auto refView  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ref.getView());
+    auto deepView = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), deep.getView());
+    nestedViewLoop(refView, 1, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(deepView((args + 1)...), refView(args...));
+    });
+}
+
 TYPED_TEST(HaloTest, AccumulateHalo) {
     constexpr unsigned Dim = TestFixture::dim;
 
@@ -219,6 +450,166 @@ TYPED_TEST(HaloTest, AccumulateHalo) {
     });
 }
 
+TYPED_TEST(HaloTest, AccumulateHaloTruncated) {
+    using T = typename TestFixture::value_type;
+
+    auto& field = this->field;
+    typename TestFixture::field_type truncated(this->mesh, this->layout);
+
+    *field    = 1. / 3;
+    truncated = 1. / 3;
+    field->accumulateHalo();
+    truncated.getHalo().setCompression(ippl::mpi::Compression::truncated());
+    truncated.accumulateHalo();
+
+    // Only doubles are truncated, and then to single precision
+    const T tolerance = std::is_same_v<T, double> ? 1e-6 : 0;
+
+    auto expected = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field->getView());
+    auto actual = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), truncated.getView());
+    nestedViewLoop(expected, 0, [&]<typename... Idx>(const Idx... args) {
+        ASSERT_NEAR(actual(args...), expected(args...), tolerance);
+    });
+}
+
+TYPED_TEST(HaloTest, SharedMemoryExchange) {
+    using T          = typename TestFixture::value_type;
+    using field_type = typename TestFixture::field_type;
+
+    auto& field = this->field;
+    field_type shared(this->mesh, this->layout);
+    shared.getHalo().setSharedMemoryExchange(true);
+
+    // repeated exchanges alternate between the slots of the shared window
+    fillGlobalIndex(*field);
+    fillGlobalIndex(shared);
+    for (int i = 0; i < 3; ++i) {
+        field->fillHalo();
+        shared.fillHalo();
+        field->accumulateHalo();
+        shared.accumulateHalo();
+    }
+
+    auto expected = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field->getView());
+    auto actual   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), shared.getView());
+    nestedViewLoop(expected, 0, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<T>(actual(args...), expected(args...));
+    });
+}
+
+TYPED_TEST(HaloTest, SharedMemoryDestructionOrder) {
+    using field_type = typename TestFixture::field_type;
+
+    // The plans release their windows without collective calls, so the fields may be
+    // destroyed in a different order on every rank
+    std::array<std::unique_ptr<field_type>, 2> fields;
+    for (auto& field : fields) {
+        field = std::make_unique<field_type>(this->mesh, this->layout);
+        field->getHalo().setSharedMemoryExchange(true);
+        fillGlobalIndex(*field);
+        field->fillHalo();
+    }
+    const int first = ippl::Comm->rank() % 2;
+    fields[first].reset();
+    fields[1 - first].reset();
+
+    // The next window frees the released ones collectively
+    field_type shared(this->mesh, this->layout);
+    shared.getHalo().setSharedMemoryExchange(true);
+    fillGlobalIndex(shared);
+    shared.fillHalo();
+
+    fillGlobalIndex(*this->field);
+    this->field->fillHalo();
+    auto expected =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), this->field->getView());
+    auto actual = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), shared.getView());
+    nestedViewLoop(expected, 0, [&]<typename... Idx>(const Idx... args) {
+        assertEqual<typename TestFixture::value_type>(actual(args...), expected(args...));
+    });
+}
+
+TYPED_TEST(HaloTest, SharedMemoryLayoutLifetime) {
+    using field_type  = typename TestFixture::field_type;
+    using layout_type = typename TestFixture::layout_type;
+
+    fillGlobalIndex(*this->field);
+    this->field->fillHalo();
+    auto expected =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), this->field->getView());
+
+    // Every layout frees its node communicator and windows when it is destroyed, so
+    // recreating layouts, e.g. when regridding, does not accumulate them
+    for (int k = 0; k < 8; ++k) {
+        layout_type layout(MPI_COMM_WORLD, this->layout.getDomain(), this->layout.isParallel());
+        field_type shared(this->mesh, layout);
+        shared.getHalo().setSharedMemoryExchange(true);
+        fillGlobalIndex(shared);
+        shared.fillHalo();
+
+        auto actual = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), shared.getView());
+        nestedViewLoop(expected, 0, [&]<typename... Idx>(const Idx... args) {
+            assertEqual<typename TestFixture::value_type>(actual(args...), expected(args...));
+        });
+    }
+}
+
+TYPED_TEST(HaloTest, NodeAwareMapping) {
+    using T                = typename TestFixture::value_type;
+    constexpr unsigned Dim = TestFixture::dim;
+    using field_type       = typename TestFixture::field_type;
+    using layout_type      = typename TestFixture::layout_type;
+
+    const auto& owned = this->layout.getDomain();
+    std::array<bool, Dim> isParallel;
+    isParallel.fill(true);
+
+    layout_type layout(MPI_COMM_WORLD);
+    layout.setNodeAwareMapping(true);
+    layout.initialize(owned, isParallel);
+
+    auto same = [](const ippl::NDIndex<Dim>& a, const ippl::NDIndex<Dim>& b) {
+        return a.contains(b) && b.contains(a);
+    };
+
+    // The local domains are a permutation of the default decomposition
+    const int nRanks = ippl::Comm->size();
+    for (int r = 0; r < nRanks; ++r) {
+        int count = 0;
+        for (int k = 0; k < nRanks; ++k) {
+            count += same(this->layout.getLocalNDIndex(k), layout.getLocalNDIndex(r));
+        }
+        ASSERT_EQ(count, 1);
+    }
+
+    // Disabling the mapping restores the default decomposition
+    layout_type restored(MPI_COMM_WORLD);
+    restored.setNodeAwareMapping(true);
+    restored.initialize(owned, isParallel);
+    restored.setNodeAwareMapping(false);
+    for (int r = 0; r < nRanks; ++r) {
+        ASSERT_TRUE(same(restored.getLocalNDIndex(r), this->layout.getLocalNDIndex(r)));
+    }
+
+    // Halo cells inside the global domain hold the global index of the neighboring cell
+    field_type field(this->mesh, layout);
+    fillGlobalIndex(field);
+    field.fillHalo();
+
+    const auto ldom = layout.getLocalNDIndex();
+    auto view       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), field.getView());
+    nestedViewLoop(view, 0, [&]<typename... Idx>(const Idx... args) {
+        const int local[Dim] = {static_cast<int>(args)...};
+        for (unsigned d = 0; d < Dim; ++d) {
+            const int global = ldom.first()[d] + local[d] - 1;
+            if (global < owned[d].first() || global > owned[d].last()) {
+                return;
+            }
+        }
+        assertEqual<T>(view(args...), ldom.first()[0] + local[0] - 1);
+    });
+}
+
 int main(int argc, char* argv[]) {
     int success = 1;
     ippl::initialize(argc, argv);
@@ -0,0 +1,207 @@
+//
+// Unit test TruncatedGreenParticleInteraction
+//   Test the short range interaction evaluated once per unique pair and with the cluster pair
+//   list against a reference summing over the full neighbor list.
+//
+#include "Ippl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+
+#include "Interaction/TruncatedGreenParticleInteraction.h"
+#include "Particle/ParticleSpatialOverlapLayout.h"
+#include "TestUtils.h"
+#include "gtest/gtest.h"
+
+template <typename T, typename ExecSpace, unsigned Dim>
+struct InteractionBunch
+    : public ippl::ParticleBase<
+          ippl::ParticleSpatialOverlapLayout<T, Dim, ippl::UniformCartesian<T, Dim>, ExecSpace>> {
+    using playout_type =
+        ippl::ParticleSpatialOverlapLayout<T, Dim, ippl::UniformCartesian<T, Dim>, ExecSpace>;
+    using scalar_attrib_type = ippl::ParticleAttrib<T, ExecSpace>;
+    using vector_attrib_type = ippl::ParticleAttrib<ippl::Vector<T, Dim>, ExecSpace>;
+
+    explicit InteractionBunch(playout_type& pl)
+        : ippl::ParticleBase<playout_type>(pl) {
+        this->addAttribute(Q);
+        this->addAttribute(F);
+        this->addAttribute(reference);
+    }
+
+    scalar_attrib_type Q;
+    vector_attrib_type F;
+    vector_attrib_type reference;
+};
+
+template <typename>
+class TruncatedGreenParticleInteractionTest;
+
+template <typename T_, typename ExecSpace, unsigned Dim_>
+class TruncatedGreenParticleInteractionTest<Parameters<T_, ExecSpace, Rank<Dim_>>>
+    : public ::testing::Test {
+public:
+    using T                       = T_;
+    using exec_space              = ExecSpace;
+    static constexpr unsigned Dim = Dim_;
+    using flayout_type            = ippl::FieldLayout<Dim>;
+    using mesh_type               = ippl::UniformCartesian<T, Dim>;
+    using bunch_type              = InteractionBunch<T, ExecSpace, Dim>;
+    using playout_type            = typename bunch_type::playout_type;
+    using interaction_type =
+        ippl::TruncatedGreenParticleInteraction<bunch_type, typename bunch_type::vector_attrib_type,
+                                                typename bunch_type::scalar_attrib_type>;
+
+    // Relative tolerance of the field; the summation order differs between the traversals
+    static constexpr T tolerance = std::is_same_v<T, double> ? 1e-10 : 1e-3;
+
+    TruncatedGreenParticleInteractionTest() {
+        std::array<ippl::Index, Dim> args;
+        args.fill(ippl::Index(nPoints));
+        auto owned = std::make_from_tuple<ippl::NDIndex<Dim>>(args);
+
+        std::array<bool, Dim> isParallel;
+        isParallel.fill(true);
+
+        ippl::Vector<T, Dim> hx     = T(1) / nPoints;
+        ippl::Vector<T, Dim> origin = 0;
+
+        layout = std::make_shared<flayout_type>(MPI_COMM_WORLD, owned, isParallel);
+        mesh   = std::make_shared<mesh_type>(owned, hx, origin);
+
+        params.add("rcut", rcut);
+        params.add("alpha", alpha);
+        params.add("force_constant", T(0.5));
+    }
+
+    //! Distribute n particles with random positions and charges in the unit cube
+    void fillRandom(bunch_type& bunch, size_t n) {
+        typename bunch_type::bc_container_type bcs;
+        bcs.fill(ippl::BC::PERIODIC);
+        bunch.setParticleBC(bcs);
+
+        const size_t perRank = n / ippl::Comm->size();
+        bunch.create(perRank);
+
+        std::mt19937_64 eng(7 + ippl::Comm->rank());
+        std::uniform_real_distribution<T> unif(T(0), T(1));
+        auto R_host = bunch.R.getHostMirror();
+        auto Q_host = bunch.Q.getHostMirror();
+        for (size_t i = 0; i < perRank; ++i) {
+            for (unsigned d = 0; d < Dim; ++d) {
+                R_host(i)[d] = unif(eng);
+            }
+            Q_host(i) = T(0.5) + unif(eng);
+        }
+        Kokkos::deep_copy(bunch.R.getView(), R_host);
+        Kokkos::deep_copy(bunch.Q.getView(), Q_host);
+        bunch.update();
+    }
+
+    //! Sum the field of all partners within rcut of every particle with forEachPair
+    void referenceField(bunch_type& bunch, const playout_type& pl) {
+        using vector_type = ippl::Vector<T, Dim>;
+
+        bunch.reference = vector_type(0);
+
+        const auto R          = bunch.R.getView();
+        const auto Q          = bunch.Q.getView();
+        auto reference        = bunch.reference.getView();
+        const T rcut2         = rcut * rcut;
+        const T forceConstant = params.template get<T>("force_constant");
+        const ippl::detail::TruncatedGreenExactShape<T> shape{alpha};
+        pl.template forEachPair<exec_space>(KOKKOS_LAMBDA(const size_t i, const size_t j) {
+            const vector_type dist = R(i) - R(j);
+            const T r2             = dist.dot(dist);
+            if (r2 < rcut2) {
+                const T r = Kokkos::sqrt(r2);
+                const T f = forceConstant * Q(j) * shape(r) / (r2 * r);
+                for (unsigned d = 0; d < Dim; ++d) {
+                    Kokkos::atomic_add(&reference(i)[d], -f * dist[d]);
+                }
+            }
+        });
+    }
+
+    //! Expect the computed field to match the reference for all local particles
+    void expectReferenceField(bunch_type& bunch) {
+        auto F         = bunch.F.getHostMirror();
+        auto reference = bunch.reference.getHostMirror();
+        Kokkos::deep_copy(F, bunch.F.getView());
+        Kokkos::deep_copy(reference, bunch.reference.getView());
+
+        T scale = 0;
+        for (size_t i = 0; i < bunch.getLocalNum(); ++i) {
+            for (unsigned d = 0; d < Dim; ++d) {
+                scale = std::max(scale, std::abs(reference(i)[d]));
+            }
+        }
+        ASSERT_GT(scale, T(0));
+
+        for (size_t i = 0; i < bunch.getLocalNum(); ++i) {
+            for (unsigned d = 0; d < Dim; ++d) {
+                EXPECT_NEAR(F(i)[d], reference(i)[d], tolerance * scale) << "particle " << i;
+            }
+        }
+    }
+
+    static constexpr size_t nPoints = 16;
+    const T rcut                    = 0.1;
+    const T alpha                   = 20;
+
+    ippl::ParameterList params;
+    std::shared_ptr<flayout_type> layout;
+    std::shared_ptr<mesh_type> mesh;
+};
+
+using Tests = TestParams::tests<3>;
+TYPED_TEST_SUITE(TruncatedGreenParticleInteractionTest, Tests);
+
+TYPED_TEST(TruncatedGreenParticleInteractionTest, UniquePairsMatchFullList) {
+    using T = typename TestFixture::T;
+
+    typename TestFixture::playout_type pl(*this->layout, *this->mesh, this->rcut);
+    typename TestFixture::bunch_type bunch(pl);
+    this->fillRandom(bunch, 2048);
+    this->referenceField(bunch, pl);
+
+    bunch.F = ippl::Vector<T, TestFixture::Dim>(0);
+    typename TestFixture::interaction_type interaction(bunch, bunch.F, bunch.R, bunch.Q,
+                                                       this->params);
+    interaction.solve();
+
+    this->expectReferenceField(bunch);
+}
+
+TYPED_TEST(TruncatedGreenParticleInteractionTest, ClusterPairsMatchFullList) {
+    using T = typename TestFixture::T;
+
+    for (unsigned clusterSize : {4u, 8u}) {
+        typename TestFixture::playout_type pl(*this->layout, *this->mesh, this->rcut);
+        pl.setClusterSize(clusterSize);
+        typename TestFixture::bunch_type bunch(pl);
+        this->fillRandom(bunch, 2048);
+        this->referenceField(bunch, pl);
+
+        bunch.F = ippl::Vector<T, TestFixture::Dim>(0);
+        typename TestFixture::interaction_type interaction(bunch, bunch.F, bunch.R, bunch.Q,
+                                                           this->params);
+        interaction.solve();
+
+        SCOPED_TRACE("cluster size " + std::to_string(clusterSize));
+        this->expectReferenceField(bunch);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int success = 1;
+    ippl::initialize(argc, argv);
+    {
+        ::testing::InitGoogleTest(&argc, argv);
+        success = RUN_ALL_TESTS();
+    }
+    ippl::finalize();
+    return success;
+}
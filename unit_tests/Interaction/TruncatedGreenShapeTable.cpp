@@ -0,0 +1,89 @@
+//
+// Unit test TruncatedGreenShapeTable
+//   Test the tabulated force shape of the truncated Green's function interaction against the
+//   exact form.
+//
+#include "Ippl.h"
+
+#include <cmath>
+
+#include "Interaction/TruncatedGreenShapeTable.h"
+#include "TestUtils.h"
+#include "gtest/gtest.h"
+
+template <typename>
+class TruncatedGreenShapeTableTest;
+
+template <typename T, typename ExecSpace>
+class TruncatedGreenShapeTableTest<Parameters<T, ExecSpace>> : public ::testing::Test {
+public:
+    using value_type      = T;
+    using execution_space = ExecSpace;
+    using table_type = ippl::detail::TruncatedGreenShapeTable<T, typename ExecSpace::memory_space>;
+
+    // Relative tolerance requested from the table; float cannot resolve much below 1e-6
+    static constexpr T tolerance = std::is_same_v<T, double> ? 1e-9 : 1e-4;
+
+    const T alpha = 2.5;
+    const T rcut  = 1.2;
+};
+
+using Tests = TestParams::tests<>;
+TYPED_TEST_SUITE(TruncatedGreenShapeTableTest, Tests);
+
+TYPED_TEST(TruncatedGreenShapeTableTest, ExactShape) {
+    // g(r) / r^3 must reproduce the gradient of (1 - erf(alpha r)) / r
+    const double alpha = this->alpha;
+    const ippl::detail::TruncatedGreenExactShape<double> shape{alpha};
+
+    for (double r : {1e-3, 0.1, 0.5, 1.0, 1.2}) {
+        const double reference = 2.0 * alpha * std::exp(-alpha * alpha * r * r)
+                                     / (std::sqrt(Kokkos::numbers::pi) * r * r)
+                                 + (1.0 - std::erf(alpha * r)) / (r * r * r);
+        EXPECT_NEAR(shape(r) / (r * r * r), reference, 1e-12 * reference);
+    }
+}
+
+TYPED_TEST(TruncatedGreenShapeTableTest, RelativeError) {
+    using T = typename TestFixture::value_type;
+
+    const T tolerance = TestFixture::tolerance;
+    typename TestFixture::table_type table(this->alpha, this->rcut, tolerance);
+
+    EXPECT_LE(table.getMaxRelativeError(), tolerance);
+
+    // Check on points that do not coincide with the samples used while building the table
+    const size_t nPoints = 100003;
+    const double dr      = this->rcut / nPoints;
+    const ippl::detail::TruncatedGreenExactShape<double> exact{this->alpha};
+
+    double maxError = 0;
+    Kokkos::parallel_reduce(
+        "TruncatedGreenShapeTable::RelativeError",
+        Kokkos::RangePolicy<typename TestFixture::execution_space>(1, nPoints + 1),
+        KOKKOS_LAMBDA(const size_t i, double& error) {
+            const T r      = static_cast<T>(i * dr);
+            const double e = Kokkos::abs(table(r) - exact(r)) / exact(r);
+            error          = Kokkos::max(error, e);
+        },
+        Kokkos::Max<double>(maxError));
+
+    EXPECT_LE(maxError, tolerance);
+}
+
+TYPED_TEST(TruncatedGreenShapeTableTest, UnreachableTolerance) {
+    using table_type = typename TestFixture::table_type;
+
+    EXPECT_THROW(table_type(this->alpha, this->rcut, 1e-12, 64), IpplException);
+}
+
+int main(int argc, char* argv[]) {
+    int success = 1;
+    ippl::initialize(argc, argv);
+    {
+        ::testing::InitGoogleTest(&argc, argv);
+        success = RUN_ALL_TESTS();
+    }
+    ippl::finalize();
+    return success;
+}
@@ -2,6 +2,7 @@
 #include "Ippl.h"
 
 #include "Interpolation/Binning.h"
+#include "Interpolation/BinningCache.h"
 
 #include <algorithm>
 #include <numeric>
@@ -625,6 +626,102 @@ namespace ippl {
             }
         }
 
+        // Test 9: BinningCache reuses, updates and recomputes the binning
+        TYPED_TEST(BinningTestTyped, BinningCache) {
+            constexpr unsigned Dim = TypeParam::value;
+            using T                = typename TestFixture::T;
+            using PLayout_t        = typename TestFixture::PLayout_t;
+
+            Vector<int, Dim> ngrid_global, ngrid_local, local_offset;
+            this->getLocalDomainInfo(ngrid_global, ngrid_local, local_offset);
+
+            Vector<int, Dim> num_tiles;
+            size_t total_tiles = 1;
+            for (unsigned d = 0; d < Dim; ++d) {
+                num_tiles[d] = (ngrid_local[d] + this->tile_size[d] - 1) / this->tile_size[d] + 1;
+                total_tiles *= num_tiles[d];
+            }
+
+            PLayout_t playout(*this->layout, *this->mesh);
+            ParticleBase<PLayout_t> bunch(playout);
+
+            const size_t n_particles = 1000;
+            bunch.create(n_particles);
+
+            auto pos_host = bunch.R.getHostMirror();
+            std::mt19937 rng(2024 + this->myRank);
+            std::uniform_real_distribution<T> dist(0.0, 1.0);
+            for (size_t i = 0; i < n_particles; ++i) {
+                for (unsigned d = 0; d < Dim; ++d) {
+                    T local_min    = this->origin[d] + local_offset[d] * this->hx[d];
+                    T local_max    = local_min + ngrid_local[d] * this->hx[d];
+                    pos_host(i)[d] = local_min + dist(rng) * (local_max - local_min);
+                }
+            }
+            Kokkos::deep_copy(bunch.R.getView(), pos_host);
+            bunch.R.markModified();
+
+            auto check = [&](const auto& result) {
+                auto permute_host =
+                    Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result.permute);
+                auto offsets_host =
+                    Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result.bin_offsets);
+                Kokkos::deep_copy(pos_host, bunch.R.getView());
+
+                ASSERT_EQ(offsets_host(total_tiles), n_particles);
+                std::vector<bool> seen(n_particles, false);
+                for (size_t b = 0; b < total_tiles; ++b) {
+                    for (size_t j = offsets_host(b); j < offsets_host(b + 1); ++j) {
+                        const size_t i = permute_host(j);
+                        ASSERT_LT(i, n_particles);
+                        ASSERT_FALSE(seen[i]) << "Duplicate index in permutation: " << i;
+                        seen[i] = true;
+                        EXPECT_EQ(static_cast<size_t>(this->computeExpectedBin(
+                                      pos_host(i), ngrid_global, local_offset, num_tiles)),
+                                  b);
+                    }
+                }
+            };
+
+            // Shift a fraction of the particles by the given distance in dimension 0
+            auto shift = [&](size_t every, T distance) {
+                Kokkos::deep_copy(pos_host, bunch.R.getView());
+                for (size_t i = 0; i < n_particles; i += every) {
+                    T local_min    = this->origin[0] + local_offset[0] * this->hx[0];
+                    T local_max    = local_min + ngrid_local[0] * this->hx[0];
+                    T x            = pos_host(i)[0] + distance;
+                    pos_host(i)[0] = x < local_max ? x : x - (local_max - local_min);
+                }
+                Kokkos::deep_copy(bunch.R.getView(), pos_host);
+                bunch.R.markModified();
+            };
+
+            Interpolation::BinningCache<Dim> cache;
+            const auto& stats = cache.getStatistics();
+
+            check(cache.bin(bunch.R, *this->layout, *this->mesh, this->tile_size,
+                            this->kernel_width));
+            EXPECT_EQ(stats.full, 1u);
+
+            // Unmodified positions
+            check(cache.bin(bunch.R, *this->layout, *this->mesh, this->tile_size,
+                            this->kernel_width));
+            EXPECT_EQ(stats.hits, 1u);
+
+            // A few particles move by one tile
+            shift(50, this->tile_size[0] * this->hx[0]);
+            check(cache.bin(bunch.R, *this->layout, *this->mesh, this->tile_size,
+                            this->kernel_width));
+            EXPECT_EQ(stats.incremental + stats.unchanged, 1u);
+            EXPECT_EQ(stats.full, 1u);
+
+            // All particles move by half the domain
+            shift(1, 0.5 * ngrid_local[0] * this->hx[0]);
+            check(cache.bin(bunch.R, *this->layout, *this->mesh, this->tile_size,
+                            this->kernel_width));
+            EXPECT_EQ(stats.full, 2u);
+        }
+
     }  // namespace test
 }  // namespace ippl
 
@@ -3,6 +3,7 @@
 #include <Kokkos_Complex.hpp>
 #include <Kokkos_Random.hpp>
 #include <cmath>
+#include <limits>
 #include <numeric>
 #include <string>
 
@@ -450,6 +451,54 @@ public:
         }
     }
 
+    // Test 2b: Fused scatter of two attributes matches two separate scatters
+    void runFusedScatterTest(const scatter_config_type& config) {
+        field_type fieldA(*mesh, *layout, nghost);
+        field_type fieldB(*mesh, *layout, nghost);
+        field_type refA(*mesh, *layout, nghost);
+        field_type refB(*mesh, *layout, nghost);
+
+        size_t nParticles = 1000;
+        createUniformParticles(nParticles);
+
+        auto weight_view = bunch->weight.getView();
+        auto second_view = bunch->gathered_scalar.getView();
+        using RandPool   = Kokkos::Random_XorShift64_Pool<ExecSpace>;
+        RandPool randPool(7 + myRank);
+
+        Kokkos::parallel_for(
+            "set_random_weights", Kokkos::RangePolicy<ExecSpace>(0, bunch->getLocalNum()),
+            KOKKOS_LAMBDA(size_t i) {
+                typename RandPool::generator_type gen = randPool.get_state();
+                weight_view(i)                        = gen.drand(0.1, 10.0);
+                second_view(i)                        = gen.drand(-1.0, 1.0);
+                randPool.free_state(gen);
+            });
+        ippl::fence();
+
+        bunch->update();
+
+        auto scatter = ippl::Scatter(kernel, config);
+        scatter(refA, bunch->R, bunch->weight);
+        scatter(refB, bunch->R, bunch->gathered_scalar);
+        scatter(std::tie(fieldA, fieldB), bunch->R, bunch->weight, bunch->gathered_scalar);
+
+        const T scaleA = ippl::norm(refA, 0);
+        const T scaleB = ippl::norm(refB, 0);
+        refA           = refA - fieldA;
+        refB           = refB - fieldB;
+        const T diffA  = ippl::norm(refA, 0);
+        const T diffB  = ippl::norm(refB, 0);
+
+        const T tol = 100 * std::numeric_limits<T>::epsilon();
+        if (myRank == 0) {
+            EXPECT_LE(diffA, tol * scaleA)
+                << "Fused scatter differs from single scatter for " << kernel_traits::name;
+            EXPECT_LE(diffB, tol * scaleB)
+                << "Fused scatter differs from single scatter for " << kernel_traits::name;
+        }
+    }
+
     // Test 3: Periodic boundary handling
     void runPeriodicBoundaryTest(const scatter_config_type& config) {
         field_type field(*mesh, *layout, nghost);
@@ -1275,6 +1324,20 @@ TYPED_TEST(ScatterGatherTest, Gather_ConstantField_AtomicSort) {
     this->runGatherConstantFieldTest(config);
 }
 
+TYPED_TEST(ScatterGatherTest, Gather_ConstantField_Tiled) {
+    typename TestFixture::gather_config_type config;
+    config.method = ippl::Interpolation::GatherMethod::Tiled;
+    this->runGatherConstantFieldTest(config);
+}
+
+// A tile whose staged block exceeds the team scratch of every backend is shrunk to fit
+TYPED_TEST(ScatterGatherTest, Gather_ConstantField_TiledOversizedTile) {
+    typename TestFixture::gather_config_type config;
+    config.method = ippl::Interpolation::GatherMethod::Tiled;
+    config.set_tile_size(256);
+    this->runGatherConstantFieldTest(config);
+}
+
 
 TYPED_TEST(ScatterGatherTest, Gather_Convergence_Atomic) {
     typename TestFixture::gather_config_type config;
@@ -1314,6 +1377,17 @@ TYPED_TEST(ScatterGatherTest, Adjointness_AtomicSort_AtomicSort) {
     this->runAdjointnessTest(scatterCfg, gatherCfg);
 }
 
+TYPED_TEST(ScatterGatherTest, Adjointness_Tiled_Tiled) {
+    typename TestFixture::scatter_config_type scatterCfg;
+    scatterCfg.method = ippl::Interpolation::ScatterMethod::Tiled;
+    scatterCfg.sort   = true;
+
+    typename TestFixture::gather_config_type gatherCfg;
+    gatherCfg.method = ippl::Interpolation::GatherMethod::Tiled;
+
+    this->runAdjointnessTest(scatterCfg, gatherCfg);
+}
+
 //=============================================================================
 // Edge Case Tests
 //=============================================================================
@@ -1339,6 +1413,105 @@ TYPED_TEST(ScatterGatherTest, SingleParticleAtGridPoint) {
     this->runSingleParticleAtGridPointTest(config);
 }
 
+//=============================================================================
+// Fused Scatter Tests
+//=============================================================================
+
+TYPED_TEST(ScatterGatherTest, FusedScatter_Atomic) {
+    typename TestFixture::scatter_config_type config;
+    config.method      = ippl::Interpolation::ScatterMethod::Atomic;
+    config.lock_method = true;
+    this->runFusedScatterTest(config);
+}
+
+TYPED_TEST(ScatterGatherTest, FusedScatter_Tiled) {
+    typename TestFixture::scatter_config_type config;
+    config.method      = ippl::Interpolation::ScatterMethod::Tiled;
+    config.sort        = true;
+    config.lock_method = true;
+    this->runFusedScatterTest(config);
+}
+
+//=============================================================================
+// Tombstone Tests
+//=============================================================================
+
+TYPED_TEST(ScatterGatherTest, TombstonesSkipped) {
+    using T             = typename TestFixture::T;
+    using ExecSpace     = typename TestFixture::ExecSpace;
+    using vector_type   = ippl::Vector<T, TestFixture::Dim>;
+    using ScatterMethod = ippl::Interpolation::ScatterMethod;
+    using GatherMethod  = ippl::Interpolation::GatherMethod;
+    auto& bnc           = *this->bunch;
+
+    this->createUniformParticles(1000);
+    bnc.setCompactionThreshold(0.9);
+
+    // Destroy the first particle of every rank and move it far outside the domain with a
+    // large weight, such that a kernel touching it writes out of bounds or breaks the sums
+    const size_t nDead = bnc.getLocalNum() > 0 ? 1 : 0;
+    Kokkos::View<bool*, ExecSpace> invalid("invalid", bnc.getLocalNum());
+    Kokkos::deep_copy(invalid, false);
+    if (nDead > 0) {
+        Kokkos::deep_copy(Kokkos::subview(invalid, 0), true);
+    }
+    bnc.destroy(invalid, nDead);
+    if (nDead > 0) {
+        ASSERT_TRUE(bnc.R.hasHoles());
+        Kokkos::deep_copy(Kokkos::subview(bnc.R.getView(), 0), vector_type(-100 * this->extent[0]));
+        Kokkos::deep_copy(Kokkos::subview(bnc.weight.getView(), 0), T(1e6));
+    }
+
+    const T totalWeight = bnc.weight.sum();
+
+    for (auto [method, sort] : {std::pair{ScatterMethod::Atomic, false},
+                                std::pair{ScatterMethod::Atomic, true},
+                                std::pair{ScatterMethod::Tiled, true},
+                                std::pair{ScatterMethod::OutputFocused, true}}) {
+        typename TestFixture::scatter_config_type config;
+        config.method      = method;
+        config.sort        = sort;
+        config.lock_method = true;
+
+        typename TestFixture::field_type field(*this->mesh, *this->layout, this->nghost);
+        auto scatter = ippl::Scatter<typename TestFixture::kernel_type, TestFixture::Dim>(
+            this->kernel, config);
+        scatter(field, bnc.R, bnc.weight);
+        const T fieldSum = ippl::norm(field, 1);
+        EXPECT_LT(std::abs(fieldSum - totalWeight) / totalWeight, 1e-10)
+            << "scatter method " << static_cast<int>(method) << ", sort " << sort;
+
+        field = T(0);
+        scatter(std::tie(field), bnc.R, bnc.weight);
+        const T fusedSum = ippl::norm(field, 1);
+        EXPECT_LT(std::abs(fusedSum - totalWeight) / totalWeight, 1e-10)
+            << "fused scatter method " << static_cast<int>(method) << ", sort " << sort;
+    }
+
+    // Gathering a constant field leaves the value of the tombstone unchanged
+    typename TestFixture::field_type field(*this->mesh, *this->layout, this->nghost);
+    field = T(42);
+    for (auto method : {GatherMethod::Atomic, GatherMethod::AtomicSort, GatherMethod::Tiled}) {
+        typename TestFixture::gather_config_type config;
+        config.method = method;
+
+        bnc.gathered_scalar = T(0);
+        if (nDead > 0) {
+            Kokkos::deep_copy(Kokkos::subview(bnc.gathered_scalar.getView(), 0), T(-1));
+        }
+        auto gather = ippl::Gather<typename TestFixture::kernel_type, TestFixture::Dim>(
+            this->kernel, config);
+        gather(field, bnc.R, bnc.gathered_scalar);
+
+        auto gathered = bnc.gathered_scalar.getHostMirror();
+        Kokkos::deep_copy(gathered, bnc.gathered_scalar.getView());
+        for (size_t i = 0; i < bnc.getLocalNum(); ++i) {
+            EXPECT_NEAR(gathered(i), i < nDead ? T(-1) : T(42), 1e-10)
+                << "gather method " << static_cast<int>(method) << ", particle " << i;
+        }
+    }
+}
+
 //=============================================================================
 // Sorting Tests
 //=============================================================================
@@ -1373,6 +1546,33 @@ TYPED_TEST(ScatterGatherTest, Roundtrip_AtomicSort) {
     this->runRoundtripTest(scatterCfg, gatherCfg);
 }
 
+//=============================================================================
+// ES Kernel
+//=============================================================================
+
+template <int W>
+void checkESPiecewisePolynomial() {
+    ippl::Interpolation::ESKernel<double> kernel(W);
+    ASSERT_EQ(kernel.width(), W);
+
+    // the polynomial must be more accurate than the kernel itself (~10^(1-W))
+    const double tol = 0.5 * std::pow(10.0, 1 - W);
+    const int n      = 2001;
+    for (int i = 0; i <= n; ++i) {
+        const double x = -1.1 + 2.2 * double(i) / n;
+        EXPECT_NEAR(kernel.template eval<W>(x), kernel(x), tol) << "W = " << W << ", x = " << x;
+    }
+    EXPECT_DOUBLE_EQ(kernel.template eval<W>(1.0), 0.0);
+    EXPECT_NEAR(kernel.template eval<W>(0.0), 1.0, tol);
+}
+
+TEST(ESKernel, PiecewisePolynomialMatchesExact) {
+    checkESPiecewisePolynomial<2>();
+    checkESPiecewisePolynomial<5>();
+    checkESPiecewisePolynomial<8>();
+    checkESPiecewisePolynomial<ippl::Interpolation::ESKernel<double>::max_width>();
+}
+
 //=============================================================================
 // Main
 //=============================================================================
@@ -0,0 +1,255 @@
+//
+// Unit test ParticleAttribSoA
+//   Test the structure-of-arrays vector attribute in expressions, boundary
+//   conditions, particle migration and as positions of Scatter and Gather.
+//
+#include "Ippl.h"
+
+#include <random>
+
+#include "Interpolation/Gather/Gather.h"
+#include "Interpolation/Kernels.h"
+#include "Interpolation/Scatter/Scatter.h"
+#include "Particle/ParticleAttribSoA.h"
+#include "TestUtils.h"
+#include "gtest/gtest.h"
+
+template <typename T, typename ExecSpace, unsigned Dim>
+struct SoABunch
+    : public ippl::ParticleBase<
+          ippl::ParticleSpatialLayout<T, Dim, ippl::UniformCartesian<T, Dim>, ExecSpace>> {
+    using playout_type =
+        ippl::ParticleSpatialLayout<T, Dim, ippl::UniformCartesian<T, Dim>, ExecSpace>;
+
+    explicit SoABunch(playout_type& pl)
+        : ippl::ParticleBase<playout_type>(pl) {
+        this->addAttribute(P);
+        this->addAttribute(V);
+        this->addAttribute(Q);
+        this->addAttribute(G);
+    }
+
+    ippl::ParticleAttribSoA<T, Dim, ExecSpace> P;
+    ippl::ParticleAttrib<ippl::Vector<T, Dim>, ExecSpace> V;
+    ippl::ParticleAttrib<T, ExecSpace> Q;
+    ippl::ParticleAttrib<T, ExecSpace> G;
+};
+
+template <typename>
+class ParticleAttribSoATest;
+
+template <typename T_, typename ExecSpace, unsigned Dim_>
+class ParticleAttribSoATest<Parameters<T_, ExecSpace, Rank<Dim_>>> : public ::testing::Test {
+public:
+    using T                       = T_;
+    using exec_space              = ExecSpace;
+    static constexpr unsigned Dim = Dim_;
+    using mesh_type               = ippl::UniformCartesian<T, Dim>;
+    using playout_type            = ippl::ParticleSpatialLayout<T, Dim, mesh_type, ExecSpace>;
+    using bunch_type              = SoABunch<T, ExecSpace, Dim>;
+
+    ParticleAttribSoATest()
+        : nPoints(getGridSizes<Dim>()) {
+        std::array<ippl::Index, Dim> args;
+        ippl::Vector<T, Dim> hx, origin;
+        std::array<bool, Dim> isParallel;
+        isParallel.fill(true);
+        for (unsigned d = 0; d < Dim; d++) {
+            args[d]   = ippl::Index(nPoints[d]);
+            domain[d] = T(1);
+            hx[d]     = domain[d] / nPoints[d];
+            origin[d] = 0;
+        }
+        auto owned = std::make_from_tuple<ippl::NDIndex<Dim>>(args);
+
+        layout  = std::make_shared<ippl::FieldLayout<Dim>>(MPI_COMM_WORLD, owned, isParallel);
+        mesh    = std::make_shared<mesh_type>(owned, hx, origin);
+        playout = std::make_shared<playout_type>(*layout, *mesh);
+
+        bunch = std::make_shared<bunch_type>(*playout);
+        typename bunch_type::bc_container_type bcs;
+        bcs.fill(ippl::BC::PERIODIC);
+        bunch->setParticleBC(bcs);
+
+        bunch->create(nParticles);
+
+        std::mt19937_64 eng(42 + ippl::Comm->rank());
+        std::uniform_real_distribution<T> unif(T(0), T(1));
+        auto R_host = bunch->R.getHostMirror();
+        for (size_t i = 0; i < nParticles; ++i) {
+            for (unsigned d = 0; d < Dim; d++) {
+                R_host(i)[d] = unif(eng) * domain[d];
+            }
+        }
+        Kokkos::deep_copy(bunch->R.getView(), R_host);
+    }
+
+    //! Check P(i) == scale * R(i) for all local particles
+    void expectScaledPositions(T scale) {
+        auto R_host = bunch->R.getHostMirror();
+        Kokkos::deep_copy(R_host, bunch->R.getView());
+        auto P_host = bunch->P.getHostMirror();
+        Kokkos::deep_copy(P_host.getData(), bunch->P.getView().getData());
+
+        for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+            for (unsigned d = 0; d < Dim; d++) {
+                ASSERT_NEAR(P_host(i)[d], scale * R_host(i)[d], tolerance<T>);
+            }
+        }
+    }
+
+    static constexpr size_t nParticles = 256;
+
+    std::array<size_t, Dim> nPoints;
+    std::array<T, Dim> domain;
+
+    std::shared_ptr<ippl::FieldLayout<Dim>> layout;
+    std::shared_ptr<mesh_type> mesh;
+    std::shared_ptr<playout_type> playout;
+    std::shared_ptr<bunch_type> bunch;
+};
+
+using Tests = TestParams::tests<1, 2, 3>;
+TYPED_TEST_SUITE(ParticleAttribSoATest, Tests);
+
+TYPED_TEST(ParticleAttribSoATest, Expressions) {
+    using T    = typename TestFixture::T;
+    auto& bunch = this->bunch;
+
+    bunch->P = T(2) * bunch->R;
+    this->expectScaledPositions(T(2));
+
+    // Mixing SoA and AoS operands, and reading the assigned attribute
+    bunch->V = bunch->P + bunch->R;
+    bunch->P = bunch->P - T(0.5) * bunch->V;
+    this->expectScaledPositions(T(0.5));
+
+    // The components are contiguous columns
+    auto P_host = bunch->P.getHostMirror();
+    Kokkos::deep_copy(P_host.getData(), bunch->P.getView().getData());
+    auto col = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                   bunch->P.getView().component(0));
+    for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+        EXPECT_EQ(col(i), P_host(i)[0]);
+    }
+}
+
+TYPED_TEST(ParticleAttribSoATest, PeriodicBC) {
+    using T    = typename TestFixture::T;
+    auto& bunch = this->bunch;
+
+    // P = R + 1 lies outside the unit domain; wrapping gives back R
+    bunch->P = bunch->R + T(1);
+
+    std::array<ippl::PRegion<T>, TestFixture::Dim> args;
+    for (unsigned d = 0; d < TestFixture::Dim; d++) {
+        args[d] = ippl::PRegion<T>(0, this->domain[d]);
+    }
+    auto nr = std::make_from_tuple<ippl::NDRegion<T, TestFixture::Dim>>(args);
+    bunch->getLayout().applyBC(bunch->P, nr);
+
+    this->expectScaledPositions(T(1));
+}
+
+TYPED_TEST(ParticleAttribSoATest, Migration) {
+    using T    = typename TestFixture::T;
+    auto& bunch = this->bunch;
+
+    // Move every particle by half the domain and tie P to the new position;
+    // after the update P must have travelled with its particle
+    bunch->R = bunch->R + T(0.5);
+    bunch->P = T(3) * bunch->R;
+    bunch->update();
+
+    size_t total = 0;
+    size_t local = bunch->getLocalNum();
+    ippl::Comm->reduce(local, total, 1, std::plus<size_t>());
+    if (ippl::Comm->rank() == 0) {
+        EXPECT_EQ(total, TestFixture::nParticles * ippl::Comm->size());
+    }
+
+    // Periodic BCs wrapped R, but not P
+    auto R_host = bunch->R.getHostMirror();
+    Kokkos::deep_copy(R_host, bunch->R.getView());
+    auto P_host = bunch->P.getHostMirror();
+    Kokkos::deep_copy(P_host.getData(), bunch->P.getView().getData());
+    for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+        for (unsigned d = 0; d < TestFixture::Dim; d++) {
+            T r = P_host(i)[d] / T(3);
+            r -= std::floor(r / this->domain[d]) * this->domain[d];
+            EXPECT_NEAR(r, R_host(i)[d], 10 * tolerance<T>);
+        }
+    }
+}
+
+TYPED_TEST(ParticleAttribSoATest, ScatterGather) {
+    using T                = typename TestFixture::T;
+    constexpr unsigned Dim = TestFixture::Dim;
+    using mesh_type        = typename TestFixture::mesh_type;
+    using field_type = typename ippl::Field<T, Dim, mesh_type, typename mesh_type::DefaultCentering,
+                                            typename TestFixture::exec_space>::uniform_type;
+    using kernel_type = ippl::Interpolation::LinearKernel<T>;
+    auto& bunch       = this->bunch;
+
+    bunch->update();
+    bunch->P    = bunch->R;
+    auto Q_host = bunch->Q.getHostMirror();
+    for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+        Q_host(i) = T(1) + T(i % 7);
+    }
+    Kokkos::deep_copy(bunch->Q.getView(), Q_host);
+
+    const kernel_type kernel;
+    const int nghost = kernel.width() / 2 + 1;
+    std::array<bool, Dim> isParallel;
+    isParallel.fill(true);
+    ippl::FieldLayout<Dim> layout(MPI_COMM_WORLD, this->layout->getDomain(), isParallel, true,
+                                  nghost);
+    field_type fromR(*this->mesh, layout, nghost);
+    field_type fromP(*this->mesh, layout, nghost);
+    field_type diff(*this->mesh, layout, nghost);
+
+    // SoA positions must deposit exactly what the same AoS positions deposit
+    for (auto method : {ippl::Interpolation::ScatterMethod::Atomic,
+                        ippl::Interpolation::ScatterMethod::Tiled}) {
+        ippl::Interpolation::ScatterConfig<Dim> config;
+        config.method      = method;
+        config.sort        = method == ippl::Interpolation::ScatterMethod::Tiled;
+        config.lock_method = true;
+        auto scatter       = ippl::Scatter<kernel_type, Dim>(kernel, config);
+
+        scatter(fromR, bunch->R, bunch->Q);
+        scatter(fromP, bunch->P, bunch->Q);
+        diff = fromP - fromR;
+        EXPECT_NEAR(norm(diff), T(0), 10 * tolerance<T> * norm(fromR));
+    }
+
+    // ... and interpolate the same values; the charges are not needed anymore
+    for (auto method : {ippl::Interpolation::GatherMethod::Atomic,
+                        ippl::Interpolation::GatherMethod::Tiled}) {
+        ippl::Interpolation::GatherConfig<Dim> config;
+        config.method = method;
+        auto gather   = ippl::Gather<kernel_type, Dim>(kernel, config);
+
+        gather(fromR, bunch->R, bunch->Q);
+        gather(fromR, bunch->P, bunch->G);
+
+        auto G_host = bunch->G.getHostMirror();
+        Kokkos::deep_copy(Q_host, bunch->Q.getView());
+        Kokkos::deep_copy(G_host, bunch->G.getView());
+        for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+            EXPECT_NEAR(G_host(i), Q_host(i), 10 * tolerance<T> * std::abs(Q_host(i)));
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int success = 1;
+    ippl::initialize(argc, argv);
+    {
+        ::testing::InitGoogleTest(&argc, argv);
+        success = RUN_ALL_TESTS();
+    }
+    ippl::finalize();
+    return success;
+}
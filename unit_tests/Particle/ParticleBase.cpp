@@ -4,6 +4,11 @@
 //
 #include "Ippl.h"
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
 #include "Particle/ParticleAttrib.h"
 #include "TestUtils.h"
 #include "gtest/gtest.h"
@@ -168,6 +173,47 @@ TYPED_TEST(ParticleBaseTest, AllocThenCreatePreserves) {
     }
 }
 
+TYPED_TEST(ParticleBaseTest, InternalCopy) {
+    using T           = typename TestFixture::value_type;
+    using attrib_type = typename TestFixture::attribute_type;
+    using hash_type   = typename attrib_type::hash_type;
+
+    auto& pbase = this->pbase;
+
+    attrib_type Q;
+    pbase->addAttribute(Q);
+
+    const size_t nParticles = 10;
+    pbase->create(nParticles);
+
+    auto Q_host = Q.getHostMirror();
+    for (size_t i = 0; i < nParticles; ++i) {
+        Q_host(i) = T(i);
+    }
+    Kokkos::deep_copy(Q.getView(), Q_host);
+
+    // More copies than the capacity, such that the storage has to grow while copying
+    const size_t nCopies = Q.size() + 3;
+    hash_type indices("indices", nCopies);
+    auto indices_host = Kokkos::create_mirror_view(indices);
+    for (size_t k = 0; k < nCopies; ++k) {
+        indices_host(k) = (7 * k + 3) % nParticles;
+    }
+    Kokkos::deep_copy(indices, indices_host);
+
+    Q.internalCopy(indices);
+    ASSERT_GE(Q.size(), nParticles + nCopies);
+
+    Q_host = Q.getHostMirror();
+    Kokkos::deep_copy(Q_host, Q.getView());
+    for (size_t i = 0; i < nParticles; ++i) {
+        assertEqual<T>(Q_host(i), T(i));
+    }
+    for (size_t k = 0; k < nCopies; ++k) {
+        assertEqual<T>(Q_host(nParticles + k), T(indices_host(k)));
+    }
+}
+
 TYPED_TEST(ParticleBaseTest, AddAttribute) {
     using attrib_type = typename TestFixture::attribute_type;
 
@@ -182,6 +228,282 @@ TYPED_TEST(ParticleBaseTest, AddAttribute) {
     EXPECT_EQ(size_t(3), nAttributes);
 }
 
+TYPED_TEST(ParticleBaseTest, SortSpatially) {
+    using T           = typename TestFixture::value_type;
+    using attrib_type = typename TestFixture::attribute_type;
+    using policy_type = typename TestFixture::bunch_type::spatial_sort_policy_type;
+    constexpr unsigned Dim = TestFixture::playout_type::dim;
+
+    auto& pbase = this->pbase;
+
+    attrib_type Q;
+    pbase->addAttribute(Q);
+
+    constexpr size_t nParticles = 1000;
+    pbase->create(nParticles);
+
+    // Q remembers the first coordinate so we can check that attributes move together
+    std::mt19937_64 eng(17 + ippl::Comm->rank());
+    std::uniform_real_distribution<T> unif(0, 1);
+    auto R_host = pbase->R.getHostMirror();
+    auto Q_host = Q.getHostMirror();
+    for (size_t i = 0; i < nParticles; ++i) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            R_host(i)[d] = unif(eng);
+        }
+        Q_host(i) = R_host(i)[0];
+    }
+    Kokkos::deep_copy(pbase->R.getView(), R_host);
+    Kokkos::deep_copy(Q.getView(), Q_host);
+
+    auto ID_host = pbase->ID.getHostMirror();
+    Kokkos::deep_copy(ID_host, pbase->ID.getView());
+    std::vector<std::int64_t> ids(ID_host.data(), ID_host.data() + nParticles);
+    std::sort(ids.begin(), ids.end());
+
+    for (auto curve : {ippl::SpaceFillingCurve::Morton, ippl::SpaceFillingCurve::Hilbert}) {
+        policy_type policy;
+        policy.cellWidth = ippl::Vector<T, Dim>(T(1) / 16);
+        policy.curve     = curve;
+
+        const double before = pbase->meanStencilDistance(policy.cellWidth);
+        if (curve == ippl::SpaceFillingCurve::Morton) {
+            EXPECT_TRUE(pbase->sortSpatially(policy));
+        } else {
+            // Re-sorting along the other curve is forced with a zero threshold
+            policy.maxMeanDistance = 0;
+            EXPECT_TRUE(pbase->sortSpatially(policy));
+        }
+        const double after = pbase->meanStencilDistance(policy.cellWidth);
+        if (curve == ippl::SpaceFillingCurve::Morton) {
+            EXPECT_LT(after, before);
+        }
+
+        // The metric is now below the threshold, so the adaptive trigger skips the sort
+        policy.maxMeanDistance = after;
+        EXPECT_FALSE(pbase->sortSpatially(policy));
+
+        ASSERT_EQ(pbase->getLocalNum(), nParticles);
+        Kokkos::deep_copy(R_host, pbase->R.getView());
+        Kokkos::deep_copy(Q_host, Q.getView());
+        for (size_t i = 0; i < nParticles; ++i) {
+            EXPECT_EQ(Q_host(i), R_host(i)[0]);
+        }
+
+        Kokkos::deep_copy(ID_host, pbase->ID.getView());
+        std::vector<std::int64_t> sorted(ID_host.data(), ID_host.data() + nParticles);
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT_EQ(sorted, ids);
+    }
+}
+
+TYPED_TEST(ParticleBaseTest, HilbertLocality) {
+    using T           = typename TestFixture::value_type;
+    using policy_type = typename TestFixture::bunch_type::spatial_sort_policy_type;
+    constexpr unsigned Dim = TestFixture::playout_type::dim;
+
+    auto& pbase = this->pbase;
+
+    constexpr size_t nParticles = 4096;
+    pbase->create(nParticles);
+
+    std::mt19937_64 eng(29 + ippl::Comm->rank());
+    std::uniform_real_distribution<T> unif(0, 1);
+    auto R_host = pbase->R.getHostMirror();
+    for (size_t i = 0; i < nParticles; ++i) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            R_host(i)[d] = unif(eng);
+        }
+    }
+    Kokkos::deep_copy(pbase->R.getView(), R_host);
+
+    // About eight particles per cell, so that nearly every cell along the curve is occupied
+    const int nCells =
+        std::max(1, static_cast<int>(std::pow(double(nParticles) / 8, 1.0 / double(Dim))));
+
+    policy_type policy;
+    policy.cellWidth       = ippl::Vector<T, Dim>(T(1) / nCells);
+    policy.curve           = ippl::SpaceFillingCurve::Hilbert;
+    policy.maxMeanDistance = 0;
+
+    const double before = pbase->meanStencilDistance(policy.cellWidth);
+    EXPECT_TRUE(pbase->sortSpatially(policy));
+    const double after = pbase->meanStencilDistance(policy.cellWidth);
+
+    // Consecutive cells along the Hilbert curve are neighbours, so consecutive particles are
+    // on average less than one cell apart, whereas the random order is not
+    EXPECT_LT(after, 1.0);
+    if (nCells > 2) {
+        EXPECT_LT(after, 0.5 * before);
+    }
+}
+
+TYPED_TEST(ParticleBaseTest, Tombstones) {
+    if (ippl::Comm->size() > 1) {
+        std::cerr << "ParticleBaseTest::Tombstones test only works for one MPI rank!" << std::endl;
+        return;
+    }
+    using T           = typename TestFixture::value_type;
+    using attrib_type = typename TestFixture::attribute_type;
+
+    auto& pbase = this->pbase;
+
+    attrib_type Q;
+    pbase->addAttribute(Q);
+
+    const size_t nParticles = 100;
+    pbase->create(nParticles);
+    pbase->setCompactionThreshold(0.5);
+
+    // Destroy the particles with i % 10 in [lo, hi)
+    auto destroyRange = [&](int lo, int hi) {
+        typename TestFixture::bool_type invalid("invalid", nParticles);
+        auto mirror = Kokkos::create_mirror(invalid);
+        for (size_t i = 0; i < nParticles; ++i) {
+            mirror(i) = int(i % 10) >= lo && int(i % 10) < hi;
+        }
+        Kokkos::deep_copy(invalid, mirror);
+        pbase->destroy(invalid, (hi - lo) * nParticles / 10);
+    };
+
+    // 30% holes: only masked, the storage is untouched
+    destroyRange(0, 3);
+    EXPECT_EQ(pbase->getLocalNum(), nParticles);
+    EXPECT_EQ(pbase->getHoleCount(), size_t(30));
+    EXPECT_EQ(pbase->getTotalNum(), size_t(70));
+
+    // Assignments and reductions skip the tombstones
+    Q = T(2);
+    EXPECT_NEAR(Q.sum(), T(140), tolerance<T>);
+
+    // 60% holes: past the threshold, the storage is compacted
+    destroyRange(3, 6);
+    EXPECT_EQ(pbase->getHoleCount(), size_t(0));
+    EXPECT_EQ(pbase->getLocalNum(), size_t(40));
+    EXPECT_EQ(pbase->getTotalNum(), size_t(40));
+    EXPECT_NEAR(Q.sum(), T(80), tolerance<T>);
+
+    auto ids = pbase->ID.getHostMirror();
+    Kokkos::deep_copy(ids, pbase->ID.getView());
+    for (size_t i = 0; i < pbase->getLocalNum(); ++i) {
+        EXPECT_GE(ids(i) % 10, 6);
+    }
+}
+
+TYPED_TEST(ParticleBaseTest, TombstonesSurviveSort) {
+    if (ippl::Comm->size() > 1) {
+        std::cerr << "ParticleBaseTest::TombstonesSurviveSort test only works for one MPI rank!"
+                  << std::endl;
+        return;
+    }
+    using T           = typename TestFixture::value_type;
+    using attrib_type = typename TestFixture::attribute_type;
+    using policy_type = typename TestFixture::bunch_type::spatial_sort_policy_type;
+    constexpr unsigned Dim = TestFixture::playout_type::dim;
+
+    auto& pbase = this->pbase;
+
+    attrib_type Q;
+    pbase->addAttribute(Q);
+
+    const size_t nParticles = 1000;
+    pbase->create(nParticles);
+    pbase->setCompactionThreshold(0.5);
+
+    // Q holds the ID, which on a single rank is the initial index
+    std::mt19937_64 eng(31);
+    std::uniform_real_distribution<T> unif(0, 1);
+    auto R_host = pbase->R.getHostMirror();
+    auto Q_host = Q.getHostMirror();
+    for (size_t i = 0; i < nParticles; ++i) {
+        for (unsigned d = 0; d < Dim; ++d) {
+            R_host(i)[d] = unif(eng);
+        }
+        Q_host(i) = T(i);
+    }
+    Kokkos::deep_copy(pbase->R.getView(), R_host);
+    Kokkos::deep_copy(Q.getView(), Q_host);
+
+    typename TestFixture::bool_type invalid("invalid", nParticles);
+    auto mirror = Kokkos::create_mirror(invalid);
+    T liveSum   = 0;
+    for (size_t i = 0; i < nParticles; ++i) {
+        mirror(i) = i % 10 < 3;
+        liveSum += mirror(i) ? T(0) : T(i);
+    }
+    Kokkos::deep_copy(invalid, mirror);
+    pbase->destroy(invalid, 3 * nParticles / 10);
+    ASSERT_EQ(pbase->getHoleCount(), 3 * nParticles / 10);
+
+    // Below the threshold neither the layout update nor the sort compacts the storage
+    pbase->update();
+    EXPECT_EQ(pbase->getHoleCount(), 3 * nParticles / 10);
+
+    policy_type policy;
+    policy.cellWidth       = ippl::Vector<T, Dim>(T(0.1));
+    policy.curve           = ippl::SpaceFillingCurve::Hilbert;
+    policy.maxMeanDistance = 0;
+    EXPECT_TRUE(pbase->sortSpatially(policy));
+    EXPECT_EQ(pbase->getLocalNum(), nParticles);
+    EXPECT_EQ(pbase->getHoleCount(), 3 * nParticles / 10);
+    EXPECT_NEAR(Q.sum(), liveSum, tolerance<T> * liveSum);
+
+    // The tombstones moved along with their particles
+    auto valid = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), pbase->getValidMask());
+    auto ids   = pbase->ID.getHostMirror();
+    Kokkos::deep_copy(ids, pbase->ID.getView());
+    for (size_t i = 0; i < nParticles; ++i) {
+        EXPECT_EQ(valid(i), ids(i) % 10 >= 3) << "slot " << i;
+    }
+}
+
+TYPED_TEST(ParticleBaseTest, Fuse) {
+    if (ippl::Comm->size() > 1) {
+        std::cerr << "ParticleBaseTest::Fuse test only works for one MPI rank!" << std::endl;
+        return;
+    }
+    using T           = typename TestFixture::value_type;
+    using attrib_type = typename TestFixture::attribute_type;
+
+    auto& pbase = this->pbase;
+
+    attrib_type A, B;
+    pbase->addAttribute(A);
+    pbase->addAttribute(B);
+
+    const size_t nParticles = 100;
+    pbase->create(nParticles);
+
+    A = T(1);
+    B = T(2);
+
+    // the second assignment sees the value written by the first one
+    ippl::fuse(ippl::assign(A, A + B), ippl::assign(B, T(2) * A));
+    EXPECT_NEAR(A.sum(), T(300), tolerance<T>);
+    EXPECT_NEAR(B.sum(), T(600), tolerance<T>);
+
+    // tombstones are not assigned
+    pbase->setCompactionThreshold(0.5);
+    typename TestFixture::bool_type invalid("invalid", nParticles);
+    auto mirror = Kokkos::create_mirror(invalid);
+    for (size_t i = 0; i < nParticles; ++i) {
+        mirror(i) = i % 10 == 0;
+    }
+    Kokkos::deep_copy(invalid, mirror);
+    pbase->destroy(invalid, nParticles / 10);
+    ASSERT_EQ(pbase->getHoleCount(), nParticles / 10);
+
+    ippl::fuse(ippl::assign(A, T(1)), ippl::assign(B, B + A));
+    EXPECT_NEAR(A.sum(), T(90), tolerance<T>);
+    EXPECT_NEAR(B.sum(), T(630), tolerance<T>);
+
+    auto hostA = A.getHostMirror();
+    Kokkos::deep_copy(hostA, A.getView());
+    for (size_t i = 0; i < nParticles; i += 10) {
+        assertEqual<T>(hostA(i), 3);
+    }
+}
+
 TYPED_TEST(InitializationTest, Initialize1) {
     typename TestFixture::playout_type pl;
     typename TestFixture::bunch_type bunch(pl);
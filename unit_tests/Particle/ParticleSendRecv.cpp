@@ -23,6 +23,8 @@ public:
 
     using rank_type = ippl::ParticleAttrib<int, ExecSpace>;
 
+    static constexpr unsigned dim = Dim;
+
     template <class PLayout>
     struct Bunch : public ippl::ParticleBase<PLayout> {
         explicit Bunch(PLayout& playout)
@@ -128,6 +130,40 @@ public:
         Kokkos::fence();
     }
 
+    void sendBlockInRing() {
+        const int rank   = ippl::Comm->rank();
+        const int nRanks = ippl::Comm->size();
+        const int next   = (rank + 1) % nRanks;
+        const int prev   = (rank + nRanks - 1) % nRanks;
+
+        // Every rank sends its first particles to the next rank in a ring
+        const size_t numLoc = bunch->getLocalNum();
+        const size_t count  = numLoc / 2;
+
+        auto Q_host = bunch->Q.getHostMirror();
+        for (size_t i = 0; i < numLoc; ++i) {
+            Q_host(i) = rank * numLoc + i;
+        }
+        Kokkos::deep_copy(bunch->Q.getView(), Q_host);
+
+        using namespace ippl::mpi::tag;
+        const int tag = ippl::Comm->next_tag(P_SPATIAL_LAYOUT, P_LAYOUT_CYCLE);
+        std::vector<MPI_Request> requests;
+        bunch->postRecvBlockFromRank(prev, tag, numLoc, count, requests);
+        bunch->sendBlockToRank(next, tag, 0, count, requests);
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        bunch->setLocalNum(numLoc + count);
+
+        // The received block follows the local particles and the sent block is unchanged.
+        // The receive may have grown the attribute, so the mirror is created anew.
+        Q_host = bunch->Q.getHostMirror();
+        Kokkos::deep_copy(Q_host, bunch->Q.getView());
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(Q_host(i), T(rank * numLoc + i));
+            ASSERT_EQ(Q_host(numLoc + i), T(prev * numLoc + i));
+        }
+    }
+
     std::shared_ptr<bunch_type> bunch;
     const unsigned int nParticles = 128;
     std::array<size_t, Dim> nPoints;
@@ -166,6 +202,66 @@ TYPED_TEST(ParticleSendRecv, SendAndRecieve) {
     }
 }
 
+TYPED_TEST(ParticleSendRecv, SendAndReceiveCompressed) {
+    using T                = typename TestFixture::bunch_type::charge_container_type::value_type;
+    constexpr unsigned Dim = TestFixture::dim;
+    const auto nParticles  = this->nParticles;
+    auto& bunch            = this->bunch;
+
+    // The charge is a function of the position, so that a corrupted byte in
+    // either attribute shows up after the exchange
+    auto charge = [](const ippl::Vector<T, Dim>& r) {
+        T q = 0;
+        for (unsigned d = 0; d < Dim; d++) {
+            q += (d + 1) * r[d];
+        }
+        return q;
+    };
+
+    auto R_host = bunch->R.getHostMirror();
+    Kokkos::deep_copy(R_host, bunch->R.getView());
+    auto Q_host = bunch->Q.getHostMirror();
+    for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+        Q_host(i) = charge(R_host(i));
+    }
+    Kokkos::deep_copy(bunch->Q.getView(), Q_host);
+
+    bunch->setCompression(ippl::mpi::Compression::losslessFor(sizeof(T)));
+    bunch->update();
+
+    auto ER_host = bunch->expectedRank.getHostMirror();
+    Kokkos::deep_copy(ER_host, bunch->expectedRank.getView());
+    R_host = bunch->R.getHostMirror();
+    Kokkos::deep_copy(R_host, bunch->R.getView());
+    Q_host = bunch->Q.getHostMirror();
+    Kokkos::deep_copy(Q_host, bunch->Q.getView());
+
+    for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+        ASSERT_EQ(ER_host(i), ippl::Comm->rank());
+        ASSERT_EQ(Q_host(i), charge(R_host(i)));
+    }
+
+    unsigned int totalParticles = 0;
+    unsigned int localParticles = bunch->getLocalNum();
+    ippl::Comm->reduce(localParticles, totalParticles, 1, std::plus<unsigned int>());
+    if (ippl::Comm->rank() == 0) {
+        ASSERT_EQ(nParticles, totalParticles);
+    }
+
+    EXPECT_THROW(bunch->setCompression(ippl::mpi::Compression::truncated()), IpplException);
+}
+
+TYPED_TEST(ParticleSendRecv, SendAndReceiveBlock) {
+    this->sendBlockInRing();
+}
+
+TYPED_TEST(ParticleSendRecv, SendAndReceiveBlockCompressed) {
+    using T = typename TestFixture::bunch_type::charge_container_type::value_type;
+
+    this->bunch->setCompression(ippl::mpi::Compression::losslessFor(sizeof(T)));
+    this->sendBlockInRing();
+}
+
 int main(int argc, char* argv[]) {
     int success = 1;
     ippl::initialize(argc, argv);
@@ -23,6 +23,10 @@
 //  13.  Zero-particle ranks: a rank with no particles participates correctly.
 //  14.  Heterogeneous displacement magnitudes in the same step.
 //  15.  3-D corner migration (all three axes crossed simultaneously).
+//  16.  Neighbor-only count exchange and its Alltoall fallback.
+//  17.  Fused push + BC + locate matches a host push followed by update().
+//  18.  Attributes survive an all-to-all exchange whose messages complete
+//       out of order, with and without tombstones to receive into.
 //
 #include "Ippl.h"
 
@@ -71,6 +75,7 @@ class TestParticleUpdate<Parameters<T_, ExecSpace, Rank<Dim_>>> : public ::testi
 public:
     // ---- type aliases --------------------------------------------------
     using T                       = T_;
+    using exec_space              = ExecSpace;
     static constexpr unsigned Dim = Dim_;
     using flayout_type            = ippl::FieldLayout<Dim>;
     using mesh_type               = ippl::UniformCartesian<T, Dim>;
@@ -181,8 +186,14 @@ public:
         auto regions_host = Kokkos::create_mirror_view(regions);
         Kokkos::deep_copy(regions_host, regions);
 
+        // Tombstones keep stale positions and are not checked
+        auto valid = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b.getValidMask());
+
         size_t misplaced = 0;
         for (size_t i = 0; i < b.getLocalNum(); ++i) {
+            if (valid.extent(0) > 0 && !valid(i)) {
+                continue;
+            }
             bool inMyRegion = true;
             for (unsigned d = 0; d < Dim; d++) {
                 T pos = R_host(i)[d];
@@ -815,6 +826,317 @@ TYPED_TEST(TestParticleUpdate, RepeatedCreateAndUpdateCycles) {
     }
 }
 
+// ============================================================
+//  Neighbor-only count exchange, with fallback for far jumps
+// ============================================================
+TYPED_TEST(TestParticleUpdate, NeighborCountExchange) {
+    using T            = typename TestFixture::T;
+    using playout_type = typename TestFixture::playout_type;
+    using bunch_type   = typename TestFixture::bunch_type;
+
+    playout_type pl(*this->layout, *this->mesh, false, ippl::CountExchange::Neighbor);
+    bunch_type bunch(pl);
+    typename bunch_type::bc_container_type bcs;
+    bcs.fill(ippl::BC::PERIODIC);
+    bunch.setParticleBC(bcs);
+
+    this->fillRandom(bunch, 512);
+    const size_t total = this->totalParticles(bunch);
+
+    // The random initial positions can be anywhere, so bring the particles to their owners first
+    bunch.update();
+    const size_t neighborBefore = pl.getNeighborExchangeCount();
+    const size_t fallbackBefore = pl.getGlobalFallbackCount();
+
+    auto shift = [&](T fraction) {
+        auto R_host = bunch.R.getHostMirror();
+        Kokkos::deep_copy(R_host, bunch.R.getView());
+        for (size_t i = 0; i < bunch.getLocalNum(); ++i) {
+            for (unsigned d = 0; d < TestFixture::Dim; d++) {
+                R_host(i)[d] = this->periodicWrap(R_host(i)[d] + fraction * this->domain[d],
+                                                  this->domain[d]);
+            }
+        }
+        Kokkos::deep_copy(bunch.R.getView(), R_host);
+        bunch.R.markModified();
+    };
+
+    // Move every particle by the given fraction of its distance to the domain center. This
+    // never wraps around the periodic boundary, so the destinations are neighbors of the
+    // current owner as long as the displacement is smaller than a local domain.
+    auto contract = [&](T fraction) {
+        auto R_host = bunch.R.getHostMirror();
+        Kokkos::deep_copy(R_host, bunch.R.getView());
+        for (size_t i = 0; i < bunch.getLocalNum(); ++i) {
+            for (unsigned d = 0; d < TestFixture::Dim; d++) {
+                R_host(i)[d] += fraction * (T(0.5) * this->domain[d] - R_host(i)[d]);
+            }
+        }
+        Kokkos::deep_copy(bunch.R.getView(), R_host);
+        bunch.R.markModified();
+    };
+
+    // Small displacements stay within the neighborhood
+    for (int step = 0; step < 3; ++step) {
+        contract(T(0.01));
+        bunch.update();
+        EXPECT_EQ(total, this->totalParticles(bunch)) << "at step " << step;
+        EXPECT_EQ(0u, this->countMisplaced(bunch)) << "at step " << step;
+    }
+
+    if (ippl::Comm->size() > 1) {
+        EXPECT_EQ(pl.getNeighborExchangeCount(), neighborBefore + 3);
+        EXPECT_EQ(pl.getGlobalFallbackCount(), fallbackBefore);
+    }
+
+    // A jump across half the domain may leave the neighborhood
+    shift(T(0.5));
+    bunch.update();
+    EXPECT_EQ(total, this->totalParticles(bunch));
+    EXPECT_EQ(0u, this->countMisplaced(bunch));
+
+    if (ippl::Comm->size() > 1) {
+        EXPECT_EQ(pl.getNeighborExchangeCount() + pl.getGlobalFallbackCount(),
+                  neighborBefore + fallbackBefore + 4);
+    }
+}
+
+// ============================================================
+//  17. pushAndLocate matches push followed by update()
+// ============================================================
+TYPED_TEST(TestParticleUpdate, PushAndLocateMatchesUpdate) {
+    using T                = typename TestFixture::T;
+    using position_type    = typename TestFixture::position_type;
+    constexpr unsigned Dim = TestFixture::Dim;
+
+    // Large enough to cross rank boundaries and the periodic boundary
+    position_type shift;
+    for (unsigned d = 0; d < Dim; d++) {
+        shift[d] = T(0.7) * this->domain[d];
+    }
+
+    // Destroy every fourth particle of a bunch in tombstone mode
+    auto makeHoles = [](auto& bunch) {
+        bunch.setCompactionThreshold(0.9);
+        auto t_h = bunch.tag.getHostMirror();
+        Kokkos::deep_copy(t_h, bunch.tag.getView());
+        Kokkos::View<bool*, typename TestFixture::exec_space> invalid("invalid",
+                                                                      bunch.getLocalNum());
+        auto invalid_h    = Kokkos::create_mirror_view(invalid);
+        size_t destroyNum = 0;
+        for (size_t i = 0; i < bunch.getLocalNum(); ++i) {
+            invalid_h(i) = t_h(i) % 4 == 0;
+            destroyNum += invalid_h(i);
+        }
+        Kokkos::deep_copy(invalid, invalid_h);
+        bunch.destroy(invalid, destroyNum);
+    };
+
+    // The live particles of a bunch, sorted by tag
+    auto collect = [](auto& bunch) {
+        auto R_h = bunch.R.getHostMirror();
+        auto t_h = bunch.tag.getHostMirror();
+        Kokkos::deep_copy(R_h, bunch.R.getView());
+        Kokkos::deep_copy(t_h, bunch.tag.getView());
+        auto valid = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bunch.getValidMask());
+        std::vector<std::pair<long long, position_type>> particles;
+        for (size_t i = 0; i < bunch.getLocalNum(); ++i) {
+            if (valid.extent(0) == 0 || valid(i)) {
+                particles.push_back({t_h(i), R_h(i)});
+            }
+        }
+        std::sort(particles.begin(), particles.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        return particles;
+    };
+
+    for (bool holes : {false, true}) {
+        SCOPED_TRACE(holes ? "with tombstones" : "without tombstones");
+
+        auto fused     = this->makeBunch();
+        auto reference = this->makeBunch();
+        this->fillRandom(*fused, 256, 7);
+        this->fillRandom(*reference, 256, 7);
+        if (holes) {
+            makeHoles(*fused);
+            makeHoles(*reference);
+            ASSERT_GT(fused->getHoleCount(), 0u);
+        }
+        const auto live = collect(*fused);
+
+        for (int step = 0; step < 2; ++step) {
+            // The push must not touch the tombstones, which only the exchange may refill
+            auto R_before = fused->R.getHostMirror();
+            Kokkos::deep_copy(R_before, fused->R.getView());
+            auto valid = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                             fused->getValidMask());
+
+            fused->getLayout().pushAndLocate(
+                *fused, KOKKOS_LAMBDA(const size_t, position_type& r) { r += shift; });
+
+            auto R_host = reference->R.getHostMirror();
+            Kokkos::deep_copy(R_host, reference->R.getView());
+            for (size_t i = 0; i < reference->getLocalNum(); ++i) {
+                R_host(i) += shift;
+            }
+            Kokkos::deep_copy(reference->R.getView(), R_host);
+            reference->update();
+
+            if (ippl::Comm->size() == 1 && valid.extent(0) > 0) {
+                auto R_after = fused->R.getHostMirror();
+                Kokkos::deep_copy(R_after, fused->R.getView());
+                for (size_t i = 0; i < valid.extent(0); ++i) {
+                    if (!valid(i)) {
+                        for (unsigned d = 0; d < Dim; d++) {
+                            EXPECT_EQ(R_after(i)[d], R_before(i)[d]) << "tombstone " << i;
+                        }
+                    }
+                }
+            }
+
+            auto a = collect(*fused);
+            auto b = collect(*reference);
+            size_t numLive = a.size();
+            ippl::Comm->allreduce(numLive, 1, std::plus<size_t>());
+            size_t numInitial = live.size();
+            ippl::Comm->allreduce(numInitial, 1, std::plus<size_t>());
+            EXPECT_EQ(numInitial, numLive) << "at step " << step;
+            EXPECT_EQ(0u, this->countMisplaced(*fused)) << "at step " << step;
+
+            // Both bunches own the same particles, possibly in a different order
+            ASSERT_EQ(a.size(), b.size()) << "at step " << step;
+            for (size_t i = 0; i < a.size(); ++i) {
+                ASSERT_EQ(a[i].first, b[i].first);
+                for (unsigned d = 0; d < Dim; d++) {
+                    EXPECT_NEAR(a[i].second[d], b[i].second[d], tolerance<T>);
+                }
+            }
+        }
+    }
+}
+
+// ============================================================
+//  18. Attributes survive messages that complete out of order
+// ============================================================
+TYPED_TEST(TestParticleUpdate, AttributesSurviveOutOfOrderArrival) {
+    using T                = typename TestFixture::T;
+    constexpr unsigned Dim = TestFixture::Dim;
+
+    // Waitany only reorders anything if a rank receives several messages
+    if (ippl::Comm->size() < 3)
+        GTEST_SKIP();
+
+    // The charge is a function of the tag, so a particle whose attributes were
+    // mixed up with another one's, or unpacked at the wrong offset, is detected
+    auto charge = [](long long tag) { return static_cast<T>(tag % 997) + T(0.25); };
+
+    const int myRank = ippl::Comm->rank();
+    for (bool holes : {false, true}) {
+        SCOPED_TRACE(holes ? "with tombstones" : "without tombstones");
+
+        // Rank 0 holds far more particles than the others. Its messages take the
+        // longest to pack and transfer but are the first ones every receiver posts,
+        // so they tend to complete after the messages of the other ranks.
+        auto bunch = this->makeBunch();
+        bunch->create(myRank == 0 ? 20000 : 64);
+        if (holes) {
+            bunch->setCompactionThreshold(0.9);
+        }
+
+        std::mt19937_64 eng(99 + myRank);
+        std::uniform_real_distribution<T> unif(T(0), T(1));
+        {
+            auto R_host = bunch->R.getHostMirror();
+            auto Q_host = bunch->Q.getHostMirror();
+            auto t_host = bunch->tag.getHostMirror();
+            for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+                for (unsigned d = 0; d < Dim; d++) {
+                    R_host(i)[d] = unif(eng) * this->domain[d];
+                }
+                t_host(i) = static_cast<long long>(myRank) * 10'000'000LL
+                            + static_cast<long long>(i);
+                Q_host(i) = charge(t_host(i));
+            }
+            Kokkos::deep_copy(bunch->R.getView(), R_host);
+            Kokkos::deep_copy(bunch->Q.getView(), Q_host);
+            Kokkos::deep_copy(bunch->tag.getView(), t_host);
+        }
+
+        // Count and tag checksum of the live particles of all ranks. Nothing may be
+        // lost or duplicated by an update.
+        auto census = [&]() {
+            auto t_host = bunch->tag.getHostMirror();
+            Kokkos::deep_copy(t_host, bunch->tag.getView());
+            auto valid =
+                Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bunch->getValidMask());
+            long long count = 0;
+            long long sum   = 0;
+            for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+                if (valid.extent(0) == 0 || valid(i)) {
+                    ++count;
+                    sum += t_host(i);
+                }
+            }
+            ippl::Comm->allreduce(count, 1, std::plus<long long>());
+            ippl::Comm->allreduce(sum, 1, std::plus<long long>());
+            return std::make_pair(count, sum);
+        };
+        for (int step = 0; step < 3; ++step) {
+            if (holes) {
+                // Leave tombstones for the received particles to fill
+                auto t_host = bunch->tag.getHostMirror();
+                Kokkos::deep_copy(t_host, bunch->tag.getView());
+                auto valid = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                                 bunch->getValidMask());
+                Kokkos::View<bool*, typename TestFixture::exec_space> invalid(
+                    "invalid", bunch->getLocalNum());
+                auto invalid_h    = Kokkos::create_mirror_view(invalid);
+                size_t destroyNum = 0;
+                for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+                    const bool live = valid.extent(0) == 0 || valid(i);
+                    invalid_h(i)    = live && (t_host(i) + step) % 5 == 0;
+                    destroyNum += invalid_h(i);
+                }
+                Kokkos::deep_copy(invalid, invalid_h);
+                bunch->destroy(invalid, destroyNum);
+            }
+
+            // Scatter the particles over the whole domain, so that every rank sends
+            // to every other rank
+            auto R_host = bunch->R.getHostMirror();
+            Kokkos::deep_copy(R_host, bunch->R.getView());
+            for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+                for (unsigned d = 0; d < Dim; d++) {
+                    R_host(i)[d] = unif(eng) * this->domain[d];
+                }
+            }
+            Kokkos::deep_copy(bunch->R.getView(), R_host);
+            bunch->R.markModified();
+
+            const auto before = census();
+            bunch->update();
+
+            EXPECT_EQ(before, census()) << "at step " << step;
+            EXPECT_EQ(0u, this->countMisplaced(*bunch)) << "at step " << step;
+
+            auto t_host = bunch->tag.getHostMirror();
+            auto Q_host = bunch->Q.getHostMirror();
+            Kokkos::deep_copy(t_host, bunch->tag.getView());
+            Kokkos::deep_copy(Q_host, bunch->Q.getView());
+            auto valid =
+                Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bunch->getValidMask());
+            size_t mismatches = 0;
+            for (size_t i = 0; i < bunch->getLocalNum(); ++i) {
+                if ((valid.extent(0) == 0 || valid(i)) && Q_host(i) != charge(t_host(i))) {
+                    ++mismatches;
+                }
+            }
+            // No early return, the next update is collective
+            EXPECT_EQ(0u, mismatches) << "at step " << step;
+        }
+    }
+}
+
 // ============================================================
 //  Entry point
 // ============================================================